@@ -2,12 +2,15 @@
 
 #pragma once
 #include "osCore/Serialization/CoreKeySerializer.h"
+#include "osData/ThreadSettings.h"
 #include "osData/Uri.h"
 
 namespace NS_OSBASE::broker {
 
     struct Input {
         unsigned short port;
+        data::CpuSet cpus;                                 // affinity of the threads of the broker, none if empty
+        std::string scheme = data::Uri::schemeWebsocket(); // scheme of the output uri: ws (WebSocket) or rs (RawSocket)
     };
 
     struct Output {
@@ -19,6 +22,6 @@ namespace NS_OSBASE::broker {
         std::optional<Output> output;
     };
 } // namespace NS_OSBASE::broker
-OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::broker::Input, port)
+OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::broker::Input, port, cpus, scheme)
 OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::broker::Output, uri)
 OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::broker::Settings, input, output)
@@ -15,19 +15,20 @@ namespace NS_OSBASE::broker {
     }
 
     int BrokerRunner::run() {
-        auto const pBroker = data::makeBroker();
+        auto settings      = getData<Settings>();
+        auto const input   = settings.input.value_or(Input{ 8080 });
+        auto const pBroker = data::makeBroker(input.cpus);
         std::condition_variable cvStop;
         std::mutex mutStop;
         bool bStop = false;
 
         return Runner::run(
-            [this, &pBroker, &mutStop, &cvStop, &bStop]() {
-                auto settings   = getData<Settings>();
-                auto const port = pBroker->start(settings.input.value_or(Input{ 8080 }).port);
+            [this, &settings, &input, &pBroker, &mutStop, &cvStop, &bStop]() {
+                auto const port = pBroker->start(input.port);
 
                 auto const pNetwork = data::makeNetwork();
-                settings.output =
-                    Output{ data::Uri{ data::Uri::schemeWebsocket(), data::Uri::Authority{ {}, pNetwork->getLocalHost(), port } } };
+                // both protocols are served on the port: the scheme given to the services
+                settings.output = Output{ data::Uri{ input.scheme, data::Uri::Authority{ {}, pNetwork->getLocalHost(), port } } };
                 sendData(settings);
 
                 std::unique_lock lock(mutStop);
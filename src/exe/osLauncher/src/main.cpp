@@ -38,7 +38,11 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv) {
     // broker
     nsapp::ServiceSettings serviceSettings;
     auto const port = launcherSettings.brokerUrl.authority.value_or(nsdata::Uri::Authority{ {}, {}, 8080 }).port.value_or(8080);
-    nsbroker::Settings brokerSettings{ nsbroker::Input{ port }, {} };
+    nsbroker::Input brokerInput{ port };
+    if (!launcherSettings.brokerUrl.scheme.empty()) {
+        brokerInput.scheme = launcherSettings.brokerUrl.scheme; // rs: the services use RawSocket
+    }
+    nsbroker::Settings brokerSettings{ brokerInput, {} };
     auto pBrokerProcess = nsapp::Process::create({ BROKER_NAME }, brokerSettings);
     brokerSettings      = pBrokerProcess->getData<nsbroker::Settings>(10s);
 
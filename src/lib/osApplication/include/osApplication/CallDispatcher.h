@@ -0,0 +1,53 @@
+// \file  CallDispatcher.h
+// \brief Declaration of the class CallDispatcher
+
+#pragma once
+#include "InlineTask.h"
+#include "TaskLoopPool.h"
+#include "osCore/Misc/NonCopyable.h"
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief   This class executes the calls of a registered method on the workers of a TaskLoopPool, with a maximal number of concurrent
+     * executions
+     *
+     * \remark  The calls are executed by at most getConcurrency() strands of the pool: a concurrency of 1 serializes the calls, without
+     * blocking the thread of the messaging. When all the strands are busy, the calls are queued and executed in their order of arrival.
+     * The effective concurrency is also bounded by the number of workers of the pool.
+     *
+     * \ingroup PACKAGE_SERVICE
+     */
+    class CallDispatcher : private core::NonCopyable {
+    public:
+        /**
+         * \brief   Ctor
+         * \param   pPool       pool executing the calls
+         * \param   concurrency maximal number of concurrent calls (at least 1)
+         */
+        CallDispatcher(TaskLoopPoolPtr pPool, const size_t concurrency);
+
+        /**
+         * \brief   Dtor - wait for the end of the running calls, the queued ones are not executed (destroyed)
+         */
+        ~CallDispatcher();
+
+        void dispatch(InlineTask call);   //!< Execute the call by an idle strand, or queue it (the call must not throw)
+        size_t getConcurrency() const;    //!< Return the maximal number of concurrent calls
+        size_t getNbPendingCalls() const; //!< Return the number of queued calls
+
+    private:
+        void execute(TaskLoop &strand, InlineTask call);
+        void onCallEnd(TaskLoop &strand);
+
+        TaskLoopPoolPtr m_pPool;
+        const size_t m_concurrency;
+        mutable std::mutex m_mutex;
+        std::vector<TaskLoopPtr> m_strands;
+        std::vector<TaskLoop *> m_idleStrands;
+        std::deque<InlineTask> m_pendingCalls;
+    };
+} // namespace NS_OSBASE::application
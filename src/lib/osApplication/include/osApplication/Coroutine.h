@@ -0,0 +1,136 @@
+// \file  Coroutine.h
+// \brief Declaration of the coroutines executed on a TaskLoop (C++20)
+
+#pragma once
+#include "TaskLoop.h"
+
+#ifdef __cpp_impl_coroutine
+#include "osData/AsyncData.h"
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace NS_OSBASE::application {
+
+    namespace internal {
+        class CoPromiseBase;
+        template <typename T>
+        class CoPromise;
+    } // namespace internal
+
+    /**
+     * \brief   This class is a lazy coroutine executed on a TaskLoop
+     *
+     * \remark  The coroutine starts when it is spawned on a TaskLoop (TaskLoop::spawn()) or awaited by another CoTask (it runs on the
+     * TaskLoop of the awaiting coroutine). Each resumption is a task of its TaskLoop: the coroutine is executed on the thread (or the
+     * strand) of the loop, one task at a time with the other ones, and a suspended coroutine doesn't hold any thread.
+     * The TaskLoop must outlive its coroutines: a coroutine suspended when the loop is stopped, or whose resumption is rejected by the
+     * overflow policy of the loop, is not resumed anymore.
+     *
+     * \tparam  T   type of the result of the coroutine
+     * \ingroup PACKAGE_TASK
+     */
+    template <typename T = void>
+    class CoTask {
+        friend class TaskLoop;
+
+    public:
+        using promise_type = internal::CoPromise<T>;              //!< \private
+        using Handle       = std::coroutine_handle<promise_type>; //!< \private
+
+        class Awaiter;
+
+        CoTask() = default;                         //!< empty coroutine
+        explicit CoTask(Handle handle) noexcept;    //!< \private
+        CoTask(CoTask &&other) noexcept;            //!< move ctor
+        CoTask &operator=(CoTask &&other) noexcept; //!< move assignment
+        ~CoTask();                                  //!< destroy the frame of the coroutine if owned
+
+        [[nodiscard]] bool isDone() const noexcept; //!< indicates if the coroutine is empty or completed
+        Awaiter operator co_await() &&noexcept;     //!< start the coroutine on the TaskLoop of the awaiting one, return its result
+
+    private:
+        Handle release() noexcept;
+
+        Handle m_handle;
+    };
+
+    /**
+     * \brief   Awaiter of a CoTask: the awaiting coroutine is resumed when the awaited one is completed
+     * \ingroup PACKAGE_TASK
+     */
+    template <typename T>
+    class CoTask<T>::Awaiter {
+    public:
+        explicit Awaiter(Handle handle) noexcept; //!< \private
+
+        bool await_ready() const noexcept; //!< \private
+        template <typename TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> continuation) noexcept; //!< \private
+        T await_resume();                                                                               //!< \private
+
+    private:
+        Handle m_handle;
+    };
+
+    /**
+     * \brief   Awaiter returned by TaskLoop::schedule() and TaskLoop::sleep(): the coroutine is resumed by a task of the loop
+     * \remark  A CoTask awaiting it is moved to the loop: its next resumptions are also executed on this loop.
+     * \ingroup PACKAGE_TASK
+     */
+    class ScheduleAwaiter {
+    public:
+        ScheduleAwaiter(TaskLoop &taskLoop, const TaskAttributes &attributes, const std::chrono::milliseconds &delay); //!< \private
+
+        bool await_ready() const noexcept; //!< \private
+        template <typename TPromise>
+        void await_suspend(std::coroutine_handle<TPromise> handle); //!< \private
+        void await_resume() const noexcept;                         //!< \private
+
+    private:
+        TaskLoop &m_taskLoop;
+        TaskAttributes m_attributes;
+        std::chrono::milliseconds m_delay;
+    };
+
+    /**
+     * \brief   Awaiter returned by coGet(): the coroutine is resumed when the value of the AsyncData is received
+     * \ingroup PACKAGE_TASK
+     */
+    template <typename T, bool Paged>
+    class AsyncDataAwaiter {
+    public:
+        explicit AsyncDataAwaiter(data::AsyncData<T, Paged> &asyncData); //!< \private
+
+        bool await_ready() const noexcept; //!< \private
+        template <typename TPromise>
+        void await_suspend(std::coroutine_handle<TPromise> handle); //!< \private
+        T await_resume();                                           //!< \private
+
+    private:
+        struct State {
+            std::atomic_bool bReceived = false;
+            std::optional<T> value;
+        };
+
+        data::AsyncData<T, Paged> &m_asyncData;
+        std::shared_ptr<State> m_pState = std::make_shared<State>();
+    };
+
+    /**
+     * \brief   Awaitable version of AsyncData::get(): wait for the value without blocking the thread
+     * \remark  The coroutine is resumed on its TaskLoop (on the thread receiving the value if it is not a CoTask). The awaiter is the
+     *          callback receiver of the AsyncData until the next one is set: the values received after the awaited one are ignored. The
+     *          AsyncData must outlive the awaiting.
+     * \param   asyncData   data to receive
+     * \return  awaitable on the received value
+     * \ingroup PACKAGE_TASK
+     */
+    template <typename T, bool Paged>
+    AsyncDataAwaiter<T, Paged> coGet(data::AsyncData<T, Paged> &asyncData);
+
+} // namespace NS_OSBASE::application
+
+#include "Coroutine.inl"
+#endif
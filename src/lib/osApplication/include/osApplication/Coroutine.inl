@@ -0,0 +1,301 @@
+// \file  Coroutine.inl
+// \brief Implementation of the coroutines executed on a TaskLoop
+
+#pragma once
+
+namespace NS_OSBASE::application {
+
+    namespace internal {
+        /*
+         * \class CoPromiseBase
+         */
+        class CoPromiseBase {
+        public:
+            struct FinalAwaiter {
+                bool await_ready() const noexcept {
+                    return false;
+                }
+
+                template <typename TPromise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) noexcept {
+                    return static_cast<CoPromiseBase &>(handle.promise()).onFinalSuspend(handle);
+                }
+
+                void await_resume() const noexcept {
+                }
+            };
+
+            std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() const noexcept {
+                return {};
+            }
+
+            void unhandled_exception() noexcept {
+                m_pException = std::current_exception();
+            }
+
+            TaskLoop *getTaskLoop() const noexcept {
+                return m_pTaskLoop;
+            }
+
+            void setTaskLoop(TaskLoop *pTaskLoop) noexcept {
+                m_pTaskLoop = pTaskLoop;
+            }
+
+            void setContinuation(std::coroutine_handle<> continuation, TaskLoop *pTaskLoop) noexcept {
+                m_continuation = continuation;
+                m_pTaskLoop    = pTaskLoop;
+            }
+
+            void detach(TaskLoop &taskLoop) noexcept {
+                m_pTaskLoop = &taskLoop;
+                m_bDetached = true;
+            }
+
+        protected:
+            void rethrowException() const {
+                if (m_pException != nullptr) {
+                    std::rethrow_exception(m_pException);
+                }
+            }
+
+        private:
+            std::coroutine_handle<> onFinalSuspend(std::coroutine_handle<> handle) noexcept {
+                if (m_continuation) {
+                    return m_continuation;
+                }
+
+                if (m_bDetached) {
+                    if (m_pException != nullptr) {
+                        // the exception of a spawned coroutine is thrown by a task of its loop (RuntimeErrorException management)
+                        m_pTaskLoop->post([pException = m_pException]() { std::rethrow_exception(pException); });
+                    }
+                    handle.destroy();
+                }
+
+                return std::noop_coroutine();
+            }
+
+            TaskLoop *m_pTaskLoop = nullptr;
+            std::coroutine_handle<> m_continuation;
+            std::exception_ptr m_pException;
+            bool m_bDetached = false;
+        };
+
+        /*
+         * \class CoPromise
+         */
+        template <typename T>
+        class CoPromise final : public CoPromiseBase {
+        public:
+            CoTask<T> get_return_object() noexcept {
+                return CoTask<T>(std::coroutine_handle<CoPromise>::from_promise(*this));
+            }
+
+            template <typename TValue>
+            void return_value(TValue &&value) {
+                m_value.emplace(std::forward<TValue>(value));
+            }
+
+            T getResult() {
+                rethrowException();
+                return std::move(*m_value);
+            }
+
+        private:
+            std::optional<T> m_value;
+        };
+
+        template <>
+        class CoPromise<void> final : public CoPromiseBase {
+        public:
+            CoTask<void> get_return_object() noexcept {
+                return CoTask<void>(std::coroutine_handle<CoPromise>::from_promise(*this));
+            }
+
+            void return_void() noexcept {
+            }
+
+            void getResult() {
+                rethrowException();
+            }
+        };
+
+        template <typename TPromise>
+        TaskLoop *getTaskLoop(std::coroutine_handle<TPromise> handle) {
+            if constexpr (std::is_base_of_v<CoPromiseBase, TPromise>) {
+                return handle.promise().getTaskLoop();
+            } else {
+                return nullptr;
+            }
+        }
+    } // namespace internal
+
+    /*
+     * \class CoTask
+     */
+    template <typename T>
+    CoTask<T>::CoTask(Handle handle) noexcept : m_handle(handle) {
+    }
+
+    template <typename T>
+    CoTask<T>::CoTask(CoTask &&other) noexcept : m_handle(other.release()) {
+    }
+
+    template <typename T>
+    CoTask<T> &CoTask<T>::operator=(CoTask &&other) noexcept {
+        if (this != &other) {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+            m_handle = other.release();
+        }
+        return *this;
+    }
+
+    template <typename T>
+    CoTask<T>::~CoTask() {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    template <typename T>
+    bool CoTask<T>::isDone() const noexcept {
+        return !m_handle || m_handle.done();
+    }
+
+    template <typename T>
+    typename CoTask<T>::Awaiter CoTask<T>::operator co_await() &&noexcept {
+        return Awaiter(m_handle);
+    }
+
+    template <typename T>
+    typename CoTask<T>::Handle CoTask<T>::release() noexcept {
+        return std::exchange(m_handle, nullptr);
+    }
+
+    /*
+     * \class CoTask::Awaiter
+     */
+    template <typename T>
+    CoTask<T>::Awaiter::Awaiter(Handle handle) noexcept : m_handle(handle) {
+    }
+
+    template <typename T>
+    bool CoTask<T>::Awaiter::await_ready() const noexcept {
+        return m_handle.done();
+    }
+
+    template <typename T>
+    template <typename TPromise>
+    std::coroutine_handle<> CoTask<T>::Awaiter::await_suspend(std::coroutine_handle<TPromise> continuation) noexcept {
+        // the awaited coroutine runs on the loop of the awaiting one, then resumes it
+        m_handle.promise().setContinuation(continuation, internal::getTaskLoop(continuation));
+        return m_handle;
+    }
+
+    template <typename T>
+    T CoTask<T>::Awaiter::await_resume() {
+        return m_handle.promise().getResult();
+    }
+
+    /*
+     * \class ScheduleAwaiter
+     */
+    inline ScheduleAwaiter::ScheduleAwaiter(
+        TaskLoop &taskLoop, const TaskAttributes &attributes, const std::chrono::milliseconds &delay)
+        : m_taskLoop(taskLoop), m_attributes(attributes), m_delay(delay) {
+    }
+
+    inline bool ScheduleAwaiter::await_ready() const noexcept {
+        return false;
+    }
+
+    template <typename TPromise>
+    void ScheduleAwaiter::await_suspend(std::coroutine_handle<TPromise> handle) {
+        if constexpr (std::is_base_of_v<internal::CoPromiseBase, TPromise>) {
+            handle.promise().setTaskLoop(&m_taskLoop);
+        }
+
+        // the coroutine may be resumed by another thread before returning: the awaiter is not accessed after the push
+        if (m_delay == std::chrono::milliseconds::zero()) {
+            m_taskLoop.post(m_attributes, [handle]() { handle.resume(); });
+        } else {
+            m_taskLoop.pushSingleShot(m_attributes, m_delay, [handle]() { handle.resume(); });
+        }
+    }
+
+    inline void ScheduleAwaiter::await_resume() const noexcept {
+    }
+
+    /*
+     * \class AsyncDataAwaiter
+     */
+    template <typename T, bool Paged>
+    AsyncDataAwaiter<T, Paged>::AsyncDataAwaiter(data::AsyncData<T, Paged> &asyncData) : m_asyncData(asyncData) {
+    }
+
+    template <typename T, bool Paged>
+    bool AsyncDataAwaiter<T, Paged>::await_ready() const noexcept {
+        return false;
+    }
+
+    template <typename T, bool Paged>
+    template <typename TPromise>
+    void AsyncDataAwaiter<T, Paged>::await_suspend(std::coroutine_handle<TPromise> handle) {
+        auto const pTaskLoop = internal::getTaskLoop(handle);
+        m_asyncData.get([pState = m_pState, pTaskLoop, handle](T &&value) {
+            if (pState->bReceived.exchange(true)) {
+                return; // received after the awaited value: ignored until the next awaiting
+            }
+
+            pState->value = std::move(value);
+            if (pTaskLoop != nullptr) {
+                pTaskLoop->post([handle]() { handle.resume(); });
+            } else {
+                handle.resume();
+            }
+        });
+    }
+
+    template <typename T, bool Paged>
+    T AsyncDataAwaiter<T, Paged>::await_resume() {
+        return std::move(*m_pState->value);
+    }
+
+    template <typename T, bool Paged>
+    AsyncDataAwaiter<T, Paged> coGet(data::AsyncData<T, Paged> &asyncData) {
+        return AsyncDataAwaiter<T, Paged>(asyncData);
+    }
+
+    /*
+     * \class TaskLoop
+     */
+    inline ScheduleAwaiter TaskLoop::schedule() {
+        return schedule(TaskAttributes());
+    }
+
+    inline ScheduleAwaiter TaskLoop::schedule(TaskAttributes attributes) {
+        return ScheduleAwaiter(*this, attributes, std::chrono::milliseconds::zero());
+    }
+
+    inline ScheduleAwaiter TaskLoop::sleep(const std::chrono::milliseconds &delay) {
+        return ScheduleAwaiter(*this, TaskAttributes(), delay);
+    }
+
+    template <typename T>
+    void TaskLoop::spawn(CoTask<T> task) {
+        auto const handle = task.release();
+        if (!handle) {
+            return;
+        }
+
+        handle.promise().detach(*this);
+        post([handle]() { handle.resume(); });
+    }
+
+} // namespace NS_OSBASE::application
@@ -0,0 +1,101 @@
+// \file  EventDispatcher.h
+// \brief Declaration of the class EventDispatcher
+
+#pragma once
+#include "osCore/DesignPattern/Singleton.h"
+#include "osData/IMessaging.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief Per-process fan-out of the events received by several subscribers of the same topic
+     *
+     * The messaging (or the local impl, see LocalMessaging) notifies each subscriber of a topic: several stubs of the same service in the
+     * process receive the same payload. The first one decodes it, the others get the same immutable message: a message is decoded once
+     * per event and per type, then shared by the stubs and their observers without copy.\n
+     * A payload is shared if it is equal to the last one decoded for the topic, a local message if it is the same object: equal payloads
+     * give equal messages, the sharing doesn't depend on the order of the subscribers.
+     * \remark The topics are qualified by the broker and the realm (see LocalMessaging::makeUri()). Nothing is kept for a topic with a
+     * single subscriber.
+     * \ingroup PACKAGE_SERVICE
+     */
+    class EventDispatcher : public core::Singleton<EventDispatcher> {
+        friend Singleton<EventDispatcher>;
+
+    public:
+        /**
+         * \brief Counters of the messages returned by the dispatcher
+         */
+        struct Counters {
+            unsigned long long nbDecodes = 0; //!< messages decoded (or converted)
+            unsigned long long nbShares  = 0; //!< messages returned already decoded
+        };
+
+        void subscribe(const std::string &topic);   //!< Add a subscriber of a topic: the messages are shared beyond one
+        void unsubscribe(const std::string &topic); //!< Remove a subscriber of a topic
+
+        /**
+         * \brief Return the message of a payload received on a topic, decoded once for all the subscribers
+         * \tparam TMessage Type of the message
+         * \tparam TDecoder Type of the decoder, returning a TMessage from the payload
+         * \param topic     qualified topic
+         * \param payload   payload received from the messaging
+         * \param decoder   decoder called if the payload has not been decoded yet
+         */
+        template <typename TMessage, typename TDecoder>
+        std::shared_ptr<const TMessage> decode(const std::string &topic, const data::IMessaging::JsonText &payload, TDecoder &&decoder);
+
+        /**
+         * \brief Return the message of an object published in the process, converted once for all the subscribers
+         * \tparam TMessage     Type of the message
+         * \tparam TSource      Type of the published object
+         * \tparam TConverter   Type of the converter, returning a TMessage from the published object
+         * \param topic         qualified topic
+         * \param pSource       object published by the impl
+         * \param converter     converter called if the object has not been converted yet
+         */
+        template <typename TMessage, typename TSource, typename TConverter>
+        std::shared_ptr<const TMessage> convert(
+            const std::string &topic, const std::shared_ptr<const TSource> &pSource, TConverter &&converter);
+
+        Counters getCounters() const; //!< Return the counters (since the start of the process)
+
+    private:
+        struct Decoded {
+            data::IMessaging::JsonText payload;
+            std::shared_ptr<const void> pSource; // kept: its address identifies the object
+            std::shared_ptr<const void> pMessage;
+        };
+
+        struct Topic {
+            size_t nbSubscribers = 0;
+            std::mutex mutex; // the subscribers of an event wait for its decoding
+            std::unordered_map<std::type_index, Decoded> decoded;
+        };
+        using TopicPtr = std::shared_ptr<Topic>;
+
+        EventDispatcher()           = default;
+        ~EventDispatcher() override = default;
+
+        TopicPtr findSharedTopic(const std::string &topic) const; // null if less than two subscribers
+
+        template <typename TMessage, typename TIsDecoded, typename TMake>
+        std::shared_ptr<const TMessage> share(const std::string &topic, TIsDecoded &&isDecoded, TMake &&make);
+
+        mutable std::shared_mutex m_mutex;
+        std::unordered_map<std::string, TopicPtr> m_topics;
+        std::atomic<unsigned long long> m_nbDecodes = 0;
+        std::atomic<unsigned long long> m_nbShares  = 0;
+    };
+
+#define TheEventDispatcher EventDispatcher::getInstance()
+} // namespace NS_OSBASE::application
+
+#include "EventDispatcher.inl"
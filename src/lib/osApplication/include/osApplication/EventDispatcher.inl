@@ -0,0 +1,58 @@
+// \brief Implementation of the class EventDispatcher
+
+#pragma once
+
+namespace NS_OSBASE::application {
+
+    /*
+     * \class EventDispatcher
+     */
+    template <typename TMessage, typename TDecoder>
+    std::shared_ptr<const TMessage> EventDispatcher::decode(
+        const std::string &topic, const data::IMessaging::JsonText &payload, TDecoder &&decoder) {
+        return share<TMessage>(
+            topic,
+            [&payload](const Decoded &decoded) { return decoded.pSource == nullptr && decoded.payload == payload; },
+            [&payload, &decoder](Decoded &decoded) {
+                decoded.payload = payload;
+                decoded.pSource.reset();
+                return std::make_shared<const TMessage>(decoder(payload));
+            });
+    }
+
+    template <typename TMessage, typename TSource, typename TConverter>
+    std::shared_ptr<const TMessage> EventDispatcher::convert(
+        const std::string &topic, const std::shared_ptr<const TSource> &pSource, TConverter &&converter) {
+        return share<TMessage>(
+            topic,
+            [&pSource](const Decoded &decoded) { return decoded.pSource == pSource; },
+            [&pSource, &converter](Decoded &decoded) {
+                decoded.payload.clear();
+                decoded.pSource = pSource;
+                return std::make_shared<const TMessage>(converter(*pSource));
+            });
+    }
+
+    template <typename TMessage, typename TIsDecoded, typename TMake>
+    std::shared_ptr<const TMessage> EventDispatcher::share(const std::string &topic, TIsDecoded &&isDecoded, TMake &&make) {
+        auto const pTopic = findSharedTopic(topic);
+        if (pTopic == nullptr) {
+            ++m_nbDecodes;
+            Decoded decoded;
+            return make(decoded);
+        }
+
+        std::lock_guard lock(pTopic->mutex);
+        auto &decoded = pTopic->decoded[std::type_index(typeid(TMessage))];
+        if (decoded.pMessage != nullptr && isDecoded(decoded)) {
+            ++m_nbShares;
+            return std::static_pointer_cast<const TMessage>(decoded.pMessage);
+        }
+
+        ++m_nbDecodes;
+        decoded.pMessage.reset(); // not shared if the decoding fails
+        auto pMessage    = make(decoded);
+        decoded.pMessage = pMessage;
+        return pMessage;
+    }
+} // namespace NS_OSBASE::application
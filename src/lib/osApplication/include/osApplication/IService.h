@@ -2,8 +2,10 @@
 
 #pragma once
 #include "osCore/DesignPattern/Observer.h"
+#include "osCore/Serialization/JsonSerializer.h"
 #include "osData/IDataExchange.h"
 #include <chrono>
+#include <optional>
 #include <string>
 
 /**
@@ -69,6 +71,40 @@ namespace NS_OSBASE::application {
     };
     using RuntimeErrorMsg = ServiceMsg<RuntimeErrorData>; //!< alias of the message published in case of runtime exception during an RPC
 
+    /**
+     * \brief Base class of the batches of calls of the services (see ServiceBatch)
+     */
+    class IServiceBatch {
+    public:
+        virtual ~IServiceBatch() = default; //!< dtor
+
+        virtual void flush() = 0; //!< Send the queued calls in one invocation
+
+        virtual std::chrono::milliseconds getWindow() const = 0; //!< Return the delay of the sending after the first queued call
+
+        /**
+         * \brief Set the delay of the sending after the first queued call
+         * \param window    delay, 0 to send the calls only by flush()
+         */
+        virtual void setWindow(const std::chrono::milliseconds &window) = 0;
+    };
+
+    /**
+     * \brief Call of a batch sent to the impl of a service
+     */
+    struct ServiceBatchCall {
+        std::string uri;     //!< URI of the call
+        std::string payload; //!< serialized arguments of the call
+    };
+
+    /**
+     * \brief Result of a call of a batch returned by the impl of a service
+     */
+    struct ServiceBatchResult {
+        std::optional<std::string> strError; //!< error of the call, none if succeeded
+        std::string payload;                 //!< serialized return value of the call
+    };
+
     struct ServiceConnectionMsg {
         ServiceConnectionMsg(const bool bConnected);
         bool isConnected() const;
@@ -81,3 +117,9 @@ namespace NS_OSBASE::application {
 } // namespace NS_OSBASE::application
 OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::application::NullMsg);
 OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::application::RuntimeErrorData, strError);
+OS_JSON_SERIALIZE_STRUCT(NS_OSBASE::application::NullMsg);
+OS_JSON_SERIALIZE_STRUCT(NS_OSBASE::application::RuntimeErrorData, strError);
+OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::application::ServiceBatchCall, uri, payload);
+OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::application::ServiceBatchResult, strError, payload);
+OS_JSON_SERIALIZE_STRUCT(NS_OSBASE::application::ServiceBatchCall, uri, payload);
+OS_JSON_SERIALIZE_STRUCT(NS_OSBASE::application::ServiceBatchResult, strError, payload);
@@ -0,0 +1,134 @@
+// \brief Interfaces of the streams of the service processes
+
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \addtogroup PACKAGE_SERVICE
+     * \{
+     */
+
+    /**
+     * \brief Reader of the chunks of a process returning a stream, returned by the stub of the service
+     *
+     * The chunks are received while the impl produces them: the first ones can be read before the last ones are written. The impl
+     * writes at most the window of the process ahead of the reader (flow control), the memory of the stream stays bounded.
+     * \tparam T    Type of the chunks
+     */
+    template <typename T>
+    class IServiceStream {
+    public:
+        class iterator;
+
+        virtual ~IServiceStream() = default; //!< dtor, cancels the stream if not ended
+
+        /**
+         * \brief   Return the next chunk, wait for it if not received yet
+         * \return  none at the end of the stream (or once cancelled)
+         * \throws  ServiceException in case of error of the impl, or if no chunk is received during the call timeout of the stub
+         */
+        virtual std::optional<T> next() = 0;
+
+        virtual void cancel() = 0; //!< Stop the stream: the impl stops writing, next() returns none
+
+        iterator begin(); //!< Return an iterator on the next chunk (see next())
+        iterator end();   //!< Return the iterator of the end of the stream
+    };
+
+    template <typename T>
+    using IServiceStreamPtr = std::shared_ptr<IServiceStream<T>>; //!< alias of a shared pointer to an IServiceStream
+
+    /**
+     * \brief Input iterator on the chunks of a stream, for range-based loops
+     * \tparam T    Type of the chunks
+     */
+    template <typename T>
+    class IServiceStream<T>::iterator {
+    public:
+        using iterator_category = std::input_iterator_tag; //!< \private
+        using value_type        = T;                       //!< \private
+        using difference_type   = std::ptrdiff_t;          //!< \private
+        using pointer           = T *;                     //!< \private
+        using reference         = T &;                     //!< \private
+
+        iterator() = default; //!< end of the stream
+
+        /**
+         * \brief Ctor, reads the next chunk of the stream
+         * \param stream    stream to read
+         */
+        explicit iterator(IServiceStream<T> &stream) : m_pStream(&stream) {
+            ++*this;
+        }
+
+        reference operator*() {
+            return *m_chunk;
+        }
+
+        pointer operator->() {
+            return &*m_chunk;
+        }
+
+        iterator &operator++() {
+            m_chunk = m_pStream->next();
+            if (!m_chunk.has_value()) {
+                m_pStream = nullptr;
+            }
+            return *this;
+        }
+
+        bool operator==(const iterator &other) const {
+            return m_pStream == other.m_pStream;
+        }
+
+        bool operator!=(const iterator &other) const {
+            return !(*this == other);
+        }
+
+    private:
+        IServiceStream<T> *m_pStream = nullptr;
+        std::optional<T> m_chunk;
+    };
+
+    template <typename T>
+    typename IServiceStream<T>::iterator IServiceStream<T>::begin() {
+        return iterator(*this);
+    }
+
+    template <typename T>
+    typename IServiceStream<T>::iterator IServiceStream<T>::end() {
+        return iterator();
+    }
+
+    /**
+     * \brief Writer of the chunks of a process returning a stream, given to the impl of the service
+     *
+     * The stream ends when the method of the impl returns (an exception is returned to the reader once the written chunks are read).
+     * \tparam T    Type of the chunks
+     */
+    template <typename T>
+    class IServiceStreamWriter {
+    public:
+        virtual ~IServiceStreamWriter() = default; //!< dtor
+
+        /**
+         * \brief   Send a chunk, wait for a credit of the reader if the window of the process is full
+         * \return  false if the stream has been cancelled by the reader (or the impl disconnected): the method can return
+         * \throws  ServiceException if no credit is granted by the reader during the stream timeout of the impl
+         */
+        virtual bool write(const T &chunk) = 0;
+
+        virtual bool isCancelled() const = 0; //!< Indicate if the stream has been cancelled by the reader
+    };
+
+    template <typename T>
+    using IServiceStreamWriterPtr = std::shared_ptr<IServiceStreamWriter<T>>; //!< alias of a shared pointer to an IServiceStreamWriter
+
+    /** \} */
+
+} // namespace NS_OSBASE::application
@@ -0,0 +1,104 @@
+// \file  InlineTask.h
+// \brief Declaration of the class InlineTask
+
+#pragma once
+#include "Task.h"
+#include <cstddef>
+#include <memory>
+#include <typeinfo>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief   This class stores a callback with no return and its arguments, without sharing them
+     *
+     * \remark  Contrary to ITask, an InlineTask is a move-only value: it is not allocated through a shared pointer. When the callback and
+     * its arguments fit in the internal buffer (s_bufferSize bytes), they are stored inline and no allocation is done; otherwise they are
+     * stored in a single heap block.
+     * An InlineTask is executed once by its owner and can't be cancelled: it is used by the fire-and-forget pushes (TaskQueue::postTask,
+     * TaskLoop::post).
+     *
+     * \ingroup PACKAGE_TASK
+     */
+    class InlineTask {
+    public:
+        static constexpr std::size_t s_bufferSize = 6 * sizeof(void *); //!< size of the inline storage
+
+        InlineTask() = default; //!< empty task
+        InlineTask(const InlineTask &) = delete;
+        InlineTask(InlineTask &&other) noexcept;
+        ~InlineTask();
+
+        InlineTask &operator=(const InlineTask &) = delete;
+        InlineTask &operator=(InlineTask &&other) noexcept;
+
+        void execute();                        //!< Perform the execution of the task using the arguments stored
+        bool empty() const;                    //!< Indicates if no callback is stored
+        bool isInline() const;                 //!< Indicates if the callback is stored in the internal buffer (no allocation)
+        const std::type_info &getType() const; //!< Type of the stored callback (typeid(void) if empty), used by the diagnostics
+
+    private:
+        template <typename TCallback, typename... TArgs>
+        friend InlineTask makeInlineTask(TCallback &&callback, TArgs &&...args);
+        friend InlineTask makeInlineTask(ITaskPtr pTask);
+
+        struct Operations {
+            void (*execute)(void *pStorage);
+            void (*move)(void *pDestStorage, void *pSrcStorage); // construct the destination and destroy the source
+            void (*destroy)(void *pStorage);
+            const std::type_info &(*getType)(const void *pStorage);
+            bool bInline;
+        };
+
+        template <typename TCallable>
+        static constexpr bool fitsInline();
+
+        template <typename TCallable>
+        static const Operations &getOperations();
+
+        template <typename TCallable, typename... TParams>
+        static InlineTask emplace(TParams &&...params);
+
+        void reset();
+
+        alignas(std::max_align_t) unsigned char m_storage[s_bufferSize];
+        const Operations *m_pOperations = nullptr;
+    };
+
+    /**
+     * \addtogroup PACKAGE_TASK
+     * \{
+     */
+
+    /**
+     * \brief Create an inline task
+     * \param callback  function to call when invoking the <b>execute</b> method
+     * \param args      arguments to pass to the callback
+     */
+    template <typename TCallback, typename... TArgs>
+    InlineTask makeInlineTask(TCallback &&callback, TArgs &&...args);
+
+    /**
+     * \brief Create an inline task executing a shared task
+     * \param pTask     task to execute when invoking the <b>execute</b> method
+     *
+     * \remark  InlineTask::getType() returns the dynamic type of <b>pTask</b>.
+     */
+    InlineTask makeInlineTask(ITaskPtr pTask);
+
+    /**
+     * \brief Create an inline task from a method
+     * \param pInstance     shared pointer on the intance associated to the method
+     * \param mthCallback   method to call when invoking the <b>execute</b> method
+     * \param args          arguments to pass to the callback
+     *
+     * \remark  As makeMethodTask(), the task stores the weak pointer of <b>pInstance</b>: the method is invoked only if <b>pInstance</b> is
+     * not expired.
+     */
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    InlineTask makeInlineMethodTask(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
+    /**\}*/
+
+} // namespace NS_OSBASE::application
+
+#include "InlineTask.inl"
@@ -0,0 +1,115 @@
+// \file  InlineTask.inl
+// \brief Implementation of the class InlineTask
+
+#pragma once
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+namespace NS_OSBASE::application {
+
+    namespace internal {
+
+        ////////////////////////////////////////////////////////////////////////
+        // Callback and arguments stored by an InlineTask
+        template <typename TCallback, typename... TArgs>
+        struct InlineCallable {
+            void operator()() {
+                std::apply(callback, args);
+            }
+
+            const std::type_info &getType() const {
+                return typeid(TCallback);
+            }
+
+            TCallback callback;
+            std::tuple<TArgs...> args;
+        };
+        ////////////////////////////////////////////////////////////////////////
+
+        ////////////////////////////////////////////////////////////////////////
+        // Shared task stored by an InlineTask
+        struct SharedTaskCallable {
+            void operator()() {
+                pTask->execute();
+            }
+
+            const std::type_info &getType() const {
+                return typeid(*pTask);
+            }
+
+            ITaskPtr pTask;
+        };
+        ////////////////////////////////////////////////////////////////////////
+
+    } // namespace internal
+
+    /*
+     * \class InlineTask
+     */
+    template <typename TCallable>
+    constexpr bool InlineTask::fitsInline() {
+        return sizeof(TCallable) <= s_bufferSize && alignof(TCallable) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<TCallable>;
+    }
+
+    template <typename TCallable>
+    const InlineTask::Operations &InlineTask::getOperations() {
+        if constexpr (fitsInline<TCallable>()) {
+            static const Operations operations{ [](void *pStorage) { (*static_cast<TCallable *>(pStorage))(); },
+                [](void *pDestStorage, void *pSrcStorage) {
+                    auto const pSrcCallable = static_cast<TCallable *>(pSrcStorage);
+                    new (pDestStorage) TCallable(std::move(*pSrcCallable));
+                    pSrcCallable->~TCallable();
+                },
+                [](void *pStorage) { static_cast<TCallable *>(pStorage)->~TCallable(); },
+                [](const void *pStorage) -> const std::type_info & { return static_cast<const TCallable *>(pStorage)->getType(); },
+                true };
+            return operations;
+        } else {
+            static const Operations operations{ [](void *pStorage) { (**static_cast<TCallable **>(pStorage))(); },
+                [](void *pDestStorage, void *pSrcStorage) { new (pDestStorage) TCallable *(*static_cast<TCallable **>(pSrcStorage)); },
+                [](void *pStorage) { delete *static_cast<TCallable **>(pStorage); },
+                [](const void *pStorage) -> const std::type_info & { return (*static_cast<TCallable *const *>(pStorage))->getType(); },
+                false };
+            return operations;
+        }
+    }
+
+    template <typename TCallable, typename... TParams>
+    InlineTask InlineTask::emplace(TParams &&...params) {
+        InlineTask task;
+        if constexpr (fitsInline<TCallable>()) {
+            new (task.m_storage) TCallable{ std::forward<TParams>(params)... };
+        } else {
+            new (task.m_storage) TCallable *(new TCallable{ std::forward<TParams>(params)... });
+        }
+
+        task.m_pOperations = &getOperations<TCallable>();
+        return task;
+    }
+
+    // maker
+    template <typename TCallback, typename... TArgs>
+    InlineTask makeInlineTask(TCallback &&callback, TArgs &&...args) {
+        using TFunction = typename internal::function_traits<std::decay_t<TCallback>>::type;
+        static_assert(internal::is_all_args_passed_by_value<TFunction>::value, TASK_ASSERT_VALUE);
+
+        using TCallable = internal::InlineCallable<std::decay_t<TCallback>, std::decay_t<TArgs>...>;
+        return InlineTask::emplace<TCallable>(
+            std::forward<TCallback>(callback), std::tuple<std::decay_t<TArgs>...>(std::forward<TArgs>(args)...));
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    InlineTask makeInlineMethodTask(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
+        using TFunction = typename internal::function_traits<std::decay_t<TMthCallback>>::type;
+        static_assert(internal::is_all_args_passed_by_value<TFunction>::value, TASK_ASSERT_VALUE);
+
+        return makeInlineTask([pWInstance = std::weak_ptr<TInstance>(pInstance), mthCallback, args...]() {
+            if (auto const pLockedInstance = pWInstance.lock(); pLockedInstance != nullptr) {
+                (pLockedInstance.get()->*mthCallback)(args...);
+            }
+        });
+    }
+
+} // namespace NS_OSBASE::application
@@ -0,0 +1,151 @@
+// \brief Declaration of the class LocalMessaging
+
+#pragma once
+#include "osCore/DesignPattern/Singleton.h"
+#include "osData/IMessaging.h"
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief Typed result of a call dispatched in the process (see LocalMessaging)
+     * \tparam TRet Type of the return value
+     * \ingroup PACKAGE_SERVICE
+     */
+    template <typename TRet>
+    class ILocalResult {
+    public:
+        using value_type = std::conditional_t<std::is_void_v<TRet>, std::tuple<>, TRet>; //!< returned value, empty if void
+
+        virtual ~ILocalResult() = default;
+
+        virtual void yield(value_type &&value)      = 0; //!< Return the result of the call
+        virtual void fail(const std::string &error) = 0; //!< Return an error to the caller
+    };
+
+    /**
+     * \brief Typed entry of a supplier delegate, called without serialization by the stubs of the process (see LocalMessaging)
+     * \tparam TRet     Type of the return value
+     * \tparam TArgs    Tuple of the arguments (std::tuple<> if none)
+     * \ingroup PACKAGE_SERVICE
+     */
+    template <typename TRet, typename TArgs>
+    class ILocalCall {
+    public:
+        virtual ~ILocalCall() = default;
+
+        /**
+         * \brief Call the registered method
+         * \remark The method is executed as a call received from the messaging (see ServiceImpl::registerCall), the result is returned
+         * by pResult, from any thread.
+         * \param args      copy of the arguments of the caller
+         * \param pResult   interface returning the result of the call
+         */
+        virtual void onLocalCall(TArgs &&args, std::shared_ptr<ILocalResult<TRet>> pResult) = 0;
+    };
+
+    /**
+     * \brief Subscriber of the events published in the process (see LocalMessaging)
+     * \ingroup PACKAGE_SERVICE
+     */
+    class ILocalSubscriber {
+    public:
+        virtual ~ILocalSubscriber(); //!< Dtor
+
+        /**
+         * \brief Function called when an event of an unexpected type is published: the message is then serialized
+         * \param payload   serialized message
+         */
+        virtual void onLocalPayload(const data::IMessaging::JsonText &payload) = 0;
+    };
+    using ILocalSubscriberPtr  = std::shared_ptr<ILocalSubscriber>; //!< alias of shared pointer to ILocalSubscriber
+    using ILocalSubscriberWPtr = std::weak_ptr<ILocalSubscriber>;   //!< alias of weak pointer to ILocalSubscriber
+
+    /**
+     * \brief Typed subscriber of the events published in the process, notified without serialization (see LocalMessaging)
+     * \tparam TMessage Type of the message
+     * \ingroup PACKAGE_SERVICE
+     */
+    template <typename TMessage>
+    class ILocalEvent : public ILocalSubscriber {
+    public:
+        /**
+         * \brief Function called when the message is published
+         * \param pMessage  message, shared by all the subscribers of the topic
+         */
+        virtual void onLocalEvent(const std::shared_ptr<const TMessage> &pMessage) = 0;
+    };
+
+    /**
+     * \brief In-process transport between the stubs and the impls of the same process
+     *
+     * The impls register here their methods and their connection, the stubs their subscriptions. When both sides of a service live in
+     * the same process (same broker and realm), the stubs call the supplier delegates directly and the impls notify directly the
+     * subscribers: the arguments and results are copied, the messages shared by the subscribers, nothing is serialized and nothing goes
+     * through the broker.\n
+     * The calls are executed as the ones received from the messaging (thread of the call, lane of the loop or pool of the calls, see
+     * ServiceImpl::registerCall), the exceptions are returned as errors (ServiceException thrown by the stub). The events published by a
+     * local impl and received from the broker are ignored by the local stubs (already notified).
+     * \remark The uris are qualified by the broker and the realm (see makeUri()).
+     * \ingroup PACKAGE_SERVICE
+     */
+    class LocalMessaging : public core::Singleton<LocalMessaging> {
+        friend Singleton<LocalMessaging>;
+
+    public:
+        bool isEnabled() const;               //!< Indicate if the stubs and impls of the process use the local transport (default)
+        void setEnabled(const bool bEnabled); //!< Enable or disable the local transport (to set before the connection of the services)
+
+        /**
+         * \brief Return the uri identifying a call, a topic or a service in the process
+         * \param brokerUri Uri of the broker
+         * \param realm     Realm of the service
+         * \param uri       Uri of the call, topic or service
+         */
+        static std::string makeUri(const data::Uri &brokerUri, const std::string &realm, const std::string &uri);
+
+        void registerService(const std::string &uri);           //!< Register a connected impl: its events are published in the process
+        void unregisterService(const std::string &uri);         //!< Unregister an impl (disconnected)
+        bool isServiceRegistered(const std::string &uri) const; //!< Indicate if an impl of the service is connected in the process
+
+        void registerCall(const std::string &uri, data::IMessaging::ISupplierDelegatePtr pDelegate);   //!< Register a method of an impl
+        void unregisterCall(const std::string &uri, data::IMessaging::ISupplierDelegatePtr pDelegate); //!< Unregister a method
+
+        /**
+         * \brief Return the supplier delegate of a call registered in the process
+         * \return null if not registered
+         */
+        data::IMessaging::ISupplierDelegatePtr findCall(const std::string &uri) const;
+
+        void subscribe(const std::string &topic, ILocalSubscriberPtr pSubscriber);   //!< Subscribe to a topic published in the process
+        void unsubscribe(const std::string &topic, ILocalSubscriberPtr pSubscriber); //!< Unsubscribe to a topic
+
+        std::vector<ILocalSubscriberPtr> getSubscribers(const std::string &topic) const; //!< Return the subscribers of a topic
+
+        /**
+         * \brief Return an ICallResult forwarding the result of a call to the delegates of the caller
+         * \remark As the messaging, an error is returned if the interface is released without answer.
+         */
+        static data::IMessaging::ICallResultPtr makeCallResult(
+            data::IMessaging::IClientDelegatePtr pClientDelegate, data::IMessaging::IErrorDelegatePtr pErrorDelegate);
+
+    private:
+        LocalMessaging()           = default;
+        ~LocalMessaging() override = default;
+
+        mutable std::shared_mutex m_mutex;
+        std::unordered_map<std::string, size_t> m_services;
+        std::unordered_map<std::string, data::IMessaging::ISupplierDelegateWPtr> m_calls;
+        std::unordered_map<std::string, std::vector<ILocalSubscriberWPtr>> m_subscribers;
+        std::atomic_bool m_bEnabled = true;
+    };
+
+#define TheLocalMessaging LocalMessaging::getInstance()
+} // namespace NS_OSBASE::application
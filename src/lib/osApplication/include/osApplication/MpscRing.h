@@ -0,0 +1,50 @@
+// \file  MpscRing.h
+// \brief Declaration of the class MpscRing
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief   This class is a bounded lock-free queue with multiple producers and a single consumer
+     *
+     * \remark  The producers reserve a cell with a CAS on the push position, then publish the value with the sequence of the cell: no
+     * lock is taken and no allocation is done. The consumer side (tryPop) must be serialized by the owner of the ring.
+     * A value being published by a producer blocks the next pops until it is published (the ring appears empty).
+     *
+     * \tparam  T           type of the values (default constructible and movable)
+     * \tparam  Capacity    number of cells, power of 2
+     *
+     * \ingroup PACKAGE_TASK
+     */
+    template <typename T, std::size_t Capacity>
+    class MpscRing {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "The capacity must be a power of 2");
+
+    public:
+        MpscRing();
+
+        bool tryPush(T &&value); //!< Push the value if a cell is free, return false if the ring is full (the value is not moved)
+        bool tryPop(T &value);   //!< Pop the oldest published value, return false if none (consumer only)
+        bool empty() const;      //!< Indicates if no published value is pending (consumer only)
+
+    private:
+        struct Cell {
+            std::atomic_size_t sequence;
+            T value;
+        };
+
+        static constexpr std::size_t s_cacheLineSize = 64;
+
+        std::array<Cell, Capacity> m_cells;
+        alignas(s_cacheLineSize) std::atomic_size_t m_pushPosition = 0;
+        alignas(s_cacheLineSize) std::size_t m_popPosition         = 0;
+    };
+
+} // namespace NS_OSBASE::application
+
+#include "MpscRing.inl"
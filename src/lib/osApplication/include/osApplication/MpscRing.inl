@@ -0,0 +1,66 @@
+// \file  MpscRing.inl
+// \brief Implementation of the class MpscRing
+
+#pragma once
+
+namespace NS_OSBASE::application {
+
+    /*
+     * \class MpscRing
+     */
+    template <typename T, std::size_t Capacity>
+    MpscRing<T, Capacity>::MpscRing() {
+        for (std::size_t index = 0; index < Capacity; ++index) {
+            m_cells[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename T, std::size_t Capacity>
+    bool MpscRing<T, Capacity>::tryPush(T &&value) {
+        auto position = m_pushPosition.load(std::memory_order_relaxed);
+        Cell *pCell   = nullptr;
+
+        while (true) {
+            pCell               = &m_cells[position & (Capacity - 1)];
+            auto const sequence = pCell->sequence.load(std::memory_order_acquire);
+            auto const diff     = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+            if (diff == 0) {
+                // free cell: reserve it
+                if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the cell still contains a value not popped: full
+                return false;
+            } else {
+                position = m_pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        pCell->value = std::move(value);
+        pCell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, std::size_t Capacity>
+    bool MpscRing<T, Capacity>::tryPop(T &value) {
+        auto &cell = m_cells[m_popPosition & (Capacity - 1)];
+        if (cell.sequence.load(std::memory_order_acquire) != m_popPosition + 1) {
+            return false;
+        }
+
+        value      = std::move(cell.value);
+        cell.value = T();
+        cell.sequence.store(m_popPosition + Capacity, std::memory_order_release);
+        ++m_popPosition;
+        return true;
+    }
+
+    template <typename T, std::size_t Capacity>
+    bool MpscRing<T, Capacity>::empty() const {
+        auto const &cell = m_cells[m_popPosition & (Capacity - 1)];
+        return cell.sequence.load(std::memory_order_acquire) != m_popPosition + 1;
+    }
+
+} // namespace NS_OSBASE::application
@@ -2,8 +2,12 @@
 
 #pragma once
 //#include "IService.h"
+#include "IServiceStream.h"
+#include "LocalMessaging.h"
+#include "ServiceEncoding.h"
 #include "TaskLoop.h"
 #include "osData/IMessaging.h"
+#include <atomic>
 #include <type_traits>
 
 namespace NS_OSBASE::application {
@@ -22,19 +26,47 @@ namespace NS_OSBASE::application {
 
         TaskLoopPtr getTaskLoop() const; //!< Return the associated task loop
 
+        ServiceEncoding getEncoding() const; //!< Return the encoding requested for the payloads (json by default)
+
+        /**
+         * \brief  Assign the encoding requested for the payloads, to set before the connection (yaml tag service/encoding)
+         * \remark The encoding is used if both the stub and the impl support it (negotiated on the connection), json otherwise
+         * \param  encoding    requested encoding
+         */
+        void setEncoding(const ServiceEncoding encoding);
+
+        ServiceEncoding getWireEncoding() const; //!< Return the encoding of the payloads sent on the messaging (negotiated)
+
+        /**
+         * \brief Bound the number of pending tasks of the loop of the service (ex: events of a fast publisher)
+         * \param capacity    maximal number of pending tasks, 0 for unbounded (default)
+         * \param policy      behavior of a push when the loop is full, the events are keyed by topic (OverflowPolicy::coalesce)
+         */
+        void setTaskCapacity(const size_t capacity, const TaskQueue::OverflowPolicy policy);
+        TaskQueue::OverflowCounters getTaskOverflowCounters() const; //!< Return the counters of the overflows of the loop of the service
+
     protected:
-        struct ReadyMsg : ServiceMsg<unsigned int> {}; //!< Message sent when the service finish its connection
-        struct AliveMsg : ServiceMsg<unsigned int> {}; //!< Message priodically sent when the service is alive
+        struct ReadyMsg : ServiceMsg<unsigned int> {};      //!< Message sent when the service finish its connection
+        struct AliveMsg : ServiceMsg<unsigned int> {};      //!< Message priodically sent when the service is alive
+        struct CacheInvalidateMsg : ServiceMsg<NullMsg> {}; //!< Message sent when the results of a const process change (see ServiceCache)
 
-        explicit ServiceBase(
-            const std::string &serviceName, const data::Uri &uri, const std::string &realm, TaskLoopPtr pTaskLoop); //!< Ctor
+        explicit ServiceBase(const std::string &serviceName,
+            const data::Uri &uri,
+            const std::string &realm,
+            TaskLoopPtr pTaskLoop); //!< Ctor - pTaskLoop can be a TaskLoop or a strand of a TaskLoopPool
 
         data::IMessagingPtr getMessaging() const;                //!< Return the Messaging class
         const std::chrono::milliseconds &getCallTimeout() const; //!< Return the timeout of any RPC invoke
         std::string makeFullUri(const std::string &uri) const;   //!< Return the full uri (used fro RPC & PubSub uris)
+        std::string makeLocalUri(const std::string &uri) const;  //!< Return the uri in the process of a full uri (see LocalMessaging)
+        const std::string &getServiceName() const;               //!< Return the name of the service
+
+        std::string makeInvalidateTopic(const std::string &processName) const; //!< Return the topic of the invalidation of a process
+        std::string makeStreamTopic(const std::string &streamId) const;        //!< Return the topic of the chunks of a stream
 
         const data::Uri &getBrokerUri() const;
         const std::string &getRealm() const;
+        void setWireEncoding(const ServiceEncoding encoding);
 
         virtual void doConnect();    //!< Method template called by connect() and performs
                                      //!< extra works needed after the connection
@@ -51,6 +83,12 @@ namespace NS_OSBASE::application {
         inline static const std::string s_serviceNotifyReadyTopic  = "notify.ready";     //!< \private
         inline static const std::string s_serviceNotifyAliveTopic  = "notify.alive";     //!< \private
         inline static const std::string s_serviceGetAlivePeriodUri = "get.alive.period"; //!< \private
+        inline static const std::string s_serviceGetEncodingUri    = "get.encoding";     //!< \private
+        inline static const std::string s_serviceCallBatchUri      = "call.batch";       //!< \private
+        inline static const std::string s_serviceInvalidateTopic   = "invalidate";       //!< \private
+        inline static const std::string s_serviceStreamTopic       = "stream";           //!< \private
+        inline static const std::string s_serviceStreamCreditUri   = "stream.credit";    //!< \private
+        inline static const std::string s_serviceStreamCancelUri   = "stream.cancel";    //!< \private
 
     private:
         class MessagingConnectionObserver;
@@ -63,6 +101,9 @@ namespace NS_OSBASE::application {
         std::string m_serviceName;
         data::Uri m_brokerUri;
         std::string m_realm;
+        std::string m_localUriPrefix;
+        ServiceEncoding m_encoding                  = ServiceEncoding::json;
+        std::atomic<ServiceEncoding> m_wireEncoding = ServiceEncoding::json;
     };
 } // namespace NS_OSBASE::application
 
@@ -33,7 +33,8 @@ namespace NS_OSBASE::application {
           m_pMessagingConnectionObserver(std::make_shared<MessagingConnectionObserver>(*this)),
           m_serviceName(serviceName),
           m_brokerUri(uri),
-          m_realm(realm) {
+          m_realm(realm),
+          m_localUriPrefix(LocalMessaging::makeUri(uri, realm, "")) {
     }
 
     template <class TService>
@@ -76,6 +77,36 @@ namespace NS_OSBASE::application {
         return m_pTaskLoop;
     }
 
+    template <class TService>
+    ServiceEncoding ServiceBase<TService>::getEncoding() const {
+        return m_encoding;
+    }
+
+    template <class TService>
+    void ServiceBase<TService>::setEncoding(const ServiceEncoding encoding) {
+        m_encoding = encoding;
+    }
+
+    template <class TService>
+    ServiceEncoding ServiceBase<TService>::getWireEncoding() const {
+        return m_wireEncoding;
+    }
+
+    template <class TService>
+    void ServiceBase<TService>::setWireEncoding(const ServiceEncoding encoding) {
+        m_wireEncoding = encoding;
+    }
+
+    template <class TService>
+    void ServiceBase<TService>::setTaskCapacity(const size_t capacity, const TaskQueue::OverflowPolicy policy) {
+        m_pTaskLoop->setCapacity(capacity, policy);
+    }
+
+    template <class TService>
+    TaskQueue::OverflowCounters ServiceBase<TService>::getTaskOverflowCounters() const {
+        return m_pTaskLoop->getOverflowCounters();
+    }
+
     template <class TService>
     data::IMessagingPtr ServiceBase<TService>::getMessaging() const {
         return m_pMessaging;
@@ -91,6 +122,26 @@ namespace NS_OSBASE::application {
         return m_serviceName + "." + uri;
     }
 
+    template <class TService>
+    std::string ServiceBase<TService>::makeLocalUri(const std::string &uri) const {
+        return m_localUriPrefix + uri;
+    }
+
+    template <class TService>
+    std::string ServiceBase<TService>::makeInvalidateTopic(const std::string &processName) const {
+        return makeFullUri(s_serviceInvalidateTopic + "." + processName);
+    }
+
+    template <class TService>
+    std::string ServiceBase<TService>::makeStreamTopic(const std::string &streamId) const {
+        return makeFullUri(s_serviceStreamTopic + "." + streamId);
+    }
+
+    template <class TService>
+    const std::string &ServiceBase<TService>::getServiceName() const {
+        return m_serviceName;
+    }
+
     template <class TService>
     const data::Uri &ServiceBase<TService>::getBrokerUri() const {
         return m_brokerUri;
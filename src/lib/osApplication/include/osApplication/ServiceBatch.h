@@ -0,0 +1,71 @@
+/// \brief Batch of the calls of a service stub
+
+#pragma once
+#include "ServiceStub.h"
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief Base implementation of the batches of the calls of the service stubs
+     *
+     * The calls are queued and sent to the impl in one invocation, when the window has elapsed since the first queued call (or on
+     * flush()). The impl executes them in order and returns their results, each one resolving the future of its call.\n
+     * Without window, the calls are sent only by flush() or by the destructor. As the calls of the stub, the results of a sent batch
+     * fail with "invoke timeout!" if they are not received within the call timeout of the stub.
+     * \tparam TService Interface of the service
+     * \tparam TBatch   Interface of the batch of the service (generated)
+     * \ingroup PACKAGE_SERVICE
+     */
+    template <typename TService, typename TBatch>
+    class ServiceBatch : public TBatch {
+    public:
+        ~ServiceBatch() override; //!< dtor, sends the queued calls
+
+        void flush() override final;
+        std::chrono::milliseconds getWindow() const override final;
+        void setWindow(const std::chrono::milliseconds &window) override final;
+
+    protected:
+        /**
+         * \brief Ctor
+         * \param pService  Stub of the service
+         * \param window    Delay of the sending after the first queued call, 0 to send the calls only by flush()
+         * \throws          ServiceException if the service is not a stub
+         */
+        ServiceBatch(std::shared_ptr<TService> pService, const std::chrono::milliseconds &window);
+
+        /**
+         * \brief Queue a call of the service process related to the URI
+         * \tparam TRet     Type of the return value
+         * \tparam TArgs    Types of the arguments
+         * \param uri       URI of the call
+         * \param args      Arguments of the invocation
+         * \return          The future result of the invocation, throwing ServiceException in case of messaging or execution error
+         */
+        template <typename TRet, typename... TArgs>
+        std::future<TRet> invoke(const std::string &uri, TArgs &&...args);
+
+    private:
+        class IPendingResult;
+        using IPendingResultPtr = std::shared_ptr<IPendingResult>;
+
+        template <typename TRet>
+        class PendingResult;
+
+        class ResultDelegate;
+        using ResultDelegatePtr = std::shared_ptr<ResultDelegate>;
+
+        class Queue;
+        using QueuePtr = std::shared_ptr<Queue>;
+
+        QueuePtr m_pQueue; // shared with the task of the window
+    };
+} // namespace NS_OSBASE::application
+
+#include "ServiceBatch.inl"
@@ -0,0 +1,253 @@
+/// \brief Implementation of the batches of the calls of the service stubs
+
+#pragma once
+#include "ServiceException.h"
+
+namespace NS_OSBASE::application {
+
+    /*
+     * \class ServiceBatch::IPendingResult
+     */
+    template <typename TService, typename TBatch>
+    class ServiceBatch<TService, TBatch>::IPendingResult {
+    public:
+        virtual ~IPendingResult() = default;
+
+        virtual void yield(const std::string &payload) = 0;
+        virtual void fail(const std::string &error)    = 0;
+    };
+
+    /*
+     * \class ServiceBatch::PendingResult
+     */
+    template <typename TService, typename TBatch>
+    template <typename TRet>
+    class ServiceBatch<TService, TBatch>::PendingResult : public IPendingResult {
+    public:
+        void yield(const std::string &payload) override {
+            if constexpr (std::is_void_v<TRet>) {
+                m_result.set_value();
+            } else {
+                m_result.set_value(deserializePayload(payload, TRet{}));
+            }
+        }
+
+        void fail(const std::string &error) override {
+            m_result.set_exception(std::make_exception_ptr(ServiceException(error)));
+        }
+
+        auto getFutureResult() {
+            return m_result.get_future();
+        }
+
+    private:
+        std::promise<TRet> m_result;
+    };
+
+    /*
+     * \class ServiceBatch::ResultDelegate
+     */
+    template <typename TService, typename TBatch>
+    class ServiceBatch<TService, TBatch>::ResultDelegate : public data::IMessaging::IClientDelegate,
+                                                           public data::IMessaging::IErrorDelegate,
+                                                           public ILocalResult<std::vector<ServiceBatchResult>>,
+                                                           public std::enable_shared_from_this<ResultDelegate> {
+    public:
+        ResultDelegate(QueuePtr pQueue, std::vector<IPendingResultPtr> &&pResults)
+            : m_pQueue(std::move(pQueue)), m_pResults(std::move(pResults)) {
+        }
+
+        void onResult(const std::string &json) override {
+            yield(deserializePayload(json, std::vector<ServiceBatchResult>{}));
+        }
+
+        void yield(std::vector<ServiceBatchResult> &&results) override {
+            if (!complete()) {
+                return;
+            }
+
+            for (size_t index = 0; index < m_pResults.size(); ++index) {
+                if (index >= results.size()) {
+                    m_pResults[index]->fail("no result returned by the batch");
+                } else if (results[index].strError) {
+                    m_pResults[index]->fail(*results[index].strError);
+                } else {
+                    m_pResults[index]->yield(results[index].payload);
+                }
+            }
+            m_pQueue->removeDelegate(this->shared_from_this());
+        }
+
+        void fail(const std::string &error) override {
+            onError(error);
+        }
+
+        void onError(const std::string &error) override {
+            if (complete()) {
+                failResults(error);
+            }
+        }
+
+        // the results are failed if they are not received before the timeout (call timeout of the stub)
+        void armTimeout(TaskLoop &taskLoop, const std::chrono::milliseconds &timeout) {
+            if (timeout == std::chrono::milliseconds::max()) {
+                return;
+            }
+
+            m_pTaskTimeout = taskLoop.pushSingleShot(timeout, [pWDelegate = this->weak_from_this()]() {
+                if (auto const pDelegate = pWDelegate.lock(); pDelegate != nullptr && !pDelegate->m_bCompleted.exchange(true)) {
+                    pDelegate->failResults("invoke timeout!");
+                }
+            });
+        }
+
+    private:
+        bool complete() { // true for the first answer only: the result or the error, unless the timeout has fired
+            if (m_bCompleted.exchange(true)) {
+                return false;
+            }
+
+            if (m_pTaskTimeout != nullptr) {
+                m_pTaskTimeout->setEnabled(false);
+            }
+            return true;
+        }
+
+        void failResults(const std::string &error) {
+            for (auto const &pResult : m_pResults) {
+                pResult->fail(error);
+            }
+            m_pQueue->removeDelegate(this->shared_from_this());
+        }
+
+        QueuePtr m_pQueue; // kept until the results are received, the error or the timeout, even if the batch is destroyed
+        std::vector<IPendingResultPtr> m_pResults;
+        ITaskPtr m_pTaskTimeout; // armed before the invocation
+        std::atomic_bool m_bCompleted = false;
+    };
+
+    /*
+     * \class ServiceBatch::Queue
+     */
+    template <typename TService, typename TBatch>
+    class ServiceBatch<TService, TBatch>::Queue : public std::enable_shared_from_this<Queue> {
+    public:
+        Queue(std::shared_ptr<ServiceStub<TService>> pStub, const std::chrono::milliseconds &window)
+            : m_pStub(std::move(pStub)), m_window(window) {
+        }
+
+        std::chrono::milliseconds getWindow() const {
+            std::lock_guard lock(m_mutex);
+            return m_window;
+        }
+
+        void setWindow(const std::chrono::milliseconds &window) {
+            std::lock_guard lock(m_mutex);
+            m_window = window;
+        }
+
+        template <typename TRet, typename... TArgs>
+        std::future<TRet> push(const std::string &uri, TArgs &&...args) {
+            auto const pResult = std::make_shared<PendingResult<TRet>>();
+            auto futResult     = pResult->getFutureResult();
+            auto payload       = serializePayload(m_pStub->getWireEncoding(), std::make_tuple(std::forward<TArgs>(args)...));
+
+            std::lock_guard lock(m_mutex);
+            m_calls.push_back({ uri, std::move(payload) });
+            m_pResults.push_back(pResult);
+            if (m_calls.size() == 1 && m_window.count() != 0) {
+                m_pTaskWindow = m_pStub->getTaskLoop()->pushSingleShot(m_window, [pWQueue = this->weak_from_this()]() {
+                    if (auto const pQueue = pWQueue.lock(); pQueue != nullptr) {
+                        pQueue->flush();
+                    }
+                });
+            }
+            return futResult;
+        }
+
+        void flush() {
+            std::vector<ServiceBatchCall> calls;
+            std::vector<IPendingResultPtr> pResults;
+            {
+                std::lock_guard lock(m_mutex);
+                if (m_pTaskWindow != nullptr) {
+                    m_pTaskWindow->setEnabled(false);
+                    m_pTaskWindow.reset();
+                }
+
+                if (m_calls.empty()) {
+                    return;
+                }
+                calls.swap(m_calls);
+                pResults.swap(m_pResults);
+            }
+
+            auto const pDelegate = std::make_shared<ResultDelegate>(this->shared_from_this(), std::move(pResults));
+            {
+                std::lock_guard lock(m_mutex);
+                m_pDelegates.insert(pDelegate);
+            }
+
+            try {
+                pDelegate->armTimeout(*m_pStub->getTaskLoop(), m_pStub->getCallTimeout());
+                auto const uri = m_pStub->makeFullUri(ServiceStub<TService>::s_serviceCallBatchUri);
+                m_pStub->template dispatchInvocation<std::vector<ServiceBatchResult>>(pDelegate, uri, std::move(calls));
+            } catch (const std::exception &e) {
+                pDelegate->onError(e.what());
+            }
+        }
+
+        void removeDelegate(const ResultDelegatePtr &pDelegate) {
+            std::lock_guard lock(m_mutex);
+            m_pDelegates.erase(pDelegate);
+        }
+
+    private:
+        std::shared_ptr<ServiceStub<TService>> m_pStub;
+        std::chrono::milliseconds m_window;
+        std::vector<ServiceBatchCall> m_calls;
+        std::vector<IPendingResultPtr> m_pResults; // one per call
+        std::set<ResultDelegatePtr> m_pDelegates;  // sent batches waiting for their results
+        ITaskPtr m_pTaskWindow;
+        mutable std::mutex m_mutex;
+    };
+
+    /*
+     * \class ServiceBatch
+     */
+    template <typename TService, typename TBatch>
+    ServiceBatch<TService, TBatch>::ServiceBatch(std::shared_ptr<TService> pService, const std::chrono::milliseconds &window) {
+        auto pStub = std::dynamic_pointer_cast<ServiceStub<TService>>(pService);
+        if (pStub == nullptr) {
+            throw ServiceException("a batch requires the stub of the service!");
+        }
+
+        m_pQueue = std::make_shared<Queue>(std::move(pStub), window);
+    }
+
+    template <typename TService, typename TBatch>
+    ServiceBatch<TService, TBatch>::~ServiceBatch() {
+        m_pQueue->flush();
+    }
+
+    template <typename TService, typename TBatch>
+    void ServiceBatch<TService, TBatch>::flush() {
+        m_pQueue->flush();
+    }
+
+    template <typename TService, typename TBatch>
+    std::chrono::milliseconds ServiceBatch<TService, TBatch>::getWindow() const {
+        return m_pQueue->getWindow();
+    }
+
+    template <typename TService, typename TBatch>
+    void ServiceBatch<TService, TBatch>::setWindow(const std::chrono::milliseconds &window) {
+        m_pQueue->setWindow(window);
+    }
+
+    template <typename TService, typename TBatch>
+    template <typename TRet, typename... TArgs>
+    std::future<TRet> ServiceBatch<TService, TBatch>::invoke(const std::string &uri, TArgs &&...args) {
+        return m_pQueue->template push<TRet>(uri, std::forward<TArgs>(args)...);
+    }
+} // namespace NS_OSBASE::application
@@ -0,0 +1,96 @@
+// \file  ServiceCache.h
+// \brief Declaration of the class ServiceCache
+
+#pragma once
+#include <any>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief   Cache of the results of a const process of a service stub, keyed by the serialized arguments
+     *
+     * \remark  The least recently used result is evicted when the capacity is reached, a result is evicted when it is found expired. A
+     * result returned by a call started before the last clear() is not stored: the impl may have invalidated it meanwhile (see
+     * getGeneration()).
+     *
+     * \ingroup PACKAGE_SERVICE
+     */
+    class ServiceCache {
+    public:
+        /**
+         * \brief Bounds of a ServiceCache
+         */
+        struct Options {
+            std::chrono::milliseconds ttl = std::chrono::milliseconds(0); //!< lifetime of a result, 0 for unlimited
+            std::size_t capacity          = 0;                            //!< maximal number of results, 0 for unbounded
+        };
+
+        /**
+         * \brief Counters of a ServiceCache
+         */
+        struct Counters {
+            std::uint64_t nbHits          = 0; //!< number of results found
+            std::uint64_t nbMisses        = 0; //!< number of results not found (or expired)
+            std::uint64_t nbEvictions     = 0; //!< number of results removed by the capacity or the lifetime
+            std::uint64_t nbInvalidations = 0; //!< number of clears (invalidations of the impl, reconnections)
+
+            Counters &operator+=(const Counters &other); //!< Add the counters of another cache
+        };
+
+        explicit ServiceCache(const Options &options);
+
+        const Options &getOptions() const; //!< Return the bounds of the cache
+
+        /**
+         * \brief   Return the result stored for the key
+         * \param   key     serialized arguments of the call
+         * \return  none if not found or expired
+         */
+        std::optional<std::any> find(const std::string &key);
+
+        std::uint64_t getGeneration() const; //!< Return the number of clears, to read before the call of a result to store
+
+        /**
+         * \brief   Store the result of a call
+         * \param   key         serialized arguments of the call
+         * \param   value       result of the call
+         * \param   generation  generation read before the call: the result is not stored if the cache has been cleared meanwhile
+         */
+        void insert(const std::string &key, std::any &&value, const std::uint64_t generation);
+
+        void clear(); //!< Remove all the results
+
+        std::size_t getSize() const;   //!< Return the number of stored results
+        Counters getCounters() const; //!< Return the counters of the cache
+
+    private:
+        using clock = std::chrono::steady_clock;
+
+        struct Entry {
+            std::string key;
+            std::any value;
+            clock::time_point expiration;
+        };
+        using Entries = std::list<Entry>;
+
+        void evict(Entries::iterator itEntry);
+
+        const Options m_options;
+        Entries m_entries; // the most recently used first
+        std::unordered_map<std::string, Entries::iterator> m_entryIndexes;
+        std::uint64_t m_generation = 0;
+        Counters m_counters;
+        mutable std::mutex m_mutex;
+    };
+
+    using ServiceCachePtr = std::shared_ptr<ServiceCache>; //!< alias of a shared pointer to a ServiceCache
+} // namespace NS_OSBASE::application
@@ -0,0 +1,76 @@
+// \file  ServiceEncoding.h
+// \brief Declaration of the wire encodings of the services
+
+#pragma once
+#include "osCore/Serialization/JsonSerializer.h"
+#include "osCore/Serialization/KeyStream.h"
+#include <optional>
+#include <string>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief   Encoding of the arguments, results and messages of a service on the messaging
+     * \remark  A msgpack payload is sent as a text: '\0' followed by the base64 of the MessagePack buffer (convention of WAMP for
+     * the binaries with a text serializer), 4/3 of the buffer: see the sizes reported by the benchmark Service_RPC_BM/encodePayload.
+     * A payload is decoded according to its first character, whatever the expected encoding.
+     * \ingroup PACKAGE_SERVICE
+     */
+    enum class ServiceEncoding {
+        json,   //!< json text (default, understood by all the services)
+        msgpack //!< MessagePack binary, without text conversion of the numbers
+    };
+
+    std::string getEncodingName(const ServiceEncoding encoding);                 //!< Return the name of the encoding (yaml name)
+    std::optional<ServiceEncoding> findEncoding(const std::string &encodingName); //!< Return the encoding of the name, none if unknown
+    bool isEncodingAvailable(const ServiceEncoding encoding); //!< Indicate if the key-stream family of the encoding is linked
+
+    /**
+     * \brief   Create an empty key-stream to serialize a payload
+     * \param   encoding    encoding of the payload
+     * \return  the key-stream
+     */
+    core::KeyStreamPtr<std::string> makeServiceStream(const ServiceEncoding encoding);
+
+    /**
+     * \brief   Create the key-stream deserializing a payload
+     * \param   payload     payload received from the messaging
+     * \return  the key-stream
+     */
+    core::KeyStreamPtr<std::string> makeServiceStream(const std::string &payload);
+
+    /**
+     * \brief   Return the encoding of a payload received from the messaging
+     */
+    ServiceEncoding getPayloadEncoding(const std::string &payload);
+
+    /**
+     * \brief   Return the payload sent on the messaging
+     * \param   encoding    encoding of the key-stream
+     * \param   keyStream   key-stream created by makeServiceStream(encoding)
+     * \return  the payload
+     */
+    std::string makePayload(const ServiceEncoding encoding, const core::KeyStream<std::string> &keyStream);
+
+    /**
+     * \brief   Return the payload of a value sent on the messaging
+     * \param   encoding    encoding of the payload
+     * \param   value       value to serialize
+     * \remark  The json payload of a value having a direct json serializer is written directly, the key-stream otherwise
+     */
+    template <typename TValue>
+    std::string serializePayload(const ServiceEncoding encoding, const TValue &value);
+
+    /**
+     * \brief   Return the value of a payload received from the messaging
+     * \param   payload         payload received
+     * \param   defaultValue    value returned in case of failure
+     * \remark  The json payload of a value having a direct json serializer is read directly, the key-stream otherwise (or if the
+     * direct read fails)
+     */
+    template <typename TValue>
+    TValue deserializePayload(const std::string &payload, const TValue &defaultValue);
+
+} // namespace NS_OSBASE::application
+
+#include "ServiceEncoding.inl"
@@ -0,0 +1,35 @@
+// \file  ServiceEncoding.inl
+// \brief Implementation of the wire encodings of the services
+
+#pragma once
+
+namespace NS_OSBASE::application {
+
+    template <typename TValue>
+    std::string serializePayload(const ServiceEncoding encoding, const TValue &value) {
+        if constexpr (core::is_json_serializable_v<TValue>) {
+            if (encoding == ServiceEncoding::json) {
+                return core::toJson(value);
+            }
+        }
+
+        auto const pKeyStream = makeServiceStream(encoding);
+        pKeyStream->setValue(value);
+        return makePayload(encoding, *pKeyStream);
+    }
+
+    template <typename TValue>
+    TValue deserializePayload(const std::string &payload, const TValue &defaultValue) {
+        if constexpr (core::is_json_serializable_v<TValue>) {
+            if (getPayloadEncoding(payload) == ServiceEncoding::json) {
+                auto value = defaultValue;
+                if (core::fromJson(payload, value)) {
+                    return value;
+                }
+            }
+        }
+
+        return makeServiceStream(payload)->getValue(defaultValue);
+    }
+
+} // namespace NS_OSBASE::application
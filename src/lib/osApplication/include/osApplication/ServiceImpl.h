@@ -1,7 +1,13 @@
 /// \brief Implementation of a service
 
 #pragma once
+#include "CallDispatcher.h"
 #include "ServiceBase.h"
+#include "TaskLoopPool.h"
+#include <algorithm>
+#include <condition_variable>
+#include <thread>
+#include <vector>
 
 namespace NS_OSBASE::application {
 
@@ -23,22 +29,102 @@ namespace NS_OSBASE::application {
         unsigned long long getAlivePeriod() const override final; //!< period of alive message in ms
         void setAlivePeriod(const unsigned long long period);
 
+        TaskPriority getAlivePriority() const;               //!< lane of the loop publishing the alive messages
+        void setAlivePriority(const TaskPriority priority); //!< assign the lane of the alive messages (applied on the next resume)
+
+        /**
+         * \brief  Return the lane of the loop executing the registered methods
+         * \return none if the methods are executed by the thread of the messaging (default)
+         */
+        std::optional<TaskPriority> getCallPriority() const;
+
+        /**
+         * \brief  Assign the lane of the loop executing the registered methods, to set before the connection
+         * \remark The calling thread of the messaging waits for the execution by the loop (executed by the calling thread if the loop
+         * doesn't run): the methods of the service must not be called synchronously from the loop of the service.
+         * \param  priority    lane of the calls, none to execute them by the thread of the messaging
+         */
+        void setCallPriority(const std::optional<TaskPriority> &priority);
+
+        /**
+         * \brief  Return the pool executing the methods registered with a concurrency
+         * \return null if no pool has been assigned nor created yet
+         */
+        TaskLoopPoolPtr getCallPool() const;
+
+        /**
+         * \brief  Assign the pool executing the methods registered with a concurrency, to set before the connection
+         * \remark If no pool is assigned, the pool shared by the process is used from the first registration with a concurrency (see
+         * TaskLoopPool::getShared()): the services of the process share its workers.
+         * \param  pPool       pool of the calls
+         */
+        void setCallPool(TaskLoopPoolPtr pPool);
+
+        const std::chrono::milliseconds &getStreamTimeout() const; //!< Return the maximal wait of a credit by the writer of a stream
+
+        /**
+         * \brief  Assign the maximal wait of a credit of the reader by the writer of a stream (1 minute by default)
+         * \remark On timeout, the writer throws a ServiceException: the reader stalled or vanished without cancelling the stream.
+         * \param  timeout     maximal wait, std::chrono::milliseconds::max() for none
+         */
+        void setStreamTimeout(const std::chrono::milliseconds &timeout);
+
     protected:
-        ServiceImpl(const std::string &serviceName, const data::Uri &uri, const std::string &realm); //!< Ctor
+        /**
+         * \brief Ctor
+         * \param serviceName   Name of the service
+         * \param uri           Uri of the broker
+         * \param realm         Realm of the service
+         * \param pTaskLoop     Loop (or strand of a TaskLoopPool) executing the tasks of the service, a new TaskLoop if null
+         */
+        ServiceImpl(const std::string &serviceName, const data::Uri &uri, const std::string &realm, TaskLoopPtr pTaskLoop = nullptr);
 
         void doRegister() override;
         void doUnregister() override;
 
         /**
          * \brief Register a method
+         * \remark With a concurrency, the calls are executed by the pool of the calls (see CallDispatcher): the thread of the messaging
+         * is not blocked and the result is returned when the method ends. Otherwise the calls are executed by the thread of the messaging
+         * (or the loop of the service, see setCallPriority()), one at a time for all the methods.\n
+         * The method is also registered in the process: the stubs of the process call it directly (see LocalMessaging), by their calling
+         * thread if it is executed by the thread of the messaging.\n
+         * The calls queued by a batch (see ServiceBatch) are executed in order, each one with the concurrency of its method.
          * \tparam TClass           Type of the class
          * \tparam TMethodCallback  Type of the method to call
          * \param uri               URI associated to the method
          * \param pInstance         Instance of the class implementing the method
          * \param methodCallback    Address of the method to call
+         * \param concurrency       Maximal number of concurrent calls of the method (1: serialized), 0 for none (default)
          */
         template <typename TClass, typename TMethodCallback>
-        void registerCall(const std::string &uri, TClass *pInstance, TMethodCallback &&methodCallback);
+        void registerCall(const std::string &uri, TClass *pInstance, TMethodCallback &&methodCallback, const size_t concurrency = 0);
+
+        /**
+         * \brief Register a method writing a stream (see ServiceStub::invokeStream())
+         * \remark The method is called with the writer of the chunks, the stream ends when it returns. The writer waits for the credits of
+         * the reader: the calls are always executed by the pool of the calls (see registerCall()), not to block the thread of the
+         * messaging receiving the credits. A running stream keeps its worker: the streams beyond the concurrency wait for the end of a
+         * running one. The default concurrency is small: the slow readers don't hold all the workers of the pool.
+         * \tparam TClass           Type of the class
+         * \tparam T                Type of the chunks
+         * \tparam TArgs            Types of the arguments of the method
+         * \param uri               URI associated to the method
+         * \param pInstance         Instance of the class implementing the method
+         * \param streamCallback    Address of the method to call
+         * \param concurrency       Maximal number of concurrent calls of the method, 0 for 2 (default)
+         */
+        template <typename TClass, typename T, typename... TArgs>
+        void registerStream(const std::string &uri,
+            TClass *pInstance,
+            void (TClass::*streamCallback)(IServiceStreamWriterPtr<T>, TArgs...),
+            const size_t concurrency = 0);
+
+        template <typename TClass, typename T, typename... TArgs>
+        void registerStream(const std::string &uri,
+            TClass *pInstance,
+            void (TClass::*streamCallback)(IServiceStreamWriterPtr<T>, TArgs...) const,
+            const size_t concurrency = 0); //!< \copydoc ServiceImpl::registerStream()
 
         /**
          * \brief Unregister a method
@@ -55,6 +141,12 @@ namespace NS_OSBASE::application {
         template <typename TMessage>
         void publish(const std::string &topic, const TMessage &message) const;
 
+        /**
+         * \brief Invalidate the results of a const process cached by the stubs (see ServiceStub::setCache())
+         * \param processName   Name of the process
+         */
+        void invalidateCache(const std::string &processName) const;
+
         void onMessagingConnection(const bool bConnected) override;
 
     private:
@@ -65,22 +157,65 @@ namespace NS_OSBASE::application {
 
         class PublishError;
 
+        class Stream;
+        using StreamPtr = std::shared_ptr<Stream>;
+
+        template <typename T>
+        class StreamWriter;
+
+        class IStreamCall;
+        using IStreamCallPtr = std::shared_ptr<IStreamCall>;
+
+        template <typename TClass, typename TStreamCallback, typename T, typename... TArgs>
+        class StreamCall;
+
+        template <typename T, typename... TArgs, typename TClass, typename TStreamCallback>
+        void registerStreamCall(const std::string &uri, TClass *pInstance, TStreamCallback streamCallback, const size_t concurrency);
+
         template <typename TMessage>
         void publishMessage(const std::string &topic, const TMessage &message) const;
 
+        template <typename TMessage>
+        void publishLocalMessage(const std::string &topic, const TMessage &message, const std::string &payload) const;
+
+        std::string getWireEncodingName() const; // negotiation: encoding of the payloads published and accepted by the stubs
+        std::vector<ServiceBatchResult> invokeBatch(std::vector<ServiceBatchCall> calls); // calls queued by a ServiceBatch, in order
+        void grantStreamCredits(std::string streamId, unsigned long long credits); // chunks read by the reader of a stream
+        void cancelStream(std::string streamId);                                   // stream cancelled by its reader
+        void cancelStreams();
+        void setLocalRegistration(const bool bRegistered); // in-process stubs (see LocalMessaging)
+        void clearSupplierDelegates();
         void publishReadyMessage() const;
         void publishAliveMessage(const std::chrono::milliseconds &alivePeriod) const;
 
+        void beginCall() const;
+        void endCall() const;
+        bool isBusy() const; // calls in progress, none ended during the last alive period
+
         void suspendAliveNotification() const;
         void resumeAliveNotification() const;
         void resetAliveNotification() const;
 
+        static constexpr size_t s_streamConcurrency = 2; // concurrent calls of a stream by default
+
+        TaskLoopPoolPtr m_pCallPool;                                    // before the delegates: outlives their dispatchers
+        std::unordered_map<std::string, IStreamCallPtr> m_pStreamCalls; // by uri, before the delegates: used by their running calls
+        std::unordered_map<std::string, StreamPtr> m_pStreams;          // running streams, by id
+        std::chrono::milliseconds m_streamTimeout = std::chrono::minutes(1);
+        mutable std::mutex m_mutexStreams;
+        mutable std::mutex m_mutexSupplierDelegates; // the delegates are registered, cleared and found by several threads
         std::unordered_map<std::string, data::IMessaging::ISupplierDelegatePtr> m_pSupplierDelegates;
         data::IMessaging::IErrorDelegatePtr m_pPublishErrorDelegate;
         std::chrono::milliseconds m_alivePeriod = std::chrono::milliseconds(1000);
+        TaskPriority m_alivePriority            = TaskPriority::normal;
+        std::optional<TaskPriority> m_callPriority;
         mutable ITaskPtr m_pTaskAlive;
         mutable std::mutex m_mutexAlive;
-        mutable size_t m_refCall = 0;
+        mutable std::recursive_mutex m_mutexCall; // calls executed by the calling thread: one at a time, as the thread of the messaging
+        std::atomic_bool m_bLocalRegistered                               = false;
+        mutable size_t m_refCall                                          = 0;
+        mutable std::atomic_size_t m_nbRunningCalls                       = 0;
+        mutable std::atomic<std::chrono::steady_clock::rep> m_lastCallEnd = 0;
     };
 } // namespace NS_OSBASE::application
 
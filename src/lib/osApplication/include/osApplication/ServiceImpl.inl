@@ -33,75 +33,228 @@ namespace NS_OSBASE::application {
             using arg_type    = void;
             using return_type = TRet;
         };
+
+        template <typename TArgs>
+        using local_args_t = std::conditional_t<std::is_void_v<TArgs>, std::tuple<>, TArgs>; // arguments of the local calls
     } // namespace internal
 
     /*
      * \class ServiceImpl::SupplierDelegate
      */
     template <typename TService>
-    class ServiceImpl<TService>::SupplierDelegate : public data::IMessaging::ISupplierDelegate, public data::IMessaging::IErrorDelegate {};
+    class ServiceImpl<TService>::SupplierDelegate : public data::IMessaging::ISupplierDelegate, public data::IMessaging::IErrorDelegate {
+    public:
+        virtual std::string invoke(const data::IMessaging::JsonText &jsonArgs) = 0;        // executed by the calling thread
+        virtual std::string invokeBatched(const data::IMessaging::JsonText &jsonArgs) = 0; // call of a batch (see invokeBatch)
+    };
 
     /*
      * \class ServiceImpl::SupplierDelegate
      */
     template <typename TService>
     template <typename TClass, typename TMethodCallback>
-    class ServiceImpl<TService>::TSupplierDelegate : public SupplierDelegate {
+    class ServiceImpl<TService>::TSupplierDelegate
+        : public SupplierDelegate,
+          public ILocalCall<typename internal::deduce_tuple_from_callback<TMethodCallback>::return_type,
+              internal::local_args_t<typename internal::deduce_tuple_from_callback<TMethodCallback>::arg_type>>,
+          public std::enable_shared_from_this<TSupplierDelegate<TClass, TMethodCallback>> {
 
-        using arg_type    = typename internal::deduce_tuple_from_callback<TMethodCallback>::arg_type;
-        using return_type = typename internal::deduce_tuple_from_callback<TMethodCallback>::return_type;
+        using arg_type       = typename internal::deduce_tuple_from_callback<TMethodCallback>::arg_type;
+        using return_type    = typename internal::deduce_tuple_from_callback<TMethodCallback>::return_type;
+        using local_arg_type = internal::local_args_t<arg_type>;
 
     public:
-        TSupplierDelegate(ServiceImpl &serviceImpl, TClass *pInstance, TMethodCallback mth)
+        TSupplierDelegate(ServiceImpl &serviceImpl, TClass *pInstance, TMethodCallback mth, const size_t concurrency)
             : m_service(serviceImpl), m_pInstance(pInstance), m_mth(mth) {
+            if (concurrency != 0) {
+                if (m_service.m_pCallPool == nullptr) {
+                    m_service.m_pCallPool = TaskLoopPool::getShared();
+                }
+                m_pDispatcher = std::make_unique<CallDispatcher>(m_service.m_pCallPool, concurrency);
+            }
+        }
+
+        void onCallAsync(const data::IMessaging::JsonText &jsonArgs, data::IMessaging::ICallResultPtr pResult) override {
+            if (m_pDispatcher == nullptr) {
+                SupplierDelegate::onCallAsync(jsonArgs, pResult);
+                return;
+            }
+
+            m_pDispatcher->dispatch(makeInlineTask([this, jsonArgs, pResult]() {
+                try {
+                    pResult->yield(invoke(jsonArgs));
+                } catch (const std::exception &e) {
+                    pResult->fail(e.what());
+                }
+            }));
         }
 
         std::string onCall(const data::IMessaging::JsonText &jsonArgs) override {
-            try {
-                return oscheck::throwIfCrashOrReturn<std::string>([&jsonArgs, mth = m_mth, pInstance = m_pInstance, this]() {
-                    auto const guard = core::make_scope_exit([this]() { m_service.resumeAliveNotification(); });
-                    m_service.suspendAliveNotification();
+            auto const callPriority = m_service.getCallPriority();
+            auto const pTaskLoop    = m_service.getTaskLoop();
+            if (!callPriority.has_value() || !pTaskLoop->isRunning()) {
+                const std::lock_guard lock(m_service.m_mutexCall);
+                return invoke(jsonArgs);
+            }
+
+            // executed by the loop in the lane of the calls, or here if the loop stops before (the first one taking the call)
+            // the posted task owns the call: if the loop rejects or drops it (capacity), the promise is broken
+            auto pCall        = std::make_shared<std::packaged_task<std::string()>>([this, jsonArgs]() { return invoke(jsonArgs); });
+            auto const pTaken = std::make_shared<std::atomic_bool>(false);
+            auto result       = pCall->get_future();
+            pTaskLoop->post({ *callPriority }, [pCall = std::move(pCall), pTaken]() {
+                if (!pTaken->exchange(true)) {
+                    (*pCall)();
+                }
+            });
+
+            // the loop is held by this call (or the ones before): its alive task is late, the stubs are told here that a call is
+            // in progress before they time out
+            auto const posted      = std::chrono::steady_clock::now();
+            auto const alivePeriod = m_service.m_alivePeriod;
+            auto const pollPeriod  = std::max(std::min(s_callPollingPeriod, alivePeriod / 4), std::chrono::milliseconds(1));
+            auto bAliveSuspended   = false;
+            while (result.wait_for(pollPeriod) == std::future_status::timeout) {
+                if (!pTaskLoop->isRunning() && !pTaken->exchange(true)) {
+                    return invoke(jsonArgs);
+                }
+
+                if (!bAliveSuspended && std::chrono::steady_clock::now() - posted >= alivePeriod / 2) {
                     m_service.publishAliveMessage(std::chrono::milliseconds(0));
-                    auto const pResultKeyStream = core::makeJsonStream();
-                    std::ostringstream oss;
-
-                    if constexpr (std::is_void_v<arg_type>) {
-                        if constexpr (std::is_void_v<return_type>) {
-                            std::apply(mth, std::make_tuple(pInstance));
-                        } else {
-                            return_type result = std::apply(mth, std::make_tuple(pInstance));
-                            pResultKeyStream->setValue(result);
-                        }
-                    } else {
-                        auto const pKeyStream = core::makeJsonStream(std::istringstream(jsonArgs));
-                        auto value            = pKeyStream->getValue(arg_type{});
-
-                        if constexpr (std::is_void_v<return_type>) {
-                            std::apply(mth, std::tuple_cat(std::make_tuple(pInstance), std::move(value)));
-                        } else {
-                            return_type result = std::apply(mth, std::tuple_cat(std::make_tuple(pInstance), std::move(value)));
-                            pResultKeyStream->setValue(result);
-                        }
-                    }
+                    bAliveSuspended = true;
+                }
+            }
 
-                    oss << *pResultKeyStream;
-                    return oss.str();
-                });
-            } catch (const core::RuntimeException &e) {
-                m_service.publish(m_service.makeFullUri(m_service.s_serviceRuntimeErrorTopic), RuntimeErrorData{ e.what() });
-                throw e;
+            try {
+                return result.get();
+            } catch (const std::future_error &) {
+                // the task is destroyed without being executed
+                if (!pTaskLoop->isRunning() && !pTaken->exchange(true)) {
+                    return invoke(jsonArgs);
+                }
+                throw ServiceException(s_rejectedCallError);
+            }
+        }
+
+        void onLocalCall(local_arg_type &&args, std::shared_ptr<ILocalResult<return_type>> pResult) override {
+            // same threads as the calls of the messaging, except that the caller doesn't wait for the pool or the loop
+            if (m_pDispatcher != nullptr) {
+                m_pDispatcher->dispatch(makeInlineTask(LocalCall(this->shared_from_this(), std::move(args), std::move(pResult))));
+                return;
             }
-            return {};
+
+            auto const callPriority = m_service.getCallPriority();
+            auto const pTaskLoop    = m_service.getTaskLoop();
+            if (callPriority.has_value() && pTaskLoop->isRunning()) {
+                pTaskLoop->post({ *callPriority }, LocalCall(this->shared_from_this(), std::move(args), std::move(pResult)));
+                return;
+            }
+
+            const std::lock_guard lock(m_service.m_mutexCall);
+            invokeLocal(std::move(args), *pResult);
         }
 
         void onError(const std::string &error) override {
             m_service.getTaskLoop()->pushImmediate([error]() { throw ServiceException(error); });
         }
 
+        std::string invokeBatched(const data::IMessaging::JsonText &jsonArgs) override {
+            if (m_pDispatcher == nullptr) {
+                // the batch is a call of the messaging: serialized with the other calls of the service
+                const std::lock_guard lock(m_service.m_mutexCall);
+                return invoke(jsonArgs);
+            }
+
+            // executed by a strand of the dispatcher, with the concurrency of the method, the batch waits for it
+            auto pCall  = std::make_shared<std::packaged_task<std::string()>>([this, jsonArgs]() { return invoke(jsonArgs); });
+            auto result = pCall->get_future();
+            m_pDispatcher->dispatch(makeInlineTask([pCall = std::move(pCall)]() { (*pCall)(); }));
+            try {
+                return result.get();
+            } catch (const std::future_error &) {
+                throw ServiceException(s_rejectedCallError); // the dispatcher is destroyed before executing the call
+            }
+        }
+
+        std::string invoke(const data::IMessaging::JsonText &jsonArgs) override {
+            auto const encoding = getPayloadEncoding(jsonArgs); // replies in the encoding of the caller
+            local_arg_type args;
+            if constexpr (!std::is_void_v<arg_type>) {
+                args = deserializePayload(jsonArgs, arg_type{});
+            }
+
+            if constexpr (std::is_void_v<return_type>) {
+                call(std::move(args));
+                return makePayload(encoding, *makeServiceStream(encoding));
+            } else {
+                return serializePayload(encoding, call(std::move(args)));
+            }
+        }
+
     private:
+        static constexpr std::chrono::milliseconds s_callPollingPeriod = std::chrono::milliseconds(100);
+        static constexpr const char *s_rejectedCallError = "call not executed by the loop of the service (rejected, dropped or stopped)";
+
+        // local call given to the loop or to the dispatcher: failed if destroyed without being executed
+        class LocalCall {
+        public:
+            LocalCall(
+                std::shared_ptr<TSupplierDelegate> pDelegate, local_arg_type &&args, std::shared_ptr<ILocalResult<return_type>> pResult)
+                : m_pDelegate(std::move(pDelegate)), m_args(std::move(args)), m_pResult(std::move(pResult)) {
+            }
+
+            LocalCall(LocalCall &&) = default;
+            LocalCall &operator=(LocalCall &&) = delete;
+
+            ~LocalCall() {
+                if (m_pResult != nullptr) {
+                    m_pResult->fail(s_rejectedCallError);
+                }
+            }
+
+            void operator()() {
+                auto const pResult = std::move(m_pResult);
+                m_pDelegate->invokeLocal(std::move(m_args), *pResult);
+            }
+
+        private:
+            std::shared_ptr<TSupplierDelegate> m_pDelegate;
+            local_arg_type m_args;
+            std::shared_ptr<ILocalResult<return_type>> m_pResult;
+        };
+
+        void invokeLocal(local_arg_type &&args, ILocalResult<return_type> &result) {
+            try {
+                if constexpr (std::is_void_v<return_type>) {
+                    call(std::move(args));
+                    result.yield({});
+                } else {
+                    result.yield(call(std::move(args)));
+                }
+            } catch (const std::exception &e) {
+                result.fail(e.what());
+            } catch (...) {
+                result.fail("unknown exception");
+            }
+        }
+
+        return_type call(local_arg_type &&args) {
+            try {
+                return oscheck::throwIfCrashOrReturn<return_type>([&args, mth = m_mth, pInstance = m_pInstance, this]() {
+                    auto const guard = core::make_scope_exit([this]() { m_service.endCall(); });
+                    m_service.beginCall();
+                    return std::apply(mth, std::tuple_cat(std::make_tuple(pInstance), std::move(args)));
+                });
+            } catch (const core::RuntimeException &e) {
+                m_service.publish(m_service.makeFullUri(m_service.s_serviceRuntimeErrorTopic), RuntimeErrorData{ e.what() });
+                throw e;
+            }
+        }
+
         ServiceImpl &m_service;
         TClass *m_pInstance;
         TMethodCallback m_mth;
+        std::unique_ptr<CallDispatcher> m_pDispatcher; // last member: waits for the running calls first
     };
 
     /*
@@ -121,12 +274,150 @@ namespace NS_OSBASE::application {
         ServiceImpl &m_serviceImpl;
     };
 
+    /*
+     * \class ServiceImpl::Stream
+     */
+    template <typename TService>
+    class ServiceImpl<TService>::Stream {
+    public:
+        explicit Stream(const unsigned long long credits) : m_credits(credits) {
+        }
+
+        virtual ~Stream() = default;
+
+        void grant(const unsigned long long credits) {
+            {
+                std::lock_guard lock(m_mutex);
+                m_credits += credits;
+            }
+            m_cvCredits.notify_all();
+        }
+
+        void cancel() {
+            {
+                std::lock_guard lock(m_mutex);
+                m_bCancelled = true;
+            }
+            m_cvCredits.notify_all();
+        }
+
+        bool isCancelled() const {
+            std::lock_guard lock(m_mutex);
+            return m_bCancelled;
+        }
+
+    protected:
+        bool acquire(const std::chrono::milliseconds &timeout) {
+            std::unique_lock lock(m_mutex);
+            auto const isAvailable = [this]() { return m_credits != 0 || m_bCancelled; };
+            if (timeout == std::chrono::milliseconds::max()) {
+                m_cvCredits.wait(lock, isAvailable);
+            } else if (!m_cvCredits.wait_for(lock, timeout, isAvailable)) {
+                throw ServiceException("stream timeout: no credit granted by the reader!");
+            }
+
+            if (m_bCancelled) {
+                return false;
+            }
+
+            --m_credits;
+            return true;
+        }
+
+    private:
+        unsigned long long m_credits; // number of chunks the reader accepts
+        bool m_bCancelled = false;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_cvCredits;
+    };
+
+    /*
+     * \class ServiceImpl::StreamWriter
+     */
+    template <typename TService>
+    template <typename T>
+    class ServiceImpl<TService>::StreamWriter : public Stream, public IServiceStreamWriter<T> {
+    public:
+        StreamWriter(const ServiceImpl &serviceImpl, const std::string &topic, const unsigned long long credits)
+            : Stream(credits), m_serviceImpl(serviceImpl), m_topic(topic) {
+        }
+
+        bool write(const T &chunk) override {
+            if (!this->acquire(m_serviceImpl.getStreamTimeout())) {
+                return false;
+            }
+
+            m_serviceImpl.publish(m_topic, chunk);
+            ++m_nbChunks;
+            return true;
+        }
+
+        bool isCancelled() const override {
+            return Stream::isCancelled();
+        }
+
+        unsigned long long getNbChunks() const {
+            return m_nbChunks;
+        }
+
+    private:
+        const ServiceImpl &m_serviceImpl;
+        const std::string m_topic;
+        std::atomic<unsigned long long> m_nbChunks = 0;
+    };
+
+    /*
+     * \class ServiceImpl::IStreamCall
+     */
+    template <typename TService>
+    class ServiceImpl<TService>::IStreamCall {
+    public:
+        virtual ~IStreamCall() = default;
+    };
+
+    /*
+     * \class ServiceImpl::StreamCall
+     */
+    template <typename TService>
+    template <typename TClass, typename TStreamCallback, typename T, typename... TArgs>
+    class ServiceImpl<TService>::StreamCall : public IStreamCall {
+    public:
+        StreamCall(ServiceImpl &serviceImpl, TClass *pInstance, TStreamCallback streamCallback)
+            : m_serviceImpl(serviceImpl), m_pInstance(pInstance), m_streamCallback(streamCallback) {
+        }
+
+        // registered method: returns the number of chunks, the reader ends once they are received
+        unsigned long long call(std::string streamId, unsigned long long credits, TArgs... args) {
+            auto const pWriter = std::make_shared<StreamWriter<T>>(m_serviceImpl, m_serviceImpl.makeStreamTopic(streamId), credits);
+            {
+                std::lock_guard lock(m_serviceImpl.m_mutexStreams);
+                if (!m_serviceImpl.m_pStreams.emplace(streamId, pWriter).second) {
+                    throw ServiceException("the stream '" + streamId + "' is already running!");
+                }
+            }
+
+            auto const guard = core::make_scope_exit([this, &streamId, &pWriter]() {
+                pWriter->cancel(); // the writer may be kept by the method: no more chunks
+                std::lock_guard lock(m_serviceImpl.m_mutexStreams);
+                m_serviceImpl.m_pStreams.erase(streamId);
+            });
+            (m_pInstance->*m_streamCallback)(pWriter, std::move(args)...);
+            return pWriter->getNbChunks();
+        }
+
+    private:
+        ServiceImpl &m_serviceImpl;
+        TClass *m_pInstance;
+        TStreamCallback m_streamCallback;
+    };
+
     /*
      * \class ServiceImpl
      */
     template <typename TService>
-    ServiceImpl<TService>::ServiceImpl(const std::string &serviceName, const data::Uri &uri, const std::string &realm)
-        : ServiceBase<TService>(serviceName, uri, realm, std::make_shared<TaskLoop>()) {
+    ServiceImpl<TService>::ServiceImpl(
+        const std::string &serviceName, const data::Uri &uri, const std::string &realm, TaskLoopPtr pTaskLoop)
+        : ServiceBase<TService>(serviceName, uri, realm, pTaskLoop != nullptr ? pTaskLoop : std::make_shared<TaskLoop>()) {
         m_pPublishErrorDelegate = std::make_shared<PublishError>(*this);
     }
 
@@ -145,8 +436,12 @@ namespace NS_OSBASE::application {
 
     template <typename TService>
     void ServiceImpl<TService>::disconnect() {
-        auto const guard = core::make_scope_exit([this]() { m_pSupplierDelegates.clear(); });
+        auto const guard = core::make_scope_exit([this]() {
+            setLocalRegistration(false);
+            clearSupplierDelegates();
+        });
 
+        cancelStreams(); // the writers end their calls
         suspendAliveNotification();
         if (m_pTaskAlive != nullptr) {
             m_pTaskAlive->setEnabled(false);
@@ -180,33 +475,133 @@ namespace NS_OSBASE::application {
         m_alivePeriod = std::chrono::milliseconds(period);
     }
 
+    template <typename TService>
+    TaskPriority ServiceImpl<TService>::getAlivePriority() const {
+        return m_alivePriority;
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::setAlivePriority(const TaskPriority priority) {
+        m_alivePriority = priority;
+    }
+
+    template <typename TService>
+    std::optional<TaskPriority> ServiceImpl<TService>::getCallPriority() const {
+        return m_callPriority;
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::setCallPriority(const std::optional<TaskPriority> &priority) {
+        m_callPriority = priority;
+    }
+
+    template <typename TService>
+    TaskLoopPoolPtr ServiceImpl<TService>::getCallPool() const {
+        return m_pCallPool;
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::setCallPool(TaskLoopPoolPtr pPool) {
+        m_pCallPool = pPool;
+    }
+
+    template <typename TService>
+    const std::chrono::milliseconds &ServiceImpl<TService>::getStreamTimeout() const {
+        return m_streamTimeout;
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::setStreamTimeout(const std::chrono::milliseconds &timeout) {
+        m_streamTimeout = timeout;
+    }
+
     template <typename TService>
     void ServiceImpl<TService>::doRegister() {
+        setWireEncoding(isEncodingAvailable(getEncoding()) ? getEncoding() : ServiceEncoding::json);
+        setLocalRegistration(true);
         registerCall(makeFullUri(s_serviceGetAlivePeriodUri), this, &ServiceImpl<TService>::getAlivePeriod);
+        registerCall(makeFullUri(s_serviceGetEncodingUri), this, &ServiceImpl<TService>::getWireEncodingName);
+        registerCall(makeFullUri(s_serviceCallBatchUri), this, &ServiceImpl<TService>::invokeBatch);
+        registerCall(makeFullUri(s_serviceStreamCreditUri), this, &ServiceImpl<TService>::grantStreamCredits);
+        registerCall(makeFullUri(s_serviceStreamCancelUri), this, &ServiceImpl<TService>::cancelStream);
     }
 
     template <typename TService>
     void ServiceImpl<TService>::doUnregister() {
+        unregisterCall(makeFullUri(s_serviceStreamCancelUri));
+        unregisterCall(makeFullUri(s_serviceStreamCreditUri));
+        unregisterCall(makeFullUri(s_serviceCallBatchUri));
+        unregisterCall(makeFullUri(s_serviceGetEncodingUri));
         unregisterCall(makeFullUri(s_serviceGetAlivePeriodUri));
+        setLocalRegistration(false);
     }
 
     template <typename TService>
     template <typename TClass, typename TMethodCallback>
-    void ServiceImpl<TService>::registerCall(const std::string &uri, TClass *pInstance, TMethodCallback &&methodCallback) {
-        auto pDelegate = std::make_shared<TSupplierDelegate<TClass, TMethodCallback>>(*this, pInstance, methodCallback);
-        m_pSupplierDelegates.insert(std::make_pair(uri, pDelegate));
+    void ServiceImpl<TService>::registerCall(
+        const std::string &uri, TClass *pInstance, TMethodCallback &&methodCallback, const size_t concurrency) {
+        auto pDelegate = std::make_shared<TSupplierDelegate<TClass, TMethodCallback>>(*this, pInstance, methodCallback, concurrency);
+        {
+            std::lock_guard lock(m_mutexSupplierDelegates);
+            m_pSupplierDelegates.insert(std::make_pair(uri, pDelegate));
+        }
         getMessaging()->registerCall(uri, pDelegate, pDelegate);
+        if (m_bLocalRegistered) {
+            TheLocalMessaging.registerCall(makeLocalUri(uri), pDelegate);
+        }
+    }
+
+    template <typename TService>
+    template <typename TClass, typename T, typename... TArgs>
+    void ServiceImpl<TService>::registerStream(const std::string &uri,
+        TClass *pInstance,
+        void (TClass::*streamCallback)(IServiceStreamWriterPtr<T>, TArgs...),
+        const size_t concurrency) {
+        registerStreamCall<T, TArgs...>(uri, pInstance, streamCallback, concurrency);
+    }
+
+    template <typename TService>
+    template <typename TClass, typename T, typename... TArgs>
+    void ServiceImpl<TService>::registerStream(const std::string &uri,
+        TClass *pInstance,
+        void (TClass::*streamCallback)(IServiceStreamWriterPtr<T>, TArgs...) const,
+        const size_t concurrency) {
+        registerStreamCall<T, TArgs...>(uri, pInstance, streamCallback, concurrency);
+    }
+
+    template <typename TService>
+    template <typename T, typename... TArgs, typename TClass, typename TStreamCallback>
+    void ServiceImpl<TService>::registerStreamCall(
+        const std::string &uri, TClass *pInstance, TStreamCallback streamCallback, const size_t concurrency) {
+        using stream_call_type = StreamCall<TClass, TStreamCallback, T, std::decay_t<TArgs>...>;
+
+        // kept on the re-registrations (reconnection): the calls of the previous registration may still be running
+        auto &pStreamCall     = m_pStreamCalls[uri];
+        auto pTypedStreamCall = std::dynamic_pointer_cast<stream_call_type>(pStreamCall);
+        if (pTypedStreamCall == nullptr) {
+            pTypedStreamCall = std::make_shared<stream_call_type>(*this, pInstance, streamCallback);
+            pStreamCall      = pTypedStreamCall;
+        }
+
+        registerCall(uri, pTypedStreamCall.get(), &stream_call_type::call, concurrency != 0 ? concurrency : s_streamConcurrency);
     }
 
     template <typename TService>
     void ServiceImpl<TService>::unregisterCall(const std::string &uri) {
-        auto const itDelegate = m_pSupplierDelegates.find(uri);
-        if (itDelegate == m_pSupplierDelegates.cend()) {
-            throw ServiceException("'" + uri + "' has not been registered!");
+        data::IMessaging::ISupplierDelegatePtr pSupplierDelegate;
+        {
+            std::lock_guard lock(m_mutexSupplierDelegates);
+            auto const itDelegate = m_pSupplierDelegates.find(uri);
+            if (itDelegate == m_pSupplierDelegates.cend()) {
+                throw ServiceException("'" + uri + "' has not been registered!");
+            }
+
+            pSupplierDelegate = std::move(itDelegate->second);
+            m_pSupplierDelegates.erase(itDelegate);
         }
 
-        auto const guard = core::make_scope_exit([this, &itDelegate]() { m_pSupplierDelegates.erase(itDelegate); });
-        auto pDelegate   = std::dynamic_pointer_cast<SupplierDelegate>(itDelegate->second);
+        auto pDelegate = std::dynamic_pointer_cast<SupplierDelegate>(pSupplierDelegate);
+        TheLocalMessaging.unregisterCall(makeLocalUri(uri), pDelegate);
         getMessaging()->unregisterCall(uri, pDelegate);
     }
 
@@ -217,10 +612,18 @@ namespace NS_OSBASE::application {
         resetAliveNotification();
     }
 
+    template <typename TService>
+    void ServiceImpl<TService>::invalidateCache(const std::string &processName) const {
+        using message_type = typename ServiceBase<TService>::CacheInvalidateMsg::type; // type expected by the stubs of the process
+        publish(makeInvalidateTopic(processName), message_type{});
+    }
+
     template <typename TService>
     void ServiceImpl<TService>::onMessagingConnection(const bool bConnected) {
         if (bConnected) {
-            m_pSupplierDelegates.clear();
+            clearSupplierDelegates();
+        } else {
+            setLocalRegistration(false);
         }
 
         ServiceBase<TService>::onMessagingConnection(bConnected);
@@ -239,13 +642,15 @@ namespace NS_OSBASE::application {
 
     template <typename TService>
     void ServiceImpl<TService>::publishReadyMessage() const {
-        publishMessage(makeFullUri(s_serviceNotifyReadyTopic), m_alivePeriod.count());
+        using message_type = typename ServiceBase<TService>::ReadyMsg::type; // type expected by the stubs (notified in the process)
+        publishMessage(makeFullUri(s_serviceNotifyReadyTopic), static_cast<message_type>(m_alivePeriod.count()));
     }
 
     template <typename TService>
     void ServiceImpl<TService>::publishAliveMessage(const std::chrono::milliseconds &alivePeriod) const {
         try {
-            publishMessage(makeFullUri(s_serviceNotifyAliveTopic), alivePeriod.count());
+            using message_type = typename ServiceBase<TService>::AliveMsg::type; // type expected by the stubs (notified in the process)
+            publishMessage(makeFullUri(s_serviceNotifyAliveTopic), static_cast<message_type>(alivePeriod.count()));
         } catch (const data::MessagingException &) {
         } // doesn't propagate any exception, broker deconnection handled by another mehcanism
     }
@@ -253,18 +658,141 @@ namespace NS_OSBASE::application {
     template <typename TService>
     template <typename TMessage>
     void ServiceImpl<TService>::publishMessage(const std::string &topic, const TMessage &message) const {
-        const std::string serializedTopic = [&message]() {
-            auto const pKeyStream = core::makeJsonStream();
-            pKeyStream->setValue(message);
-
-            std::ostringstream oss;
-            oss << *pKeyStream;
-            return oss.str();
-        }();
+        const std::string serializedTopic = serializePayload(getWireEncoding(), message);
 
+        if (m_bLocalRegistered) {
+            publishLocalMessage(topic, message, serializedTopic);
+        }
         getMessaging()->publish(topic, serializedTopic, m_pPublishErrorDelegate);
     }
 
+    template <typename TService>
+    template <typename TMessage>
+    void ServiceImpl<TService>::publishLocalMessage(const std::string &topic, const TMessage &message, const std::string &payload) const {
+        std::shared_ptr<const TMessage> pMessage; // one copy for all the subscribers
+        for (auto const &pSubscriber : TheLocalMessaging.getSubscribers(makeLocalUri(topic))) {
+            if (auto const pEvent = std::dynamic_pointer_cast<ILocalEvent<TMessage>>(pSubscriber); pEvent != nullptr) {
+                if (pMessage == nullptr) {
+                    pMessage = std::make_shared<const TMessage>(message);
+                }
+                pEvent->onLocalEvent(pMessage);
+            } else {
+                pSubscriber->onLocalPayload(payload); // message of another type: deserialized by the subscriber
+            }
+        }
+    }
+
+    template <typename TService>
+    std::string ServiceImpl<TService>::getWireEncodingName() const {
+        return getEncodingName(getWireEncoding());
+    }
+
+    template <typename TService>
+    std::vector<ServiceBatchResult> ServiceImpl<TService>::invokeBatch(std::vector<ServiceBatchCall> calls) {
+        std::vector<ServiceBatchResult> results;
+        results.reserve(calls.size());
+
+        // executed in order, each one with the concurrency of its method: the next call waits for the end of the previous one
+        for (auto const &call : calls) {
+            auto &result = results.emplace_back();
+            try {
+                std::shared_ptr<SupplierDelegate> pDelegate;
+                {
+                    std::lock_guard lock(m_mutexSupplierDelegates);
+                    if (auto const itDelegate = m_pSupplierDelegates.find(call.uri); itDelegate != m_pSupplierDelegates.cend()) {
+                        pDelegate = std::dynamic_pointer_cast<SupplierDelegate>(itDelegate->second);
+                    }
+                }
+                if (pDelegate == nullptr) {
+                    throw ServiceException("'" + call.uri + "' has not been registered!");
+                }
+
+                result.payload = pDelegate->invokeBatched(call.payload);
+            } catch (const std::exception &e) {
+                result.strError = e.what();
+            } catch (...) {
+                result.strError = "unknown exception";
+            }
+        }
+        return results;
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::grantStreamCredits(std::string streamId, unsigned long long credits) {
+        std::lock_guard lock(m_mutexStreams);
+        if (auto const itStream = m_pStreams.find(streamId); itStream != m_pStreams.cend()) {
+            itStream->second->grant(credits);
+        }
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::cancelStream(std::string streamId) {
+        std::lock_guard lock(m_mutexStreams);
+        if (auto const itStream = m_pStreams.find(streamId); itStream != m_pStreams.cend()) {
+            itStream->second->cancel();
+        }
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::cancelStreams() {
+        std::lock_guard lock(m_mutexStreams);
+        for (auto const &[streamId, pStream] : m_pStreams) {
+            pStream->cancel();
+        }
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::setLocalRegistration(const bool bRegistered) {
+        if ((bRegistered && !TheLocalMessaging.isEnabled()) || m_bLocalRegistered.exchange(bRegistered) == bRegistered) {
+            return;
+        }
+
+        auto const serviceUri = makeLocalUri(getServiceName());
+        if (bRegistered) {
+            TheLocalMessaging.registerService(serviceUri);
+            return;
+        }
+
+        TheLocalMessaging.unregisterService(serviceUri);
+        std::lock_guard lock(m_mutexSupplierDelegates);
+        for (auto const &[uri, pDelegate] : m_pSupplierDelegates) {
+            TheLocalMessaging.unregisterCall(makeLocalUri(uri), pDelegate);
+        }
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::clearSupplierDelegates() {
+        std::unordered_map<std::string, data::IMessaging::ISupplierDelegatePtr> pSupplierDelegates;
+        {
+            std::lock_guard lock(m_mutexSupplierDelegates);
+            pSupplierDelegates.swap(m_pSupplierDelegates);
+        }
+        // destroyed unlocked: their dispatchers wait for the running calls
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::beginCall() const {
+        m_nbRunningCalls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    template <typename TService>
+    void ServiceImpl<TService>::endCall() const {
+        m_lastCallEnd.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        m_nbRunningCalls.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    template <typename TService>
+    bool ServiceImpl<TService>::isBusy() const {
+        if (m_nbRunningCalls.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+
+        // busy if no call has ended during the last period: the running ones may last longer than the timeout of the stubs
+        using clock            = std::chrono::steady_clock;
+        auto const lastCallEnd = clock::time_point(clock::duration(m_lastCallEnd.load(std::memory_order_relaxed)));
+        return clock::now() - lastCallEnd >= m_alivePeriod;
+    }
+
     template <typename TService>
     void ServiceImpl<TService>::suspendAliveNotification() const {
         std::lock_guard lock(m_mutexAlive);
@@ -284,7 +812,10 @@ namespace NS_OSBASE::application {
         std::lock_guard lock(m_mutexAlive);
 
         if (m_refCall == 0) {
-            m_pTaskAlive = getTaskLoop()->pushRepeated(m_alivePeriod, [this]() { publishAliveMessage(m_alivePeriod); });
+            m_pTaskAlive = getTaskLoop()->pushRepeated({ m_alivePriority }, m_alivePeriod, [this]() {
+                // in-progress long calls are announced by the periodic message: the stubs stop their timeout until the next one
+                publishAliveMessage(isBusy() ? std::chrono::milliseconds(0) : m_alivePeriod);
+            });
         }
         ++m_refCall;
     }
@@ -1,18 +1,29 @@
 /// \brief Common interface for services
 
 #pragma once
+#include "EventDispatcher.h"
 #include "ServiceBase.h"
+#include "ServiceCache.h"
 #include "osApplication/TaskLoop.h"
 #include "osData/IMessaging.h"
+#include <condition_variable>
+#include <deque>
 #include <future>
 #include <memory>
 #include <optional>
+#include <random>
 #include <set>
+#include <sstream>
 #include <type_traits>
 #include <vector>
 #include <optional>
+#ifdef __cpp_impl_coroutine
+#include "Coroutine.h"
+#endif
 
 namespace NS_OSBASE::application {
+    template <typename TService, typename TBatch>
+    class ServiceBatch;
 
     /**
      * \brief Base implementation of the "stub" of the service
@@ -26,6 +37,8 @@ namespace NS_OSBASE::application {
         void disconnect() final;                                  //!< Disconnect the service from the broker
         unsigned long long getAlivePeriod() const override final; //!< period of alive message in ms
 
+        ServiceCache::Counters getCacheCounters() const; //!< Return the counters of the caches of the const processes (sum)
+
     protected:
         /**
          * \brief Encapsulate the return result and the error
@@ -44,7 +57,15 @@ namespace NS_OSBASE::application {
             T result = {}; //!< Return value
         };
 
-        ServiceStub(const std::string &serviceName, const data::Uri &uri, const std::string &realm, TaskLoopPtr pTaskLoop); //!< Ctor
+        /**
+         * \brief Ctor
+         * \param serviceName   Name of the service
+         * \param uri           Uri of the broker
+         * \param realm         Realm of the service
+         * \param pTaskLoop     Loop (or strand of a TaskLoopPool) on which the events are notified. If null, the stub owns a TaskLoop run
+         *                      in its own thread between connect() and disconnect(), otherwise the caller runs the loop.
+         */
+        ServiceStub(const std::string &serviceName, const data::Uri &uri, const std::string &realm, TaskLoopPtr pTaskLoop);
 
         /**
          * \brief Invoke synchroneously the service process related to the URI
@@ -76,6 +97,66 @@ namespace NS_OSBASE::application {
         template <typename TRet, typename... TArgs>
         std::future<Result<TRet>> invokeAsync(const std::string &uri, TArgs &&...args) const; //!< \copydoc ServiceStub::invokeAsync()
 
+        /**
+         * \brief Invoke synchroneously a const process, its result is returned by the cache of the process if stored (see setCache())
+         * \tparam TRet     Type of the return value
+         * \tparam TArgs    Types of the arguments
+         * \param uri       URI of the call
+         * \param args      Arguments of the invocation, serialized as key of the cache
+         * \return          Result of the invocation
+         *
+         * \throws          ServiceException in case of timeout or messaging error
+         */
+        template <typename TRet, typename... TArgs>
+        TRet invokeCached(const std::string &uri, TArgs &&...args) const;
+
+        /**
+         * \brief Cache the results of a const process, to call before the connection
+         * \remark The results are cleared when the impl publishes the invalidation of the process (see ServiceImpl::invalidateCache())
+         * and when the impl is (re-)connected.
+         * \param uri           URI of the process
+         * \param processName   Name of the process (topic of the invalidation)
+         * \param options       Bounds of the cache
+         */
+        void setCache(const std::string &uri, const std::string &processName, const ServiceCache::Options &options);
+
+        /**
+         * \brief Invoke a process returning a stream (see ServiceImpl::registerStream())
+         * \remark The impl publishes the chunks on a topic of the stream, at most window chunks ahead of the reader: the reader grants
+         * new credits as the chunks are read. The call returns the number of written chunks: the end of the stream.
+         * \tparam T        Type of the chunks
+         * \tparam TArgs    Types of the arguments
+         * \param uri       URI of the call
+         * \param window    Maximal number of chunks written ahead of the reader (at least 1)
+         * \param args      Arguments of the invocation
+         * \return          Reader of the chunks, waiting for each one at most the call timeout
+         * \throws          ServiceException in case of messaging error
+         */
+        template <typename T, typename... TArgs>
+        IServiceStreamPtr<T> invokeStream(const std::string &uri, const size_t window, TArgs &&...args) const;
+
+#ifdef __cpp_impl_coroutine
+        template <typename TRet>
+        class InvokeAwaiter;
+
+        /**
+         * \brief Invoke the service process related to the URI from a coroutine (C++20)
+         * \remark The coroutine is suspended without blocking any thread. It is resumed on its TaskLoop (the TaskLoop of the stub if it is
+         * not a CoTask) when the result is received or when the call timeout is reached, if any. The generated stubs expose it as the
+         * co<Method>() versions of their processes.
+         * \tparam TRet     Type of the return value
+         * \tparam TArgs    Types of the arguments
+         * \param uri       URI of the call
+         * \param args      Arguments of the invocation
+         * \return          Awaitable on the result of the invocation, throwing ServiceException in case of timeout or messaging error
+         */
+        template <typename TRet, typename... TArgs>
+        InvokeAwaiter<TRet> coInvoke(const std::string &uri, TArgs &&...args);
+
+        template <typename TRet, typename... TArgs>
+        InvokeAwaiter<TRet> coInvoke(const std::string &uri, TArgs &&...args) const; //!< \copydoc ServiceStub::coInvoke()
+#endif
+
         /**
          * \brief Subscribe the service stub to the topic (event) published by the ServiceImpl side
          * \tparam TMessage Type of the expected message
@@ -98,18 +179,34 @@ namespace NS_OSBASE::application {
         void onMessagingConnection(const bool bConnected) override;
 
     private:
+        template <typename, typename>
+        friend class ServiceBatch; // sends its calls as one invocation
+
         template <typename TRet>
         class ClientDelegate;
 
         template <class TMessage>
         class EventDelegate;
 
+        template <typename T>
+        class StreamDelegate;
+
+        template <typename T>
+        class StreamReader;
+
         template <typename TRet>
         auto makeClientDelegate();
 
         template <typename TRet>
         auto makeClientDelegate() const;
 
+        template <typename TRet, typename... TArgs>
+        auto sendInvocation(const std::string &uri, TArgs &&...args);
+
+        // pDelegate: IClientDelegate, IErrorDelegate and ILocalResult<TRet> receiving the result
+        template <typename TRet, typename TDelegate, typename... TArgs>
+        void dispatchInvocation(const std::shared_ptr<TDelegate> &pDelegate, const std::string &uri, TArgs &&...args);
+
         void removeClientDelegate(data::IMessaging::IClientDelegatePtr pClientDelegate);
 
         void listenAliveMessage(const std::chrono::milliseconds &timeout);
@@ -117,9 +214,16 @@ namespace NS_OSBASE::application {
         void resetListenAliveMessage(const std::chrono::milliseconds &timeout);
         bool isListeningAliveMessage() const;
         void onConnected(const bool bConnected, const bool bQueued);
+        void negotiateEncoding(); // with the impl: the requested encoding if supported by both, json otherwise
+        bool isLocalService() const; // impl connected in the process (see LocalMessaging)
+        void invalidateCache(const std::string &topic);
+        void clearCaches();
+        static std::string makeStreamId(); // unique among the processes: topic of the chunks
 
         mutable std::set<data::IMessaging::IClientDelegatePtr> m_pClientDelegates;
         mutable std::unordered_map<std::string, data::IMessaging::IEventDelegatePtr> m_pEventDelegates;
+        std::unordered_map<std::string, ServiceCachePtr> m_pCaches;            // by uri of the process
+        std::unordered_map<std::string, ServiceCachePtr> m_pInvalidatedCaches; // by topic of the invalidation
 
         mutable std::mutex m_mutex;
 
@@ -128,6 +232,7 @@ namespace NS_OSBASE::application {
         ITaskPtr m_pTaskAlive;
         size_t m_refCall = 0;
         std::chrono::milliseconds m_lastAliveTimeout;
+        std::atomic<std::chrono::steady_clock::rep> m_lastReply = 0; // time of the last result: the replies prove the liveness
 
         static constexpr int s_factorAlivePeriod = 2;
     };
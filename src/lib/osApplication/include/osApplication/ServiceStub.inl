@@ -6,7 +6,6 @@
 #ifdef OSBASE_APPLICATION_SERVICE_TRACE
 #include "osData/Log.h"
 #endif
-#include <sstream>
 
 namespace NS_OSBASE::application {
 
@@ -17,6 +16,7 @@ namespace NS_OSBASE::application {
     template <typename TRet>
     class ServiceStub<TService>::ClientDelegate : public data::IMessaging::IClientDelegate,
                                                   public data::IMessaging::IErrorDelegate,
+                                                  public ILocalResult<TRet>,
                                                   public std::enable_shared_from_this<ClientDelegate<TRet>> {
     public:
         ClientDelegate(ServiceStub<TService> &serviceStub) : m_serviceStub(serviceStub) {
@@ -27,22 +27,35 @@ namespace NS_OSBASE::application {
             oslog::trace(data::OS_LOG_CHANNEL_APPLICATION) << "Result json : '" << json << "'" << oslog::end();
 #endif
 
+            if constexpr (std::is_void_v<TRet>) {
+                yield({});
+            } else {
+                yield(deserializePayload(json, TRet{}));
+            }
+        }
+
+        void yield(typename ILocalResult<TRet>::value_type &&value) override {
             if constexpr (std::is_void_v<TRet>) {
                 m_result.set_value(Result<void>{});
             } else {
-                auto const pKeyStream = core::makeJsonStream(std::stringstream(json));
-                auto value            = pKeyStream->getValue(TRet{});
                 m_result.set_value(Result<TRet>{ {}, std::move(value) });
             }
+            m_serviceStub.m_lastReply.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+            complete();
             m_serviceStub.removeClientDelegate(shared_from_this());
         }
 
+        void fail(const std::string &error) override {
+            onError(error);
+        }
+
         void onError(const std::string &error) override {
             if constexpr (std::is_void_v<TRet>) {
                 m_result.set_value(Result<void>{ error });
             } else {
                 m_result.set_value(Result<TRet>{ error, TRet{} });
             }
+            complete();
             m_serviceStub.removeClientDelegate(shared_from_this());
         }
 
@@ -50,11 +63,111 @@ namespace NS_OSBASE::application {
             return m_result.get_future();
         }
 
+#ifdef __cpp_impl_coroutine
+        void setCompletion(std::function<void()> &&completion) {
+            {
+                std::lock_guard lock(m_completionMutex);
+                if (!m_bCompleted) {
+                    m_completion = std::move(completion);
+                    return;
+                }
+            }
+
+            // the result has already been received
+            completion();
+        }
+#endif
+
     private:
+        void complete() {
+#ifdef __cpp_impl_coroutine
+            std::function<void()> completion;
+            {
+                std::lock_guard lock(m_completionMutex);
+                m_bCompleted = true;
+                completion   = std::move(m_completion);
+            }
+
+            if (completion) {
+                completion();
+            }
+#endif
+        }
+
         ServiceStub<TService> &m_serviceStub;
         std::promise<Result<TRet>> m_result;
+#ifdef __cpp_impl_coroutine
+        std::mutex m_completionMutex;
+        std::function<void()> m_completion;
+        bool m_bCompleted = false;
+#endif
     };
 
+#ifdef __cpp_impl_coroutine
+    /*
+     * \class ServiceStub::InvokeAwaiter
+     */
+    template <class TService>
+    template <typename TRet>
+    class ServiceStub<TService>::InvokeAwaiter {
+    public:
+        InvokeAwaiter(ServiceStub<TService> &serviceStub, std::shared_ptr<ClientDelegate<TRet>> pClientDelegate)
+            : m_serviceStub(serviceStub), m_pClientDelegate(pClientDelegate), m_futResult(pClientDelegate->getFutureResult()) {
+        }
+
+        bool await_ready() const {
+            return m_futResult.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready;
+        }
+
+        template <typename TPromise>
+        void await_suspend(std::coroutine_handle<TPromise> handle) {
+            auto pTaskLoop = internal::getTaskLoop(handle);
+            if (pTaskLoop == nullptr) {
+                pTaskLoop = m_serviceStub.getTaskLoop().get();
+            }
+
+            // resumed once: by the result or by the timeout
+            auto const resume = [pResumed = std::make_shared<std::atomic_bool>(false), handle]() {
+                if (!pResumed->exchange(true)) {
+                    handle.resume();
+                }
+            };
+            if (auto const &timeout = m_serviceStub.getCallTimeout(); timeout != std::chrono::milliseconds::max()) {
+                m_pTimeoutTask = pTaskLoop->pushSingleShot(timeout, resume);
+            }
+
+            // the awaiter may be destroyed once the completion is set
+            auto const pClientDelegate = m_pClientDelegate;
+            pClientDelegate->setCompletion([pTaskLoop, resume]() { pTaskLoop->post(resume); });
+        }
+
+        TRet await_resume() {
+            if (m_pTimeoutTask != nullptr) {
+                m_pTimeoutTask->setEnabled(false);
+            }
+
+            if (!await_ready()) {
+                throw ServiceException("invoke timeout!");
+            }
+
+            auto result = m_futResult.get();
+            if (result.strError) {
+                throw ServiceException(*result.strError);
+            }
+
+            if constexpr (!std::is_void_v<TRet>) {
+                return std::move(result.result);
+            }
+        }
+
+    private:
+        ServiceStub<TService> &m_serviceStub;
+        std::shared_ptr<ClientDelegate<TRet>> m_pClientDelegate;
+        std::future<Result<TRet>> m_futResult;
+        ITaskPtr m_pTimeoutTask;
+    };
+#endif
+
     /*
      * \class ServiceStub::EventDelegate
      */
@@ -62,18 +175,56 @@ namespace NS_OSBASE::application {
     template <typename TMessage>
     class ServiceStub<TService>::EventDelegate : public data::IMessaging::IEventDelegate,
                                                  public data::IMessaging::IErrorDelegate,
+                                                 public ILocalEvent<typename TMessage::type>,
                                                  public std::enable_shared_from_this<EventDelegate<TMessage>> {
     public:
-        EventDelegate(ServiceStub<TService> &serviceStub) : m_serviceStub(serviceStub) {
+        EventDelegate(ServiceStub<TService> &serviceStub, const std::string &topic)
+            : m_serviceStub(serviceStub), m_topic(topic), m_localTopic(serviceStub.makeLocalUri(topic)) {
+            TheEventDispatcher.subscribe(m_localTopic);
+        }
+
+        ~EventDelegate() override {
+            TheEventDispatcher.unsubscribe(m_localTopic);
         }
 
         void onEvent(const std::string &json) override {
 #ifdef OSBASE_APPLICATION_SERVICE_TRACE
             oslog::trace(data::OS_LOG_CHANNEL_APPLICATION) << "Event json: '" << json << "'" << oslog::end();
 #endif
-            auto const pKeyStream = core::makeJsonStream(std::stringstream(json));
-            auto const message    = pKeyStream->getValue(TMessage::type{});
+            if (m_serviceStub.isLocalService()) {
+                return; // already notified in the process
+            }
+
+            onMessage(decode(json));
+        }
+
+        void onLocalEvent(const std::shared_ptr<const typename TMessage::type> &pMessage) override {
+            onMessage(TheEventDispatcher.convert<TMessage>(
+                m_localTopic, pMessage, [](const typename TMessage::type &message) { return TMessage{ message }; }));
+        }
+
+        void onLocalPayload(const data::IMessaging::JsonText &payload) override {
+            onMessage(decode(payload));
+        }
+
+        void onError(const std::string &errorMsg) override {
+            m_serviceStub.getTaskLoop()->push([this, errorMsg]() { m_serviceStub.notify(RuntimeErrorMsg{ errorMsg }); });
+        }
 
+        auto getFutureResult() {
+            return m_result.get_future();
+        }
+
+    private:
+        // decoded once for the stubs of the process subscribed to the topic (see EventDispatcher)
+        std::shared_ptr<const TMessage> decode(const data::IMessaging::JsonText &payload) const {
+            return TheEventDispatcher.decode<TMessage>(m_localTopic, payload, [](const data::IMessaging::JsonText &json) {
+                return TMessage{ deserializePayload(json, typename TMessage::type{}) };
+            });
+        }
+
+        void onMessage(std::shared_ptr<const TMessage> pMessage) {
+            auto const &message = pMessage->data;
             if constexpr (std::is_same_v<TMessage, AliveMsg>) {
                 if (message == 0) {
                     m_serviceStub.stopListenAliveMessage();
@@ -83,6 +234,9 @@ namespace NS_OSBASE::application {
                     m_serviceStub.listenAliveMessage(std::chrono::milliseconds(message));
                 }
             } else if constexpr (std::is_same_v<TMessage, ReadyMsg>) {
+                // the service may have been restarted with another encoding and other results
+                m_serviceStub.getTaskLoop()->push([this]() { m_serviceStub.negotiateEncoding(); });
+                m_serviceStub.clearCaches();
                 if (m_serviceStub.isListeningAliveMessage()) {
                     m_serviceStub.stopListenAliveMessage();
                     m_serviceStub.onConnected(false, true);
@@ -90,24 +244,237 @@ namespace NS_OSBASE::application {
 
                 m_serviceStub.onConnected(true, true);
                 m_serviceStub.listenAliveMessage(std::chrono::milliseconds(message));
+            } else if constexpr (std::is_same_v<TMessage, CacheInvalidateMsg>) {
+                m_serviceStub.invalidateCache(m_topic); // before the next calls: not queued in the loop
             } else {
                 if (m_serviceStub.isListeningAliveMessage()) {
                     m_serviceStub.resetListenAliveMessage(m_serviceStub.m_lastAliveTimeout);
                 }
-                m_serviceStub.getTaskLoop()->push([this, message]() { m_serviceStub.notify(TMessage{ message }); });
+                // keyed by topic: the last event of the topic replaces the pending one if the loop is full (OverflowPolicy::coalesce)
+                m_serviceStub.getTaskLoop()->push({ TaskPriority::normal, std::chrono::milliseconds::max(), m_topic },
+                    [this, pMessage = std::move(pMessage)]() { m_serviceStub.notify(*pMessage); });
             }
         }
 
-        void onError(const std::string &errorMsg) override {
-            m_serviceStub.getTaskLoop()->push([this, errorMsg]() { m_serviceStub.notify(RuntimeErrorMsg{ errorMsg }); });
+        ServiceStub<TService> &m_serviceStub;
+        const std::string m_topic;
+        const std::string m_localTopic;
+    };
+
+    /*
+     * \class ServiceStub::StreamDelegate
+     */
+    template <class TService>
+    template <typename T>
+    class ServiceStub<TService>::StreamDelegate : public data::IMessaging::IEventDelegate,
+                                                  public data::IMessaging::IClientDelegate,
+                                                  public data::IMessaging::IErrorDelegate,
+                                                  public ILocalEvent<T>,
+                                                  public ILocalResult<unsigned long long> {
+    public:
+        StreamDelegate(ServiceStub<TService> &serviceStub) : m_serviceStub(serviceStub) {
         }
 
-        auto getFutureResult() {
-            return m_result.get_future();
+        void onEvent(const std::string &json) override {
+            if (m_serviceStub.isLocalService()) {
+                return; // already received in the process
+            }
+
+            push(deserializePayload(json, T{}));
+        }
+
+        void onLocalEvent(const std::shared_ptr<const T> &pChunk) override {
+            push(T(*pChunk));
+        }
+
+        void onLocalPayload(const data::IMessaging::JsonText &payload) override {
+            push(deserializePayload(payload, T{}));
+        }
+
+        void onResult(const std::string &json) override {
+            yield(deserializePayload(json, 0ULL));
+        }
+
+        void yield(unsigned long long &&nbChunks) override {
+            {
+                std::lock_guard lock(m_mutex);
+                m_nbChunks = nbChunks;
+            }
+            m_cvChunks.notify_all();
+        }
+
+        void fail(const std::string &error) override {
+            onError(error);
+        }
+
+        void onError(const std::string &error) override {
+            {
+                std::lock_guard lock(m_mutex);
+                if (!m_error.has_value()) {
+                    m_error = error;
+                }
+            }
+            m_cvChunks.notify_all();
+        }
+
+        bool isEnded() const {
+            std::lock_guard lock(m_mutex);
+            return isEndedUnlocked();
+        }
+
+        // none at the end of the stream, the chunks received before an error are returned first
+        std::optional<T> pop(const std::chrono::milliseconds &timeout) {
+            std::unique_lock lock(m_mutex);
+            auto const isReady = [this]() { return !m_chunks.empty() || isEndedUnlocked(); };
+            if (timeout == std::chrono::milliseconds::max()) {
+                m_cvChunks.wait(lock, isReady);
+            } else if (!m_cvChunks.wait_for(lock, timeout, isReady)) {
+                throw ServiceException("stream timeout!");
+            }
+
+            if (!m_chunks.empty()) {
+                std::optional<T> chunk = std::move(m_chunks.front());
+                m_chunks.pop_front();
+                return chunk;
+            }
+
+            if (m_error.has_value()) {
+                throw ServiceException(*m_error);
+            }
+            return {};
         }
 
     private:
+        void push(T &&chunk) {
+            {
+                std::lock_guard lock(m_mutex);
+                m_chunks.push_back(std::move(chunk));
+                ++m_nbReceived;
+            }
+            m_cvChunks.notify_all();
+        }
+
+        bool isEndedUnlocked() const {
+            // the result and the chunks are not ordered on the messaging: ended once all the chunks are received
+            return m_error.has_value() || (m_nbChunks.has_value() && m_nbReceived >= *m_nbChunks);
+        }
+
         ServiceStub<TService> &m_serviceStub;
+        std::deque<T> m_chunks; // received, not read: bounded by the window
+        unsigned long long m_nbReceived = 0;
+        std::optional<unsigned long long> m_nbChunks; // returned by the call
+        std::optional<std::string> m_error;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_cvChunks;
+    };
+
+    /*
+     * \class ServiceStub::StreamReader
+     */
+    template <class TService>
+    template <typename T>
+    class ServiceStub<TService>::StreamReader : public IServiceStream<T> {
+    public:
+        StreamReader(ServiceStub<TService> &serviceStub, const size_t window)
+            : m_serviceStub(serviceStub),
+              m_streamId(makeStreamId()),
+              m_topic(serviceStub.makeStreamTopic(m_streamId)),
+              m_window(std::max<size_t>(window, 1)),
+              m_pDelegate(std::make_shared<StreamDelegate<T>>(serviceStub)) {
+        }
+
+        ~StreamReader() override {
+            cancel();
+        }
+
+        template <typename... TArgs>
+        void open(const std::string &uri, TArgs &&...args) {
+            auto const pMessaging = m_serviceStub.getMessaging();
+            if (pMessaging == nullptr) {
+                throw ServiceException("the stub is not connected!");
+            }
+
+            // subscribed before the call: the impl writes the first chunks as soon as it is called
+            TheLocalMessaging.subscribe(m_serviceStub.makeLocalUri(m_topic), m_pDelegate);
+            pMessaging->subscribe(m_topic, m_pDelegate, m_pDelegate);
+            m_bOpened = true;
+
+            m_nbGranted = m_window;
+            m_serviceStub.template dispatchInvocation<unsigned long long>(
+                m_pDelegate, uri, m_streamId, static_cast<unsigned long long>(m_window), std::forward<TArgs>(args)...);
+        }
+
+        std::optional<T> next() override {
+            if (!m_bOpened) {
+                return {};
+            }
+
+            std::optional<T> chunk;
+            try {
+                chunk = m_pDelegate->pop(m_serviceStub.getCallTimeout());
+            } catch (const ServiceException &) {
+                cancel();
+                throw;
+            }
+
+            if (!chunk.has_value()) {
+                close();
+                return {};
+            }
+
+            ++m_nbRead;
+            grantCredits();
+            return chunk;
+        }
+
+        void cancel() override {
+            if (!m_bOpened) {
+                return;
+            }
+
+            if (!m_pDelegate->isEnded()) {
+                try {
+                    auto const uri = m_serviceStub.makeFullUri(ServiceStub<TService>::s_serviceStreamCancelUri);
+                    m_serviceStub.template invokeAsync<void>(uri, m_streamId);
+                } catch (const std::exception &) {
+                }
+            }
+            close();
+        }
+
+    private:
+        void grantCredits() {
+            // granted by halves of the window: the impl writes at most the window ahead of the reader
+            auto const nbPending = m_nbGranted - m_nbRead;
+            if (nbPending > m_window / 2 || m_pDelegate->isEnded()) {
+                return;
+            }
+
+            auto const credits = m_window - nbPending;
+            auto const uri     = m_serviceStub.makeFullUri(ServiceStub<TService>::s_serviceStreamCreditUri);
+            m_serviceStub.template invokeAsync<void>(uri, m_streamId, credits);
+            m_nbGranted += credits;
+        }
+
+        void close() {
+            m_bOpened = false;
+            TheLocalMessaging.unsubscribe(m_serviceStub.makeLocalUri(m_topic), m_pDelegate);
+            if (auto const pMessaging = m_serviceStub.getMessaging(); pMessaging != nullptr) {
+                try {
+                    pMessaging->unsubscribe(m_topic, nullptr);
+                } catch (const std::exception &) {
+                }
+            }
+        }
+
+        ServiceStub<TService> &m_serviceStub;
+        const std::string m_streamId;
+        const std::string m_topic;
+        const unsigned long long m_window;
+        std::shared_ptr<StreamDelegate<T>> m_pDelegate; // also kept by the local call until its result
+        unsigned long long m_nbGranted = 0;
+        unsigned long long m_nbRead    = 0;
+        bool m_bOpened                 = false;
     };
 
     /*
@@ -132,6 +499,7 @@ namespace NS_OSBASE::application {
             return; // Failed connection is not an error, the method onMessagingConnection will be callesd on (re-)connection
         }
 
+        negotiateEncoding();
         auto timeoutAliveMsg = std::chrono::milliseconds(0);
 
         try {
@@ -168,15 +536,30 @@ namespace NS_OSBASE::application {
         return invoke<unsigned long long>(makeFullUri(s_serviceGetAlivePeriodUri));
     }
 
+    template <class TService>
+    ServiceCache::Counters ServiceStub<TService>::getCacheCounters() const {
+        ServiceCache::Counters counters;
+        for (auto const &[uri, pCache] : m_pCaches) {
+            counters += pCache->getCounters();
+        }
+        return counters;
+    }
+
     template <class TService>
     void ServiceStub<TService>::doRegister() {
         subscribe<RuntimeErrorMsg>(makeFullUri(s_serviceRuntimeErrorTopic));
         subscribe<ReadyMsg>(makeFullUri(s_serviceNotifyReadyTopic));
         subscribe<AliveMsg>(makeFullUri(s_serviceNotifyAliveTopic));
+        for (auto const &[topic, pCache] : m_pInvalidatedCaches) {
+            subscribe<CacheInvalidateMsg>(topic);
+        }
     }
 
     template <class TService>
     void ServiceStub<TService>::doUnregister() {
+        for (auto const &[topic, pCache] : m_pInvalidatedCaches) {
+            unsubscribe<CacheInvalidateMsg>(topic);
+        }
         unsubscribe<AliveMsg>(makeFullUri(s_serviceNotifyAliveTopic));
         unsubscribe<ReadyMsg>(makeFullUri(s_serviceNotifyReadyTopic));
         unsubscribe<RuntimeErrorMsg>(makeFullUri(s_serviceRuntimeErrorTopic));
@@ -227,23 +610,7 @@ namespace NS_OSBASE::application {
     template <class TService>
     template <typename TRet, typename... TArgs>
     std::future<typename ServiceStub<TService>::Result<TRet>> ServiceStub<TService>::invokeAsync(const std::string &uri, TArgs &&...args) {
-
-        // serialize parameters
-        auto const serializedParams = [&args...]() {
-            auto const pKeyStream = core::makeJsonStream();
-            pKeyStream->setValue(std::make_tuple(std::forward<TArgs>(args)...));
-            std::ostringstream oss;
-            oss << *pKeyStream;
-            return oss.str();
-        }();
-
-        // invoke the call
-#ifdef OSBASE_APPLICATION_SERVICE_TRACE
-        oslog::trace(data::OS_LOG_CHANNEL_APPLICATION) << "Call json : '" << serializedParams << "'" << oslog::end();
-#endif
-        auto const pClientDelegate = makeClientDelegate<TRet>();
-        getMessaging()->invoke(uri, serializedParams, pClientDelegate, pClientDelegate);
-        return pClientDelegate->getFutureResult();
+        return sendInvocation<TRet>(uri, std::forward<TArgs>(args)...)->getFutureResult();
     }
 
     template <class TService>
@@ -254,12 +621,101 @@ namespace NS_OSBASE::application {
         return self.invokeAsync<TRet>(uri, std::forward<TArgs>(args)...);
     }
 
+    template <class TService>
+    template <typename TRet, typename... TArgs>
+    TRet ServiceStub<TService>::invokeCached(const std::string &uri, TArgs &&...args) const {
+        static_assert(!std::is_void_v<TRet>, "only the results of the processes are cached");
+
+        auto const itCache = m_pCaches.find(uri);
+        if (itCache == m_pCaches.cend()) {
+            return invoke<TRet>(uri, std::forward<TArgs>(args)...);
+        }
+
+        // same key whatever the negotiated encoding
+        auto const &pCache = itCache->second;
+        auto const key     = serializePayload(ServiceEncoding::json, std::make_tuple(args...));
+        if (auto value = pCache->find(key); value.has_value()) {
+            return std::any_cast<TRet>(std::move(*value));
+        }
+
+        auto const generation = pCache->getGeneration(); // before the call: an invalidation received meanwhile drops the result
+        auto result           = invoke<TRet>(uri, std::forward<TArgs>(args)...);
+        pCache->insert(key, result, generation);
+        return result;
+    }
+
+    template <class TService>
+    void ServiceStub<TService>::setCache(const std::string &uri, const std::string &processName, const ServiceCache::Options &options) {
+        auto const pCache = std::make_shared<ServiceCache>(options);
+        m_pCaches.insert_or_assign(uri, pCache);
+        m_pInvalidatedCaches.insert_or_assign(makeInvalidateTopic(processName), pCache);
+    }
+
+    template <class TService>
+    template <typename T, typename... TArgs>
+    IServiceStreamPtr<T> ServiceStub<TService>::invokeStream(const std::string &uri, const size_t window, TArgs &&...args) const {
+        auto &self         = const_cast<ServiceStub &>(*this);
+        auto const pReader = std::make_shared<StreamReader<T>>(self, window);
+        pReader->open(uri, std::forward<TArgs>(args)...);
+        return pReader;
+    }
+
+#ifdef __cpp_impl_coroutine
+    template <class TService>
+    template <typename TRet, typename... TArgs>
+    typename ServiceStub<TService>::template InvokeAwaiter<TRet> ServiceStub<TService>::coInvoke(const std::string &uri, TArgs &&...args) {
+        return InvokeAwaiter<TRet>(*this, sendInvocation<TRet>(uri, std::forward<TArgs>(args)...));
+    }
+
+    template <class TService>
+    template <typename TRet, typename... TArgs>
+    typename ServiceStub<TService>::template InvokeAwaiter<TRet> ServiceStub<TService>::coInvoke(
+        const std::string &uri, TArgs &&...args) const {
+        auto &self = const_cast<ServiceStub &>(*this);
+        return self.coInvoke<TRet>(uri, std::forward<TArgs>(args)...);
+    }
+#endif
+
+    template <class TService>
+    template <typename TRet, typename... TArgs>
+    auto ServiceStub<TService>::sendInvocation(const std::string &uri, TArgs &&...args) {
+        auto const pClientDelegate = makeClientDelegate<TRet>();
+        dispatchInvocation<TRet>(pClientDelegate, uri, std::forward<TArgs>(args)...);
+        return pClientDelegate;
+    }
+
+    template <class TService>
+    template <typename TRet, typename TDelegate, typename... TArgs>
+    void ServiceStub<TService>::dispatchInvocation(const std::shared_ptr<TDelegate> &pDelegate, const std::string &uri, TArgs &&...args) {
+        // impl of the process: called directly, without serialization if the types match
+        if (auto const pSupplierDelegate = TheLocalMessaging.findCall(makeLocalUri(uri)); pSupplierDelegate != nullptr) {
+            using args_type = std::tuple<std::decay_t<TArgs>...>;
+            if (auto const pLocalCall = std::dynamic_pointer_cast<ILocalCall<TRet, args_type>>(pSupplierDelegate); pLocalCall != nullptr) {
+                pLocalCall->onLocalCall(args_type(std::forward<TArgs>(args)...), pDelegate);
+            } else {
+                auto const serializedParams = serializePayload(getWireEncoding(), std::make_tuple(std::forward<TArgs>(args)...));
+                pSupplierDelegate->onCallAsync(serializedParams, TheLocalMessaging.makeCallResult(pDelegate, pDelegate));
+            }
+            return;
+        }
+
+        // serialize parameters
+        auto const serializedParams = serializePayload(getWireEncoding(), std::make_tuple(std::forward<TArgs>(args)...));
+
+        // invoke the call
+#ifdef OSBASE_APPLICATION_SERVICE_TRACE
+        oslog::trace(data::OS_LOG_CHANNEL_APPLICATION) << "Call json : '" << serializedParams << "'" << oslog::end();
+#endif
+        getMessaging()->invoke(uri, serializedParams, pDelegate, pDelegate);
+    }
+
     template <class TService>
     template <typename TMessage>
     void ServiceStub<TService>::subscribe(const std::string &topic) {
-        auto pDelegate = std::make_shared<EventDelegate<TMessage>>(*this);
+        auto pDelegate = std::make_shared<EventDelegate<TMessage>>(*this, topic);
         m_pEventDelegates.insert(std::make_pair(topic, pDelegate));
 
+        TheLocalMessaging.subscribe(makeLocalUri(topic), pDelegate);
         getMessaging()->subscribe(topic, pDelegate, pDelegate);
     }
 
@@ -276,6 +732,7 @@ namespace NS_OSBASE::application {
             throw ServiceException("bad message type!");
         }
 
+        TheLocalMessaging.unsubscribe(makeLocalUri(topic), pEventDelegate);
         getMessaging()->unsubscribe(topic, pEventDelegate);
         m_pEventDelegates.erase(itEventDelegate);
     }
@@ -291,7 +748,15 @@ namespace NS_OSBASE::application {
 
         if (m_refCall == 0) {
             m_lastAliveTimeout = timeout;
-            m_pTaskAlive       = getTaskLoop()->pushSingleShot(timeout * s_factorAlivePeriod, [this]() {
+            m_pTaskAlive       = getTaskLoop()->pushSingleShot(timeout * s_factorAlivePeriod, [this, timeout]() {
+                // a reply received meanwhile proves the service is alive: wait for the next message
+                using clock          = std::chrono::steady_clock;
+                auto const lastReply = clock::time_point(clock::duration(m_lastReply.load(std::memory_order_relaxed)));
+                if (clock::now() - lastReply < timeout * s_factorAlivePeriod) {
+                    resetListenAliveMessage(timeout);
+                    return;
+                }
+
                 try {
                     // last chance: check if an rpc is reachable
                     auto const alivePeriod = std::chrono::milliseconds(getAlivePeriod());
@@ -333,6 +798,56 @@ namespace NS_OSBASE::application {
         listenAliveMessage(timeout);
     }
 
+    template <class TService>
+    bool ServiceStub<TService>::isLocalService() const {
+        return TheLocalMessaging.isServiceRegistered(makeLocalUri(getServiceName()));
+    }
+
+    template <class TService>
+    void ServiceStub<TService>::invalidateCache(const std::string &topic) {
+        if (auto const itCache = m_pInvalidatedCaches.find(topic); itCache != m_pInvalidatedCaches.cend()) {
+            itCache->second->clear();
+        }
+    }
+
+    template <class TService>
+    void ServiceStub<TService>::clearCaches() {
+        for (auto const &[uri, pCache] : m_pCaches) {
+            pCache->clear();
+        }
+    }
+
+    template <class TService>
+    std::string ServiceStub<TService>::makeStreamId() {
+        static const auto s_prefix = []() {
+            std::random_device device;
+            std::ostringstream os;
+            os << std::hex << device() << device();
+            return os.str();
+        }();
+        static std::atomic<unsigned long long> s_nbStreams = 0;
+
+        return s_prefix + "_" + std::to_string(++s_nbStreams);
+    }
+
+    template <class TService>
+    void ServiceStub<TService>::negotiateEncoding() {
+        setWireEncoding(ServiceEncoding::json);
+
+        auto const encoding = getEncoding();
+        if (encoding == ServiceEncoding::json || !isEncodingAvailable(encoding)) {
+            return;
+        }
+
+        try {
+            // the impl returns the encoding it publishes and accepts (unknown procedure for an impl without negotiation)
+            if (findEncoding(invoke<std::string>(makeFullUri(s_serviceGetEncodingUri))) == encoding) {
+                setWireEncoding(encoding);
+            }
+        } catch (const ServiceException &) {
+        }
+    }
+
     template <class TService>
     void ServiceStub<TService>::onConnected(const bool bConnected, const bool bQueued) {
         if (bQueued) {
@@ -356,6 +871,9 @@ namespace NS_OSBASE::application {
         }
 
         if (bConnected) {
+            clearCaches();                          // the invalidations published during the disconnection are lost
+            setWireEncoding(ServiceEncoding::json); // until the negotiation with the reconnected impl
+            getTaskLoop()->push([this]() { negotiateEncoding(); });
             listenAliveMessage(m_lastAliveTimeout);
         } else {
             stopListenAliveMessage();
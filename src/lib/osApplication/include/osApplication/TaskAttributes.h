@@ -0,0 +1,32 @@
+// \file  TaskAttributes.h
+// \brief Declaration of the priority and the attributes of the tasks
+
+#pragma once
+#include <chrono>
+#include <string>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief   Priority lanes of the tasks of a TaskQueue, from the highest to the lowest
+     * \ingroup PACKAGE_TASK
+     */
+    enum class TaskPriority {
+        critical,   //!< latency-critical tasks (ex: RPC), the immediate tasks are pushed in this lane
+        normal,     //!< default lane
+        background, //!< housekeeping tasks
+    };
+
+    /**
+     * \brief   Lane, deadline and key of a task pushed in a TaskQueue
+     * \ingroup PACKAGE_TASK
+     */
+    struct TaskAttributes {
+        TaskPriority priority              = TaskPriority::normal;             //!< lane of the task
+        std::chrono::milliseconds deadline = std::chrono::milliseconds::max(); //!< maximal delay between the timestamp of the task and its
+                                                                               //!< execution (earliest deadline first), none if max
+        std::string key;                                                       //!< key of the task: on overflow, replaces the pending task
+                                                                               //!< with the same key (TaskQueue::OverflowPolicy::coalesce)
+    };
+
+} // namespace NS_OSBASE::application
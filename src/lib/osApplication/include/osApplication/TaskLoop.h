@@ -3,6 +3,7 @@
 
 #pragma once
 #include "TaskLoopException.h"
+#include "TaskLoopStatistics.h"
 #include "TaskQueue.h"
 #include "osCore/Misc/NonCopyable.h"
 #include <future>
@@ -12,7 +13,16 @@
 
 namespace NS_OSBASE::application {
     class TaskLoop;
-    using TaskLoopPtr = std::shared_ptr<TaskLoop>; //!< Alias on shared pointers on TaskLoop
+    using TaskLoopPtr  = std::shared_ptr<TaskLoop>; //!< Alias on shared pointers on TaskLoop
+    using TaskLoopWPtr = std::weak_ptr<TaskLoop>;   //!< Alias on weak pointers on TaskLoop
+
+    class TaskLoopPool;
+
+#ifdef __cpp_impl_coroutine
+    template <typename T>
+    class CoTask;
+    class ScheduleAwaiter;
+#endif
 
     /**
      * \brief This class implement a loop over tasks
@@ -28,9 +38,36 @@ namespace NS_OSBASE::application {
      *
      * \throws RuntimeErrorException if no IRuntimeErrorDelegate is set
      *
+     * \par Batch size
+     * The loop takes the ready tasks by batches of at most getBatchSize() tasks (1 by default): all the tasks of a batch are taken in one
+     * critical section and executed back to back. The order of the tasks, the priority lanes and the immediate tasks are kept (see
+     * TaskQueue).
+     *
+     * \par Capacity
+     * The number of pending tasks is unbounded by default: setCapacity() bounds it with an overflow policy (see TaskQueue).
+     *
+     * \par Coalesced tasks
+     * pushCoalesced() replaces the pending task with the same key ("latest value wins"), pushCoalescedSingleShot() debounces and
+     * pushCoalescedRepeated() throttles the tasks with the same key (see TaskQueue).
+     *
+     * \par Instrumentation
+     * setStatisticsEnabled() records, per loop, the histograms of the scheduling delay (start of the task compared to its timestamp), of
+     * the execution time and of the queue depth, read by getStatistics(). setWatchdog() reports the tasks running longer than a threshold
+     * with the type of their callable. When both are disabled (default), the cost is a check of two flags per task.
+     *
+     * \par Coroutines
+     * When built in C++20 (option OSBASE_COROUTINES), the coroutines of type CoTask are executed on a loop by spawn(), and suspended
+     * without holding any thread by co_await schedule() or sleep() (see Coroutine.h).
+     *
+     * \par Strand
+     * A TaskLoop created by TaskLoopPool::makeStrand() is a strand: it doesn't own any thread, its tasks are executed by the workers of
+     * the pool. The tasks of a strand are still executed one at a time and in the same order than a TaskLoop.
+     *
      * \ingroup PACKAGE_TASK
      */
-    class TaskLoop : private core::NonCopyable {
+    class TaskLoop : private core::NonCopyable, public std::enable_shared_from_this<TaskLoop> {
+        friend class TaskLoopPool;
+
     public:
         using clock = TaskQueue::clock; //!< Alias for the clock used in TaskLoop
 
@@ -45,6 +82,24 @@ namespace NS_OSBASE::application {
         using IRuntimeErrorDelegatePtr  = std::shared_ptr<IRuntimeErrorDelegate>; //!< alias on shared pointer
         using IRuntimeErrorDelegateWPtr = std::weak_ptr<IRuntimeErrorDelegate>;   //!< alias on weak pointer
 
+        /**
+         * \brief Delegate called by the watchdog when a task is stalled
+         */
+        class IStallDelegate {
+        public:
+            virtual ~IStallDelegate() = default; //!< dtor
+
+            /**
+             * \brief   Called once per task running longer than the threshold of the watchdog (called by the thread of the watchdog)
+             * \param   taskType    name of the type of the callable of the task
+             * \param   duration    duration of the execution when the stall is detected
+             */
+            virtual void onStall(const std::string &taskType, const std::chrono::milliseconds &duration) = 0;
+        };
+        using IStallDelegatePtr  = std::shared_ptr<IStallDelegate>; //!< alias on shared pointer
+        using IStallDelegateWPtr = std::weak_ptr<IStallDelegate>;   //!< alias on weak pointer
+
+        TaskLoop();
         ~TaskLoop();
 
         /** \name For functions
@@ -57,6 +112,12 @@ namespace NS_OSBASE::application {
         template <typename TCallback, typename... TArgs>
         ITaskPtr push(TCallback &&callback, TArgs &&...args);
 
+        /**
+         * \copydoc TaskQueue::pushTask(TaskAttributes, TCallback &&, TArgs &&...)
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr push(TaskAttributes attributes, TCallback &&callback, TArgs &&...args);
+
         /**
          * \copydoc TaskQueue::pushImmediateTask
          */
@@ -69,11 +130,23 @@ namespace NS_OSBASE::application {
         template <typename TCallback, typename... TArgs>
         ITaskPtr pushSingleShot(const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
 
+        /**
+         * \copydoc TaskQueue::pushSingleShotTask(TaskAttributes, const std::chrono::milliseconds &, TCallback &&, TArgs &&...)
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushSingleShot(TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+
         /**
          * \copydoc TaskQueue::pushRepeatedTask
          */
         template <typename TCallback, typename... TArgs>
         ITaskPtr pushRepeated(const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \copydoc TaskQueue::pushRepeatedTask(TaskAttributes, const std::chrono::milliseconds &, TCallback &&, TArgs &&...)
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushRepeated(TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
         /** \} */
 
         /** \name For methods
@@ -86,6 +159,12 @@ namespace NS_OSBASE::application {
         template <typename TInstance, typename TMthCallback, typename... TArgs>
         ITaskPtr pushMethod(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
 
+        /**
+         * \copydoc TaskQueue::pushMethodTask(TaskAttributes, std::shared_ptr<TInstance>, TMthCallback &&, TArgs &&...)
+         */
+        template <typename TInstance, typename TMthCallback, typename... TArgs>
+        ITaskPtr pushMethod(TaskAttributes attributes, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
+
         /**
          * \copydoc TaskQueue::pushImmediateMethodTask
          */
@@ -99,12 +178,110 @@ namespace NS_OSBASE::application {
         ITaskPtr pushSingleShotMethod(
             const std::chrono::milliseconds &delay, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
 
+        /**
+         * \copydoc TaskQueue::pushSingleShotMethodTask(TaskAttributes, const std::chrono::milliseconds &, std::shared_ptr<TInstance>,
+         * TMthCallback &&, TArgs &&...)
+         */
+        template <typename TInstance, typename TMthCallback, typename... TArgs>
+        ITaskPtr pushSingleShotMethod(TaskAttributes attributes,
+            const std::chrono::milliseconds &delay,
+            std::shared_ptr<TInstance> pInstance,
+            TMthCallback &&mthCallback,
+            TArgs &&...args);
+
         /**
          * \copydoc TaskQueue::pushRepeatedMethodTask
          */
         template <typename TInstance, typename TMthCallback, typename... TArgs>
         ITaskPtr pushRepeatedMethod(
             const std::chrono::milliseconds &delay, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
+
+        /**
+         * \copydoc TaskQueue::pushRepeatedMethodTask(TaskAttributes, const std::chrono::milliseconds &, std::shared_ptr<TInstance>,
+         * TMthCallback &&, TArgs &&...)
+         */
+        template <typename TInstance, typename TMthCallback, typename... TArgs>
+        ITaskPtr pushRepeatedMethod(TaskAttributes attributes,
+            const std::chrono::milliseconds &delay,
+            std::shared_ptr<TInstance> pInstance,
+            TMthCallback &&mthCallback,
+            TArgs &&...args);
+        /** \} */
+
+        /** \name Coalesced
+         * \{
+         */
+
+        /**
+         * \copydoc TaskQueue::pushCoalescedTask(const std::string &, TCallback &&, TArgs &&...)
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalesced(const std::string &key, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \copydoc TaskQueue::pushCoalescedTask(TaskAttributes, TCallback &&, TArgs &&...)
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalesced(TaskAttributes attributes, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \copydoc TaskQueue::pushCoalescedSingleShotTask(const std::string &, const std::chrono::milliseconds &, TCallback &&,
+         * TArgs &&...)
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalescedSingleShot(
+            const std::string &key, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \copydoc TaskQueue::pushCoalescedSingleShotTask(TaskAttributes, const std::chrono::milliseconds &, TCallback &&, TArgs &&...)
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalescedSingleShot(
+            TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \copydoc TaskQueue::pushCoalescedRepeatedTask(const std::string &, const std::chrono::milliseconds &, TCallback &&,
+         * TArgs &&...)
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalescedRepeated(
+            const std::string &key, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \copydoc TaskQueue::pushCoalescedRepeatedTask(TaskAttributes, const std::chrono::milliseconds &, TCallback &&, TArgs &&...)
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalescedRepeated(
+            TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+        /** \} */
+
+        /** \name Fire-and-forget
+         * \{
+         */
+
+        /**
+         * \copydoc TaskQueue::postTask
+         */
+        template <typename TCallback, typename... TArgs>
+        void post(TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \copydoc TaskQueue::postTask(TaskAttributes, TCallback &&, TArgs &&...)
+         */
+        template <typename TCallback, typename... TArgs>
+        void post(TaskAttributes attributes, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \copydoc TaskQueue::postMethodTask
+         */
+        template <typename TInstance, typename TMthCallback, typename... TArgs>
+        void postMethod(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
+
+        /**
+         * \copydoc TaskQueue::postMethodTask(TaskAttributes, std::shared_ptr<TInstance>, TMthCallback &&, TArgs &&...)
+         */
+        template <typename TInstance, typename TMthCallback, typename... TArgs>
+        void postMethod(TaskAttributes attributes, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
         /** \} */
 
         /**
@@ -126,18 +303,130 @@ namespace NS_OSBASE::application {
         std::shared_future<void> runAsync();
 
         bool isRunning() const; //!< Indicates if the loop is waiting to execute tasks
+        bool isStrand() const;  //!< Indicates if the loop is a strand of a TaskLoopPool
         void stop();            //!< Stop the synchroneous or asynchroneous loop
 
         void setRuntimeErrorDelegate(IRuntimeErrorDelegatePtr pDelegate); //!< assign the delegate to call when a RuntimeErrorException is
                                                                           //!< thrown
 
+        size_t getBatchSize() const;               //!< Return the maximal number of ready tasks taken at once
+        void setBatchSize(const size_t batchSize); //!< Assign the maximal number of ready tasks taken at once (at least 1)
+
+        /**
+         * \copydoc TaskQueue::setCapacity
+         * \remark  With the policy block, the loop must run to unblock the producers. A strand blocked on the queue of another strand
+         * blocks a worker of the pool.
+         */
+        void setCapacity(const size_t capacity, const TaskQueue::OverflowPolicy policy);
+        size_t getCapacity() const;                              //!< \copydoc TaskQueue::getCapacity
+        TaskQueue::OverflowPolicy getOverflowPolicy() const;     //!< \copydoc TaskQueue::getOverflowPolicy
+        TaskQueue::OverflowCounters getOverflowCounters() const; //!< \copydoc TaskQueue::getOverflowCounters
+
+        /** \name Instrumentation
+         * \{
+         */
+
+        /**
+         * \brief   Enable or disable the recording of the statistics of the executed tasks
+         * \remark  Enabling the recording resets the statistics.
+         * \param   bEnabled    true to record the statistics
+         */
+        void setStatisticsEnabled(const bool bEnabled);
+        bool isStatisticsEnabled() const;         //!< Indicates if the statistics are recorded
+        TaskLoopStatistics getStatistics() const; //!< Return a snapshot of the statistics recorded since the last reset
+        void resetStatistics();                   //!< Remove the recorded statistics and restart the recording
+
+        /**
+         * \brief   Start a watchdog reporting the tasks running longer than the threshold
+         * \remark  The watchdog is a thread polling the running task: a stall is detected at most threshold / 2 after it exceeds the
+         *          threshold. Each stalled task is reported once. A null delegate or a zero threshold stops the watchdog.
+         * \param   threshold   maximal duration of the execution of a task
+         * \param   pDelegate   delegate called when a stall is detected
+         */
+        void setWatchdog(const std::chrono::milliseconds &threshold, IStallDelegatePtr pDelegate);
+        /** \} */
+
+#ifdef __cpp_impl_coroutine
+        /** \name Coroutines (C++20, include Coroutine.h)
+         * \{
+         */
+
+        /**
+         * \brief   Awaitable resuming the coroutine by a task of this loop (moves a CoTask to this loop)
+         */
+        ScheduleAwaiter schedule();
+
+        /**
+         * \brief   Same as schedule(), the coroutine is resumed by a task in the lane and with the deadline of the attributes
+         * \param   attributes  lane and deadline of the task resuming the coroutine
+         */
+        ScheduleAwaiter schedule(TaskAttributes attributes);
+
+        /**
+         * \brief   Awaitable resuming the coroutine by a task of this loop after the delay, without blocking the loop
+         * \param   delay       delay since now the coroutine is resumed
+         */
+        ScheduleAwaiter sleep(const std::chrono::milliseconds &delay);
+
+        /**
+         * \brief   Start the coroutine on this loop, without waiting for its end
+         * \remark  The frame of the coroutine is destroyed at its end. An exception thrown by the coroutine is re-thrown by a task of the
+         *          loop (see RuntimeErrorException management).
+         * \param   task        coroutine to start
+         */
+        template <typename T>
+        void spawn(CoTask<T> task);
+        /** \} */
+#endif
+
     private:
+        static constexpr size_t s_strandSliceSize = 64; // max number of tasks executed by a strand before yielding its worker
+
+        explicit TaskLoop(TaskLoopPool &pool);
+
+        class Watchdog;
+
+        void executeTask(InlineTask &task);
+        void executeGuardedTask(InlineTask &task);
+        void executeInstrumentedTask(InlineTask &task);
+        size_t executeBatch();
+        bool isCurrentThread() const;
+
+        void runStrand();
+        void scheduleStrand(); // after a push of a task ready now, without lock
+        void wakeUpStrand();   // schedules the strand at the timestamp of its next task
+        void onStrandWakeUp(const TaskQueue::time_point &timestamp);
+        void endStrand(std::exception_ptr pException);
+
         TaskQueue m_taskScheduler;
+        TaskQueue::Batch m_batch; // after m_taskScheduler: gives back its tasks before the queue is destroyed
+        std::atomic_size_t m_batchSize = 1;
         std::shared_future<void> m_asyncRunSharedReturn;
         std::atomic_bool m_bEnd = true;
         mutable std::recursive_mutex m_runningMutex;
         IRuntimeErrorDelegateWPtr m_pRuntimeErrorDelegate;
         std::atomic<std::thread::id> m_thId = std::this_thread::get_id();
+
+        // instrumentation
+        std::atomic_bool m_bStatisticsEnabled = false;
+        std::atomic_bool m_bWatchdogEnabled   = false;
+        Histogram m_schedulingDelay;
+        Histogram m_executionTime;
+        Histogram m_queueDepth;
+        std::atomic<clock::time_point> m_statisticsStart = clock::time_point();
+        std::atomic_uint64_t m_taskSequence              = 0; // 2 modulo 4 while a task is running, odd while written (watchdog)
+        std::atomic<clock::rep> m_taskStart              = 0;
+        std::atomic<const std::type_info *> m_pTaskType  = nullptr;
+        std::mutex m_watchdogMutex;
+        std::unique_ptr<Watchdog> m_pWatchdog;
+
+        // strand
+        TaskLoopPool *const m_pPool = nullptr;
+        std::atomic_bool m_bScheduled     = false;
+        std::atomic_bool m_bStrandRunning = false;
+        std::promise<void> m_strandEnd;
+        std::mutex m_wakeUpMutex;
+        TaskQueue::time_point m_wakeUpTimeStamp = TaskQueue::time_point::max();
     };
 } // namespace NS_OSBASE::application
 
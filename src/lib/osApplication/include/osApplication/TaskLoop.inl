@@ -6,46 +6,195 @@
 namespace NS_OSBASE::application {
     template <typename TCallback, typename... TArgs>
     ITaskPtr TaskLoop::push(TCallback &&callback, TArgs &&...args) {
-        return m_taskScheduler.pushTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        auto pTask = m_taskScheduler.pushTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+        return pTask;
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskLoop::push(TaskAttributes attributes, TCallback &&callback, TArgs &&...args) {
+        auto pTask = m_taskScheduler.pushTask(attributes, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+        return pTask;
     }
 
     template <typename TCallback, typename... TArgs>
     ITaskPtr TaskLoop::pushImmediate(TCallback &&callback, TArgs &&...args) {
-        return m_taskScheduler.pushImmediateTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        auto pTask = m_taskScheduler.pushImmediateTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+        return pTask;
     }
 
     template <typename TCallback, typename... TArgs>
     ITaskPtr TaskLoop::pushSingleShot(const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
-        return m_taskScheduler.pushSingleShotTask(delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        auto pTask = m_taskScheduler.pushSingleShotTask(delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushSingleShot(
+        TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        auto pTask =
+            m_taskScheduler.pushSingleShotTask(attributes, delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
     }
 
     template <typename TCallback, typename... TArgs>
     ITaskPtr TaskLoop::pushRepeated(const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
-        return m_taskScheduler.pushRepeatedTask(delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        auto pTask = m_taskScheduler.pushRepeatedTask(delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushRepeated(
+        TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        auto pTask = m_taskScheduler.pushRepeatedTask(attributes, delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
     }
 
     template <typename TInstance, typename TMthCallback, typename... TArgs>
     ITaskPtr TaskLoop::pushMethod(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
-        return m_taskScheduler.pushMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        auto pTask = m_taskScheduler.pushMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+        return pTask;
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushMethod(
+        TaskAttributes attributes, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
+        auto pTask =
+            m_taskScheduler.pushMethodTask(attributes, pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+        return pTask;
     }
 
     template <typename TInstance, typename TMthCallback, typename... TArgs>
     ITaskPtr TaskLoop::pushImmediateMethod(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
-        return m_taskScheduler.pushImmediateMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        auto pTask =
+            m_taskScheduler.pushImmediateMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+        return pTask;
     }
 
     template <typename TInstance, typename TMthCallback, typename... TArgs>
     ITaskPtr TaskLoop::pushSingleShotMethod(
         const std::chrono::milliseconds &delay, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
-        return m_taskScheduler.pushSingleShotMethodTask(
+        auto pTask = m_taskScheduler.pushSingleShotMethodTask(
             delay, pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushSingleShotMethod(TaskAttributes attributes,
+        const std::chrono::milliseconds &delay,
+        std::shared_ptr<TInstance> pInstance,
+        TMthCallback &&mthCallback,
+        TArgs &&...args) {
+        auto pTask = m_taskScheduler.pushSingleShotMethodTask(
+            attributes, delay, pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
     }
 
     template <typename TInstance, typename TMthCallback, typename... TArgs>
     ITaskPtr TaskLoop::pushRepeatedMethod(
         const std::chrono::milliseconds &delay, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
-        return m_taskScheduler.pushRepeatedMethodTask(
+        auto pTask = m_taskScheduler.pushRepeatedMethodTask(
             delay, pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushRepeatedMethod(TaskAttributes attributes,
+        const std::chrono::milliseconds &delay,
+        std::shared_ptr<TInstance> pInstance,
+        TMthCallback &&mthCallback,
+        TArgs &&...args) {
+        auto pTask = m_taskScheduler.pushRepeatedMethodTask(
+            attributes, delay, pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushCoalesced(const std::string &key, TCallback &&callback, TArgs &&...args) {
+        auto pTask = m_taskScheduler.pushCoalescedTask(key, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+        return pTask;
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushCoalesced(TaskAttributes attributes, TCallback &&callback, TArgs &&...args) {
+        auto pTask = m_taskScheduler.pushCoalescedTask(attributes, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+        return pTask;
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushCoalescedSingleShot(
+        const std::string &key, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        auto pTask =
+            m_taskScheduler.pushCoalescedSingleShotTask(key, delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushCoalescedSingleShot(
+        TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        auto pTask = m_taskScheduler.pushCoalescedSingleShotTask(
+            attributes, delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushCoalescedRepeated(
+        const std::string &key, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        auto pTask =
+            m_taskScheduler.pushCoalescedRepeatedTask(key, delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskLoop::pushCoalescedRepeated(
+        TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        auto pTask = m_taskScheduler.pushCoalescedRepeatedTask(
+            attributes, delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        wakeUpStrand();
+        return pTask;
+    }
+
+    template <typename TCallback, typename... TArgs>
+    void TaskLoop::post(TCallback &&callback, TArgs &&...args) {
+        m_taskScheduler.postTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+    }
+
+    template <typename TCallback, typename... TArgs>
+    void TaskLoop::post(TaskAttributes attributes, TCallback &&callback, TArgs &&...args) {
+        m_taskScheduler.postTask(attributes, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    void TaskLoop::postMethod(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
+        m_taskScheduler.postMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        scheduleStrand();
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    void TaskLoop::postMethod(
+        TaskAttributes attributes, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
+        m_taskScheduler.postMethodTask(attributes, pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+        scheduleStrand();
     }
 
 } // namespace NS_OSBASE::application
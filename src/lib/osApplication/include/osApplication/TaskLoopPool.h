@@ -0,0 +1,84 @@
+// \file  TaskLoopPool.h
+// \brief Declaration of the class TaskLoopPool
+
+#pragma once
+#include "TaskLoop.h"
+#include "osCore/Misc/NonCopyable.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NS_OSBASE::application {
+    class TaskLoopPool;
+    using TaskLoopPoolPtr = std::shared_ptr<TaskLoopPool>; //!< Alias on shared pointers on TaskLoopPool
+
+    /**
+     * \brief This class executes the tasks of a set of strands on a fixed number of worker threads
+     *
+     * \remark
+     * A strand is a TaskLoop created by makeStrand(): it keeps the ordering of a TaskLoop (one task at a time, sorted by timestamp) but
+     * doesn't own any thread. When a strand has ready tasks, it is queued on a worker. Each worker owns a deque of ready strands and
+     * steals the strands of the other workers when its own deque is empty, so different strands run in parallel. A worker takes the
+     * lock of its deque (or of the stolen one) only: the shared lock is taken to sleep when no strand is ready, and to wake it up.
+     *
+     * A worker stopping another strand of the pool (TaskLoop::stop()) executes the ready strands while it waits for its end: the
+     * strand is stopped even when all the workers wait.
+     *
+     * A strand is started by TaskLoop::run() (blocks until stopped) or TaskLoop::runAsync(), and can be passed wherever a TaskLoopPtr is
+     * expected (ServiceImpl, ServiceStub, StateMachine::create, ...).
+     *
+     * \remark The pool must outlive the strands it has created.
+     *
+     * \ingroup PACKAGE_TASK
+     */
+    class TaskLoopPool : private core::NonCopyable {
+        friend class TaskLoop;
+
+    public:
+        /**
+         * \brief   Create a pool and start its workers
+         * \param   nbWorkers   number of worker threads (at least 1)
+         */
+        static TaskLoopPoolPtr create(const size_t nbWorkers = std::thread::hardware_concurrency());
+
+        /**
+         * \brief   Return the pool shared by the process (one worker per hardware thread)
+         * \remark  The pool is created by the first call and destroyed with its last owner: the next call creates a new one.
+         */
+        static TaskLoopPoolPtr getShared();
+
+        ~TaskLoopPool();
+
+        TaskLoopPtr makeStrand();      //!< Create a strand executed by the workers of the pool
+        size_t getWorkerCount() const; //!< Return the number of worker threads
+
+    private:
+        struct Worker {
+            std::mutex mutex;
+            std::deque<TaskLoopPtr> readyStrands;
+            std::thread thread;
+        };
+
+        explicit TaskLoopPool(const size_t nbWorkers);
+
+        void schedule(TaskLoopPtr pStrand);
+        void scheduleAt(const TaskQueue::time_point &timestamp, TaskLoopWPtr pStrand);
+
+        void runWorker(const size_t nWorker);
+        TaskLoopPtr popStrand(const size_t nWorker);
+        bool isWorkerThread() const;                           // the current thread is a worker of the pool
+        void waitHelping(const std::shared_future<void> &end); // the worker executes the ready strands until the end
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        std::atomic_size_t m_nextWorker        = 0;
+        std::atomic_size_t m_nbReadyStrands    = 0; // at least the queued strands: incremented before the queueing
+        std::atomic_size_t m_nbSleepingWorkers = 0;
+        std::atomic_bool m_bEnd                = false;
+        std::mutex m_readyMutex; // sleep of the workers
+        std::condition_variable m_readyCV;
+        TaskLoop m_timerLoop;
+    };
+} // namespace NS_OSBASE::application
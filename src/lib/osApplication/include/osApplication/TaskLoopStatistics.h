@@ -0,0 +1,70 @@
+// \file  TaskLoopStatistics.h
+// \brief Declaration of the classes Histogram and TaskLoopStatistics
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief   This class counts the recorded values by power-of-two buckets
+     *
+     * \remark  The bucket 0 counts the value 0, the bucket i counts the values in [2^(i-1), 2^i - 1], the last bucket counts all the
+     * values above. Recording a value is lock-free and doesn't allocate: the histogram can be recorded by a thread and read by others (a
+     * read concurrent with a record may miss it).
+     *
+     * \ingroup PACKAGE_TASK
+     */
+    class Histogram {
+    public:
+        static constexpr std::size_t s_nbBuckets = 40; //!< number of buckets
+
+        Histogram() = default;
+        Histogram(const Histogram &other);
+        Histogram &operator=(const Histogram &other);
+
+        void record(const std::uint64_t value); //!< Count the value
+        void reset();                           //!< Remove all the recorded values
+
+        std::uint64_t getCount() const; //!< Return the number of recorded values
+        std::uint64_t getSum() const;   //!< Return the sum of the recorded values
+        std::uint64_t getMax() const;   //!< Return the maximal recorded value (0 if none)
+        double getMean() const;         //!< Return the mean of the recorded values (0 if none)
+
+        /**
+         * \brief   Return an upper bound of the percentile of the recorded values
+         * \param   percentile  percentile in [0, 100]
+         * \return  the upper bound of the bucket containing the percentile, at most the maximal recorded value (0 if none)
+         */
+        std::uint64_t getPercentile(const double percentile) const;
+
+        std::uint64_t getBucketCount(const std::size_t index) const;       //!< Return the number of values counted by the bucket
+        static std::uint64_t getBucketUpperBound(const std::size_t index); //!< Return the greatest value counted by the bucket
+        static std::size_t getBucketIndex(const std::uint64_t value);      //!< Return the index of the bucket counting the value
+
+    private:
+        std::array<std::atomic_uint64_t, s_nbBuckets> m_buckets{};
+        std::atomic_uint64_t m_count = 0;
+        std::atomic_uint64_t m_sum   = 0;
+        std::atomic_uint64_t m_max   = 0;
+    };
+
+    /**
+     * \brief   Snapshot of the statistics recorded by a TaskLoop
+     * \ingroup PACKAGE_TASK
+     */
+    struct TaskLoopStatistics {
+        Histogram schedulingDelay;                                              //!< delay from the timestamp to the start of the tasks (us)
+        Histogram executionTime;                                                //!< duration of the execution of the tasks (us)
+        Histogram queueDepth;                                                   //!< number of pending tasks when a task starts
+        std::chrono::milliseconds duration = std::chrono::milliseconds::zero(); //!< duration of the recording
+
+        std::uint64_t getNbTasks() const; //!< Return the number of executed tasks
+        double getTasksPerSecond() const; //!< Return the number of executed tasks per second during the recording
+    };
+
+} // namespace NS_OSBASE::application
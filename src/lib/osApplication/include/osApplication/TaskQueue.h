@@ -2,11 +2,19 @@
 // \brief Declaration of the class TaskQueue
 
 #pragma once
+#include "MpscRing.h"
 #include "Task.h"
+#include "TaskAttributes.h"
+#include "TimingWheel.h"
+#include "osCore/Misc/NonCopyable.h"
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
-#include <list>
 #include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
 
 namespace NS_OSBASE::application {
 
@@ -19,12 +27,81 @@ namespace NS_OSBASE::application {
      *  - push immediat: stores the task on top of the others if any (and so with no delay)
      *  - push single shot / repeated: stores the task at the time the method is invoked (now) plus a delay
      *
+     * The tasks are stored in a TimingWheel: the cost of a push does not depend on the number of pending tasks.
+     *
+     * Each task belongs to a priority lane (TaskAttributes::priority, TaskPriority::normal by default): the ready tasks of a lane are
+     * executed before the ready tasks of the lower lanes. To avoid the starvation of the lower lanes, a lane with ready tasks skipped
+     * s_starvationLimit times in a row executes its next task before the upper lanes. Inside a lane, the ready tasks with a deadline
+     * (TaskAttributes::deadline) are executed first, earliest deadline first, then the other ones by timestamp.
+     * The immediate tasks are pushed on top of the critical lane.
+     *
+     * The post functions push a fire-and-forget task at the timestamp now: no ITaskPtr is returned, so the task is stored as an InlineTask
+     * (no shared control block, no allocation for the small callbacks). pullNextTask() and waitForNextTask() return the tasks as
+     * InlineTask so that the fire-and-forget tasks are never converted to ITaskPtr.
+     *
+     * pullNextTasks() and waitForNextTasks() take all the ready tasks (up to a limit) in one critical section: the tasks are then popped
+     * from the Batch without locking the queue. A pushed critical task (immediate or not) is still executed before the remaining tasks of
+     * the batch: the batch is interrupted and its remaining tasks are given back to the queue, behind the immediate tasks.
+     *
+     * The tasks pushed or posted at the timestamp now (the most frequent ones, usually from other threads) don't take the lock of the
+     * queue: they are stored in a lock-free intake ring, merged in the TimingWheel by the consumer (or any call taking the lock). The
+     * waiting consumer is notified only if it is actually sleeping. The other pushes, and the pushes when the ring is full, take the lock.
+     *
+     * The coalesced tasks are keyed "latest value wins" tasks: a push replaces the pending task with the same key instead of storing
+     * another one (O(1) lookup). The single shot coalesced tasks are debounced (executed after the delay since the last push) and the
+     * repeated coalesced tasks are throttled (the last pushed callback is executed at most once per delay).
+     *
+     * The number of pending tasks is unbounded by default. setCapacity() bounds it: a push on a full queue is handled according to the
+     * OverflowPolicy (a rejected push returns a null task) and counted in the OverflowCounters.
+     *
      * \ingroup PACKAGE_TASK
      */
     class TaskQueue {
+        using Entry = TimingWheel::Entry;
+
     public:
-        using clock      = std::chrono::system_clock; //!< alias for the clock used in the TaskQueue
-        using time_point = clock::time_point;         //!< alias for the time point used in the TaskQueue
+        using clock      = TimingWheel::clock;      //!< alias for the clock used in the TaskQueue
+        using time_point = TimingWheel::time_point; //!< alias for the time point used in the TaskQueue
+
+        /**
+         * \brief Behavior of a push when the queue is full (see setCapacity())
+         */
+        enum class OverflowPolicy {
+            block,      //!< the producer waits until a task is pulled (the thread pulling the tasks is never blocked)
+            dropOldest, //!< the first pushed ready task of the lowest lane having one, not above the lane of the pushed task, is dropped
+            dropNewest, //!< the pushed task is rejected
+            coalesce,   //!< the pushed task replaces the pending task with the same key (TaskAttributes::key), rejected if none
+        };
+
+        /**
+         * \brief Counters of the overflows of a TaskQueue
+         */
+        struct OverflowCounters {
+            std::uint64_t nbRejectedTasks = 0; //!< number of pushed tasks not stored (dropNewest, coalesce without pending task)
+            std::uint64_t nbDroppedTasks  = 0; //!< number of pending tasks dropped (dropOldest) or replaced (coalesce)
+            std::uint64_t nbBlockedPushes = 0; //!< number of pushes having waited for a free place (block)
+        };
+
+        /**
+         * \brief Ready tasks taken at once from a TaskQueue
+         */
+        class Batch : private core::NonCopyable {
+            friend class TaskQueue;
+
+        public:
+            Batch() = default;
+            ~Batch(); //!< give back the remaining tasks to their queue
+
+            InlineTask pop();   //!< Return the next task, empty if the batch is empty or interrupted by a critical task
+            bool empty() const; //!< Indicates if all the tasks have been popped
+            void clear();       //!< Give back the remaining tasks to their queue
+
+        private:
+            TaskQueue *m_pTaskQueue = nullptr;
+            std::vector<Entry> m_entries;
+            size_t m_nextEntry           = 0;
+            std::uint64_t m_nbCriticals = 0; // number of critical tasks pushed in the queue when the batch was taken
+        };
 
         /** \name For functions
          * \{
@@ -38,6 +115,15 @@ namespace NS_OSBASE::application {
         template <typename TCallback, typename... TArgs>
         ITaskPtr pushTask(TCallback &&callback, TArgs &&...args);
 
+        /**
+         * \brief   Push a task at the timestamp now, in the lane and with the deadline of the attributes
+         * \param   attributes  lane and deadline of the task
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushTask(TaskAttributes attributes, TCallback &&callback, TArgs &&...args);
+
         /**
          * \brief   Push a task on top of the others if any, at the timestamp now
          * \param   callback    function to invoke when executing the task
@@ -56,6 +142,17 @@ namespace NS_OSBASE::application {
         template <typename TCallback, typename... TArgs>
         ITaskPtr pushSingleShotTask(const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
 
+        /**
+         * \brief   Push a task at the timestamp now plus the delay, in the lane and with the deadline of the attributes
+         * \param   attributes  lane and deadline of the task
+         * \param   delay       delay since now the callback is invoked
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushSingleShotTask(
+            TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+
         /**
          * \brief   Push a task at the timestamp now plus the delay, pushed again after wait or pull at this timestamp plus the delay
          * \param   delay       delay since now the callback is invoked
@@ -64,6 +161,16 @@ namespace NS_OSBASE::application {
          */
         template <typename TCallback, typename... TArgs>
         ITaskPtr pushRepeatedTask(const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \brief   Push a repeated task, in the lane and with the deadline of the attributes (applied to each repetition)
+         * \param   attributes  lane and deadline of the task
+         * \param   delay       delay since now the callback is invoked
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushRepeatedTask(TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
         /** \} */
 
         /** \name For methods
@@ -79,6 +186,17 @@ namespace NS_OSBASE::application {
         template <typename TInstance, typename TMthCallback, typename... TArgs>
         ITaskPtr pushMethodTask(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
 
+        /**
+         * \brief   Push a method task at the timestamp now, in the lane and with the deadline of the attributes
+         * \param   attributes  lane and deadline of the task
+         * \param   pInstance   shared pointer of the instance associated to the method
+         * \param   mthCallback method to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TInstance, typename TMthCallback, typename... TArgs>
+        ITaskPtr pushMethodTask(
+            TaskAttributes attributes, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
+
         /**
          * \brief   Push a method task on top of the others if any, at the timestamp now
          * \param   pInstance   shared pointer of the instance associated to the method
@@ -99,6 +217,21 @@ namespace NS_OSBASE::application {
         ITaskPtr pushSingleShotMethodTask(
             const std::chrono::milliseconds &delay, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
 
+        /**
+         * \brief   Push a method task at the timestamp now plus the delay, in the lane and with the deadline of the attributes
+         * \param   attributes  lane and deadline of the task
+         * \param   delay       delay since now the callback is invoked
+         * \param   pInstance   shared pointer of the instance associated to the method
+         * \param   mthCallback method to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TInstance, typename TMthCallback, typename... TArgs>
+        ITaskPtr pushSingleShotMethodTask(TaskAttributes attributes,
+            const std::chrono::milliseconds &delay,
+            std::shared_ptr<TInstance> pInstance,
+            TMthCallback &&mthCallback,
+            TArgs &&...args);
+
         /**
          * \brief   Push a method task at the timestamp now plus the delay, pushed again after wait or pull at this timestamp plus the delay
          * \param   delay       delay since now the callback is invoked
@@ -109,6 +242,131 @@ namespace NS_OSBASE::application {
         template <typename TInstance, typename TMthCallback, typename... TArgs>
         ITaskPtr pushRepeatedMethodTask(
             const std::chrono::milliseconds &delay, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
+
+        /**
+         * \brief   Push a repeated method task, in the lane and with the deadline of the attributes (applied to each repetition)
+         * \param   attributes  lane and deadline of the task
+         * \param   delay       delay since now the callback is invoked
+         * \param   pInstance   shared pointer of the instance associated to the method
+         * \param   mthCallback method to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TInstance, typename TMthCallback, typename... TArgs>
+        ITaskPtr pushRepeatedMethodTask(TaskAttributes attributes,
+            const std::chrono::milliseconds &delay,
+            std::shared_ptr<TInstance> pInstance,
+            TMthCallback &&mthCallback,
+            TArgs &&...args);
+        /** \} */
+
+        /** \name Coalesced
+         * \{
+         */
+
+        /**
+         * \brief   Push a task at the timestamp now, or replace the callback of the pending task with the same key (at its place)
+         * \param   key         key of the task
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         * \return  the pending task with the key, executing the last pushed callback
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalescedTask(const std::string &key, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \brief   Same as pushCoalescedTask(), in the lane and with the deadline and the key (not empty) of the attributes
+         * \param   attributes  lane, deadline and key of the task
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalescedTask(TaskAttributes attributes, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \brief   Push a task at the timestamp now plus the delay, cancelling the pending task with the same key (debounce)
+         * \param   key         key of the task
+         * \param   delay       delay since now the callback is invoked
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalescedSingleShotTask(
+            const std::string &key, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \brief   Same as pushCoalescedSingleShotTask(), in the lane and with the deadline and the key (not empty) of the attributes
+         * \param   attributes  lane, deadline and key of the task
+         * \param   delay       delay since now the callback is invoked
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalescedSingleShotTask(
+            TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \brief   Push a repeated task, or replace the callback of the repeated task with the same key (throttle)
+         * \remark  The delay of an existing repeated task is not modified: its next repetition executes the last pushed callback.
+         * \param   key         key of the task
+         * \param   delay       delay since now the callback is invoked
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalescedRepeatedTask(
+            const std::string &key, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \brief   Same as pushCoalescedRepeatedTask(), in the lane and with the deadline and the key (not empty) of the attributes
+         * \param   attributes  lane, deadline and key of the task
+         * \param   delay       delay since now the callback is invoked
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TCallback, typename... TArgs>
+        ITaskPtr pushCoalescedRepeatedTask(
+            TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args);
+        /** \} */
+
+        /** \name Fire-and-forget
+         * \{
+         */
+
+        /**
+         * \brief   Push a task at the timestamp now, with no handle on it
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TCallback, typename... TArgs>
+        void postTask(TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \brief   Push a task at the timestamp now, with no handle on it, in the lane and with the deadline of the attributes
+         * \param   attributes  lane and deadline of the task
+         * \param   callback    function to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TCallback, typename... TArgs>
+        void postTask(TaskAttributes attributes, TCallback &&callback, TArgs &&...args);
+
+        /**
+         * \brief   Push a method task at the timestamp now, with no handle on it
+         * \param   pInstance   shared pointer of the instance associated to the method
+         * \param   mthCallback method to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TInstance, typename TMthCallback, typename... TArgs>
+        void postMethodTask(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
+
+        /**
+         * \brief   Push a method task at the timestamp now, with no handle on it, in the lane and with the deadline of the attributes
+         * \param   attributes  lane and deadline of the task
+         * \param   pInstance   shared pointer of the instance associated to the method
+         * \param   mthCallback method to invoke when executing the task
+         * \param   args        arguments to pass to the callback
+         */
+        template <typename TInstance, typename TMthCallback, typename... TArgs>
+        void postMethodTask(TaskAttributes attributes, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args);
         /** \} */
 
         ITaskPtr pullTask(); //!< return the next available task
@@ -116,26 +374,129 @@ namespace NS_OSBASE::application {
         ITaskPtr waitForTask(const std::chrono::milliseconds &delay = std::chrono::milliseconds::max()); //!< Wait until the delay expired
                                                                                                          //!< or a task is available
         ITaskPtr waitUntilTask(const time_point &timestamp); //!< Wait until the timestamp is reached or a task is available
+        InlineTask pullNextTask();                           //!< pullTask() without conversion of the fire-and-forget tasks
+        InlineTask waitForNextTask(const std::chrono::milliseconds &delay = std::chrono::milliseconds::max()); //!< waitForTask() without
+                                                                                                               //!< conversion of the
+                                                                                                               //!< fire-and-forget tasks
+
+        /**
+         * \brief   Take the ready tasks
+         * \param   batch       batch receiving the tasks (its previous tasks are given back)
+         * \param   maxCount    maximal number of tasks to take
+         */
+        void pullNextTasks(Batch &batch, const size_t maxCount);
+
+        /**
+         * \brief   Wait until the delay expired or a task is available, then take the ready tasks
+         * \param   batch       batch receiving the tasks (its previous tasks are given back)
+         * \param   maxCount    maximal number of tasks to take
+         * \param   delay       maximal delay to wait
+         */
+        void waitForNextTasks(
+            Batch &batch, const size_t maxCount, const std::chrono::milliseconds &delay = std::chrono::milliseconds::max());
         bool isRemainingTasks() const;                       //!< Indicates if tasks are still present
+        time_point getNextTimeStamp();                       //!< Return the timestamp of the next task, time_point::max() if none
         void clearTasks();                                   //!< Remove all the pending tasks
 
         const time_point &getLastTimeStamp() const; //!< Return the timestamp of the last waited of pulled task
 
+        /**
+         * \brief   Bound the number of pending tasks
+         * \remark  The repetitions of the repeated tasks and the tasks given back by a batch are always stored, and a repeated task is
+         * never dropped.
+         * With the policy block, the thread pulling the tasks (the creator of the queue until the first pull) is never blocked, and a
+         * push waits as long as no task is pulled.
+         * \param   capacity    maximal number of pending tasks, 0 for unbounded (default)
+         * \param   policy      behavior of a push when the queue is full
+         */
+        void setCapacity(const size_t capacity, const OverflowPolicy policy);
+        size_t getCapacity() const;                   //!< Return the maximal number of pending tasks, 0 if unbounded
+        OverflowPolicy getOverflowPolicy() const;     //!< Return the behavior of a push when the queue is full
+        OverflowCounters getOverflowCounters() const; //!< Return the counters of the overflows since the creation of the queue
+        size_t getNbTasks() const;                    //!< Return the number of pending tasks
+
+        static constexpr size_t s_starvationLimit = 16; //!< number of tasks of the upper lanes executed in a row before a ready lane
+
     private:
-        struct ScheduledTask {
-            time_point timestamp;
-            ITaskPtr pTask;
-            std::chrono::milliseconds delayRepetition;
+        using Locker = std::unique_lock<std::mutex>;
+
+        static constexpr size_t s_intakeCapacity = 256;
+        static constexpr size_t s_nbLanes        = 3;
+
+        enum class Admission { accepted, coalesced, rejected };
+        enum class Coalescing { replace, debounce, throttle };
+
+        class CoalescedTask;
+        using CoalescedTaskPtr = std::shared_ptr<CoalescedTask>;
+
+        struct Lane {
+            TimingWheel scheduledTasks;    // tasks without deadline
+            TimingWheel deadlineTasks;     // tasks with a deadline, not ready yet
+            std::vector<Entry> readyTasks; // binary heap of the ready tasks with a deadline, earliest deadline on top
+            size_t nbSkips = 0;            // number of tasks of the other lanes executed in a row while the lane was ready
         };
 
-        ITaskPtr pushScheduledTask(
-            const time_point &timeStampRef, const std::chrono::milliseconds &delay, ITaskPtr pTask, const bool bRepeated);
-        ITaskPtr popTask(const time_point &timeStamp);
+        ITaskPtr pushScheduledTask(const TaskAttributes &attributes,
+            const time_point &timeStampRef,
+            const std::chrono::milliseconds &delay,
+            ITaskPtr pTask,
+            const bool bRepeated);
+        void pushScheduledTask(Locker &locker, const time_point &timeStampRef, const std::chrono::milliseconds &delay, Entry &&entry);
+        void postScheduledTask(const TaskAttributes &attributes, InlineTask &&task);
+        ITaskPtr pushCoalescedScheduledTask(
+            const TaskAttributes &attributes, const std::chrono::milliseconds &delay, ITaskPtr pTask, const Coalescing coalescing);
+        CoalescedTaskPtr findCoalescedTask(const std::string &key);
+        void forgetCoalescedTask(const Entry &entry);
+        void takeCoalescedTask(Entry &entry);
+        void pushIntakeTask(Entry &&entry);
+        Admission admitEntry(Entry &entry);
+        Admission admitOverflowEntry(Locker &locker, Entry &entry);
+        bool tryReserveTask(const size_t capacity);
+        void releaseTask();
+        bool dropOldestEntry(const TaskPriority priority);
+        bool coalesceEntry(Entry &entry);
+        void mergeIntakeTasks(Locker &locker);
+        void storeEntry(Entry &&entry);
+        void restoreEntry(Entry &&entry);
+        bool hasEntries() const;
+        time_point getTopTimeStamp();
+        std::optional<Entry> pullEntry();
+        std::optional<Entry> waitUntilEntry(const time_point &timestamp);
+        bool isReadyTask(Locker &locker);
+        bool waitUntilReadyTask(Locker &locker, const time_point &timestamp);
+        std::optional<Entry> popReadyEntry(Locker &locker, const time_point &now);
+        void takeEntries(Locker &locker, Batch &batch, const size_t maxCount);
+        void giveBackEntries(Batch &batch);
 
-        std::list<ScheduledTask> m_scheduledTasks;
+        Lane &getLane(const TaskPriority priority);
+        static bool isReadyLane(Lane &lane, const time_point &now);
+        static Entry popLaneEntry(Lane &lane);
+        static time_point getDeadline(const Entry &entry);
+        static bool isLaterDeadline(const Entry &lhs, const Entry &rhs);
+        static ITaskPtr toTaskPtr(std::optional<Entry> &&entry);
+        static InlineTask toInlineTask(std::optional<Entry> &&entry);
+
+        std::array<Lane, s_nbLanes> m_lanes;             // indexed by TaskPriority
+        MpscRing<Entry, s_intakeCapacity> m_intakeTasks; // tasks pushed at now without lock, popped by the owner of the lock
+        std::atomic_bool m_bConsumerWaiting = false;     // set while the consumer waits on the condition variable
         mutable std::mutex m_scheduledTasksMutex;
         std::condition_variable m_scheduledTasksCV;
-        time_point m_lastTimeStamp = std::chrono::time_point<clock>::min();
+        time_point m_lastTimeStamp         = std::chrono::time_point<clock>::min();
+        std::atomic_uint64_t m_nbCriticals = 0;         // number of pushed critical tasks (immediate ones included), checked by the batches
+        std::optional<time_point> m_immediateTimeStamp; // timestamp of the first immediate task pushed after the last batch taken
+        std::unordered_map<std::string, CoalescedTaskPtr> m_coalescedTasks; // pending coalesced tasks by key
+        std::uint64_t m_sequence = 0;                                         // order of insertion of the entries, over all the lanes
+
+        // capacity
+        std::atomic_size_t m_capacity                = 0; // 0: unbounded
+        std::atomic<OverflowPolicy> m_overflowPolicy = OverflowPolicy::block;
+        std::atomic_size_t m_nbTasks                 = 0; // number of pending tasks, intake ring included
+        std::atomic_uint64_t m_nbRejectedTasks       = 0;
+        std::atomic_uint64_t m_nbDroppedTasks        = 0;
+        std::atomic_uint64_t m_nbBlockedPushes       = 0;
+        std::condition_variable m_notFullCV;
+        size_t m_nbBlockedProducers        = 0;                          // number of producers waiting on m_notFullCV
+        std::thread::id m_consumerThreadId = std::this_thread::get_id(); // thread having pulled the last tasks, never blocked
     };
 
 } // namespace NS_OSBASE::application
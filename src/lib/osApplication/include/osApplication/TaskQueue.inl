@@ -6,8 +6,13 @@
 namespace NS_OSBASE::application {
     template <typename TCallback, typename... TArgs>
     ITaskPtr TaskQueue::pushTask(TCallback &&callback, TArgs &&...args) {
-        using namespace std::chrono_literals;
-        return pushScheduledTask(clock::now(),
+        return pushTask(TaskAttributes(), std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushTask(TaskAttributes attributes, TCallback &&callback, TArgs &&...args) {
+        return pushScheduledTask(attributes,
+            clock::now(),
             std::chrono::milliseconds::zero(),
             makeTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...),
             false);
@@ -15,8 +20,8 @@ namespace NS_OSBASE::application {
 
     template <typename TCallback, typename... TArgs>
     ITaskPtr TaskQueue::pushImmediateTask(TCallback &&callback, TArgs &&...args) {
-        using namespace std::chrono_literals;
-        return pushScheduledTask(clock::now(),
+        return pushScheduledTask(TaskAttributes{ TaskPriority::critical },
+            clock::now(),
             std::chrono::milliseconds::min(),
             makeTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...),
             false);
@@ -24,18 +29,38 @@ namespace NS_OSBASE::application {
 
     template <typename TCallback, typename... TArgs>
     ITaskPtr TaskQueue::pushSingleShotTask(const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
-        return pushScheduledTask(clock::now(), delay, makeTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...), false);
+        return pushSingleShotTask(TaskAttributes(), delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushSingleShotTask(
+        TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        return pushScheduledTask(
+            attributes, clock::now(), delay, makeTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...), false);
     }
 
     template <typename TCallback, typename... TArgs>
     ITaskPtr TaskQueue::pushRepeatedTask(const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
-        return pushScheduledTask(clock::now(), delay, makeTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...), true);
+        return pushRepeatedTask(TaskAttributes(), delay, std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushRepeatedTask(
+        TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        return pushScheduledTask(
+            attributes, clock::now(), delay, makeTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...), true);
     }
 
     template <typename TInstance, typename TMthCallback, typename... TArgs>
     ITaskPtr TaskQueue::pushMethodTask(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
-        using namespace std::chrono_literals;
-        return pushScheduledTask(clock::now(),
+        return pushMethodTask(TaskAttributes(), pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushMethodTask(
+        TaskAttributes attributes, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
+        return pushScheduledTask(attributes,
+            clock::now(),
             std::chrono::milliseconds::zero(),
             makeMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...),
             false);
@@ -43,8 +68,8 @@ namespace NS_OSBASE::application {
 
     template <typename TInstance, typename TMthCallback, typename... TArgs>
     ITaskPtr TaskQueue::pushImmediateMethodTask(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
-        using namespace std::chrono_literals;
-        return pushScheduledTask(clock::now(),
+        return pushScheduledTask(TaskAttributes{ TaskPriority::critical },
+            clock::now(),
             std::chrono::milliseconds::min(),
             makeMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...),
             false);
@@ -53,15 +78,110 @@ namespace NS_OSBASE::application {
     template <typename TInstance, typename TMthCallback, typename... TArgs>
     ITaskPtr TaskQueue::pushSingleShotMethodTask(
         const std::chrono::milliseconds &delay, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
-        return pushScheduledTask(
-            clock::now(), delay, makeMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...), false);
+        return pushSingleShotMethodTask(
+            TaskAttributes(), delay, pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushSingleShotMethodTask(TaskAttributes attributes,
+        const std::chrono::milliseconds &delay,
+        std::shared_ptr<TInstance> pInstance,
+        TMthCallback &&mthCallback,
+        TArgs &&...args) {
+        return pushScheduledTask(attributes,
+            clock::now(),
+            delay,
+            makeMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...),
+            false);
     }
 
     template <typename TInstance, typename TMthCallback, typename... TArgs>
     ITaskPtr TaskQueue::pushRepeatedMethodTask(
         const std::chrono::milliseconds &delay, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
-        return pushScheduledTask(
-            clock::now(), delay, makeMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...), true);
+        return pushRepeatedMethodTask(
+            TaskAttributes(), delay, pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushRepeatedMethodTask(TaskAttributes attributes,
+        const std::chrono::milliseconds &delay,
+        std::shared_ptr<TInstance> pInstance,
+        TMthCallback &&mthCallback,
+        TArgs &&...args) {
+        return pushScheduledTask(attributes,
+            clock::now(),
+            delay,
+            makeMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...),
+            true);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushCoalescedTask(const std::string &key, TCallback &&callback, TArgs &&...args) {
+        return pushCoalescedTask(TaskAttributes{ TaskPriority::normal, std::chrono::milliseconds::max(), key },
+            std::forward<TCallback>(callback),
+            std::forward<TArgs>(args)...);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushCoalescedTask(TaskAttributes attributes, TCallback &&callback, TArgs &&...args) {
+        return pushCoalescedScheduledTask(attributes,
+            std::chrono::milliseconds::zero(),
+            makeTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...),
+            Coalescing::replace);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushCoalescedSingleShotTask(
+        const std::string &key, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        return pushCoalescedSingleShotTask(TaskAttributes{ TaskPriority::normal, std::chrono::milliseconds::max(), key },
+            delay,
+            std::forward<TCallback>(callback),
+            std::forward<TArgs>(args)...);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushCoalescedSingleShotTask(
+        TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        return pushCoalescedScheduledTask(
+            attributes, delay, makeTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...), Coalescing::debounce);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushCoalescedRepeatedTask(
+        const std::string &key, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        return pushCoalescedRepeatedTask(TaskAttributes{ TaskPriority::normal, std::chrono::milliseconds::max(), key },
+            delay,
+            std::forward<TCallback>(callback),
+            std::forward<TArgs>(args)...);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    ITaskPtr TaskQueue::pushCoalescedRepeatedTask(
+        TaskAttributes attributes, const std::chrono::milliseconds &delay, TCallback &&callback, TArgs &&...args) {
+        return pushCoalescedScheduledTask(
+            attributes, delay, makeTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...), Coalescing::throttle);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    void TaskQueue::postTask(TCallback &&callback, TArgs &&...args) {
+        postTask(TaskAttributes(), std::forward<TCallback>(callback), std::forward<TArgs>(args)...);
+    }
+
+    template <typename TCallback, typename... TArgs>
+    void TaskQueue::postTask(TaskAttributes attributes, TCallback &&callback, TArgs &&...args) {
+        postScheduledTask(attributes, makeInlineTask(std::forward<TCallback>(callback), std::forward<TArgs>(args)...));
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    void TaskQueue::postMethodTask(std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
+        postMethodTask(TaskAttributes(), pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...);
+    }
+
+    template <typename TInstance, typename TMthCallback, typename... TArgs>
+    void TaskQueue::postMethodTask(
+        TaskAttributes attributes, std::shared_ptr<TInstance> pInstance, TMthCallback &&mthCallback, TArgs &&...args) {
+        postScheduledTask(
+            attributes, makeInlineMethodTask(pInstance, std::forward<TMthCallback>(mthCallback), std::forward<TArgs>(args)...));
     }
 
 } // namespace NS_OSBASE::application
@@ -0,0 +1,106 @@
+// \file  TimingWheel.h
+// \brief Declaration of the class TimingWheel
+
+#pragma once
+#include "InlineTask.h"
+#include "Task.h"
+#include "TaskAttributes.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace NS_OSBASE::application {
+
+    /**
+     * \brief   This class stores the scheduled tasks of a TaskQueue sorted by timestamp
+     *
+     * \remark  The storage is splitted in two parts:
+     *  - a binary heap for the near-term tasks (timestamp before the horizon): O(log n) insertion and removal
+     *  - a hierarchical timing wheel for the far-future tasks: O(1) insertion, the tasks are moved to the heap when the horizon reaches
+     *  them (each task is cascaded at most once per level)
+     *
+     * The storage of the heaps and of the slots is kept when entries are removed: once warmed up, the wheel doesn't allocate anymore.
+     * The tasks with the same timestamp are sorted according their order of insertion (FIFO).
+     * A task is cancelled by disabling it (ITypedTask::setEnabled): O(1), the entry is removed when it is reached.
+     *
+     * \ingroup PACKAGE_TASK
+     */
+    class TimingWheel {
+    public:
+        using clock      = std::chrono::system_clock; //!< alias for the clock used in the TimingWheel
+        using time_point = clock::time_point;         //!< alias for the time point used in the TimingWheel
+
+        /**
+         * \brief Scheduled task stored in the wheel
+         */
+        struct Entry {
+            time_point timestamp;                      //!< timestamp of the execution
+            ITaskPtr pTask;                            //!< task to execute
+            std::chrono::milliseconds delayRepetition; //!< delay of repetition, negative for a single execution
+            std::uint64_t sequence = 0;                //!< order of insertion (assigned by push)
+            InlineTask task;                           //!< task to execute if pTask is null (fire-and-forget)
+            TaskAttributes attributes;                 //!< lane, deadline and key of the task (not used by the wheel)
+        };
+
+        void push(Entry entry);   //!< Store the entry
+        void repush(Entry entry); //!< Store again a popped entry, keeping its order of insertion
+        const Entry &top();       //!< Return the entry with the smallest timestamp (the wheel must not be empty)
+        Entry pop();              //!< Remove and return the entry with the smallest timestamp (the wheel must not be empty)
+        bool empty() const;       //!< Indicates if no entry is stored
+        std::size_t size() const; //!< Return the number of stored entries
+
+        /**
+         * \brief   Return a stored entry satisfying the predicate, in no particular order: O(n)
+         * \remark  The timestamp and the sequence of the returned entry must not be modified (the order of the storage)
+         * \param   predicate   predicate on the entries
+         * \return  null if no entry satisfies the predicate
+         */
+        Entry *findIf(const std::function<bool(const Entry &)> &predicate);
+
+        /**
+         * \brief   Return the first inserted entry satisfying the predicate (smallest sequence): O(n)
+         * \param   predicate   predicate on the entries
+         * \return  null if no entry satisfies the predicate
+         */
+        Entry *findFirstIf(const std::function<bool(const Entry &)> &predicate);
+
+        /**
+         * \brief   Remove and return a stored entry: O(n)
+         * \param   pEntry  entry returned by findIf() or findFirstIf(), not modified by another call since
+         * \return  the removed entry
+         */
+        Entry extract(const Entry *pEntry);
+        void clear(); //!< Remove all the entries
+
+    private:
+        static constexpr std::size_t s_slotBits = 6;
+        static constexpr std::size_t s_nbSlots  = std::size_t(1) << s_slotBits;
+        static constexpr std::size_t s_nbLevels = 4;
+
+        using tick_type = std::int64_t;
+        using Slot      = std::vector<Entry>;
+
+        struct Level {
+            std::array<Slot, s_nbSlots> slots;
+            std::uint64_t occupancy = 0;
+        };
+
+        static tick_type toTick(const time_point &timestamp);
+        static bool isAfter(const Entry &lhs, const Entry &rhs);
+
+        void pushHeap(Entry &&entry);
+        void pushWheel(Entry &&entry);
+        void normalize();
+
+        std::vector<Entry> m_nearTasks;     // binary heap of the tasks before the horizon
+        std::array<Level, s_nbLevels> m_levels;
+        std::vector<Entry> m_overflowTasks; // binary heap of the tasks beyond the last level
+        Slot m_spareSlot;                   // storage recycled by the cascades (no allocation once warmed up)
+        tick_type m_horizon      = 0;       // first tick not stored in the near heap
+        std::size_t m_wheelSize  = 0;
+        std::uint64_t m_sequence = 0;
+    };
+
+} // namespace NS_OSBASE::application
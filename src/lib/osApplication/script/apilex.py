@@ -21,6 +21,12 @@ class ApiTags:
     topicTag = 'topic'
     importsTag = 'imports'
     moduleTag = 'module'
+    concurrencyTag = 'concurrency'
+    encodingTag = 'encoding'
+    cacheTag = 'cache'
+    ttlTag = 'ttl'
+    capacityTag = 'capacity'
+    windowTag = 'window'
 
 
 class ApiTypes:
@@ -42,3 +48,13 @@ class ApiTypes:
 class ApiAccess:
     asyncAccess = 'async'
     asyncPagedAccess = 'async_paged'
+    streamAccess = 'stream'
+
+
+class ApiConcurrency:
+    serializedConcurrency = 'serialized'
+
+
+class ApiEncoding:
+    jsonEncoding = 'json'
+    msgpackEncoding = 'msgpack'
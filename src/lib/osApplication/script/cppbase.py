@@ -6,6 +6,8 @@ import yaml
 from apilex import ApiTypes
 from apilex import ApiTags as tags
 from apilex import ApiAccess
+from apilex import ApiConcurrency
+from apilex import ApiEncoding
 from cppexception import CppException
 
 
@@ -30,9 +32,12 @@ class CppBase:
 
     accessTypes = {
         ApiAccess.asyncAccess: 'NS_OSBASE::data::AsyncData',
-        ApiAccess.asyncPagedAccess: 'NS_OSBASE::data::AsyncPagedData'
+        ApiAccess.asyncPagedAccess: 'NS_OSBASE::data::AsyncPagedData',
+        ApiAccess.streamAccess: 'NS_OSBASE::application::IServiceStreamPtr'
     }
 
+    defaultStreamWindow = 16
+
     def __init__(self, yamlApi, file, apiFile):
         self.yamlApi = yamlApi
         self.file = file
@@ -57,6 +62,10 @@ class CppBase:
                     raise CppException('CppBase.__checkServiceModule',
                                        'Tag "' + '.'.join([tags.serviceTag, tag]) +
                                        '" missing')
+            if self.hasField(service, tags.encodingTag) and self.getEncoding() is None:
+                raise CppException('CppBase.__checkServiceModule',
+                                   'Tag "' + '.'.join([tags.serviceTag, tags.encodingTag]) + '" invalid ("' +
+                                   ApiEncoding.jsonEncoding + '" or "' + ApiEncoding.msgpackEncoding + '" expected)')
         elif self.hasField(self.yamlApi, tags.moduleTag):
             module = self.yamlApi[tags.moduleTag]
             if not self.hasField(module, tags.nameTag):
@@ -101,6 +110,14 @@ class CppBase:
                 if method[tags.uriTag] in uris:
                     raise CppException('CppBase.__checkProcess',
                                        'uri "' + method[tags.uriTag] + '" already existing')
+                if self.hasField(method, tags.concurrencyTag) and self.getConcurrency(method) is None:
+                    raise CppException('CppBase.__checkProcess',
+                                       'Tag "' + tags.concurrencyTag + '" for the method ' + method[tags.nameTag] +
+                                       '" invalid (positive integer or "' + ApiConcurrency.serializedConcurrency + '" expected)')
+                if self.hasField(method, tags.windowTag) and self.getWindow(method) is None:
+                    raise CppException('CppBase.__checkProcess',
+                                       'Tag "' + tags.windowTag + '" for the method ' + method[tags.nameTag] +
+                                       '" invalid (positive integer expected)')
                 uris.append(method[tags.uriTag])
 
     def __checkEvents(self):
@@ -163,6 +180,7 @@ class CppBase:
         #   mynamespace.MyDomainObject[3]
         #   (async)char[]
         #   (async_paged)unsigned char[]
+        #   (stream)MyDomainObject
         #   integer?
 
         match = re.match(r'(\((?P<access>[a-z_]*)\))?'
@@ -229,6 +247,91 @@ class CppBase:
 
         return self.yamlApi[tags.serviceTag][tags.nameTag] + 'Service.' + element[tags.nameTag]
 
+    def getConcurrency(self, method):
+        if not self.hasField(method, tags.concurrencyTag):
+            return 0
+
+        concurrency = method[tags.concurrencyTag]
+        if concurrency == ApiConcurrency.serializedConcurrency:
+            return 1
+        if type(concurrency) is int and concurrency > 0:
+            return concurrency
+
+        return None
+
+    def getCache(self, method):
+        # cache of the results of a const process: (ttl in ms, capacity), None if not cached
+        if not self.hasField(method, tags.cacheTag) or not self.hasField(method, tags.constTag) or not method[tags.constTag]:
+            return None
+
+        if not self.hasField(method, tags.typeTag) or not self.getStream(method) is None:
+            return None
+
+        cache = method[tags.cacheTag]
+        if cache is True:
+            return 0, 0
+        if not type(cache) is dict:
+            return None
+
+        ttl = cache[tags.ttlTag] if self.hasField(cache, tags.ttlTag) else 0
+        capacity = cache[tags.capacityTag] if self.hasField(cache, tags.capacityTag) else 0
+        if not type(ttl) is int or ttl < 0 or not type(capacity) is int or capacity < 0:
+            return None
+
+        return ttl, capacity
+
+    def getStream(self, method):
+        # type of the chunks of a process returning a stream, None if not a stream
+        if not self.hasField(method, tags.typeTag):
+            return None
+
+        match = re.match(r'\(' + ApiAccess.streamAccess + r'\)(?P<chunk>.*)$', method[tags.typeTag])
+        if not match:
+            return None
+
+        return self.getCppType(match.group('chunk'))
+
+    def getArgumentDeclarations(self, method):
+        # 'type name' of the arguments of a process
+        declarations = []
+        if self.hasField(method, tags.argumentsTag):
+            for argument in method[tags.argumentsTag]:
+                declarations.append(self.getCppType(argument[tags.typeTag]) + ' ' + argument[tags.nameTag])
+
+        return declarations
+
+    def getWindow(self, method):
+        # number of chunks written ahead of the reader
+        if not self.hasField(method, tags.windowTag):
+            return CppBase.defaultStreamWindow
+
+        window = method[tags.windowTag]
+        if type(window) is int and window > 0:
+            return window
+
+        return None
+
+    @staticmethod
+    def getInvalidateName(method):
+        methodName = method[tags.nameTag]
+        return 'invalidate' + methodName[0].upper() + methodName[1:]
+
+    @staticmethod
+    def getCoMethodName(method):
+        methodName = method[tags.nameTag]
+        return 'co' + methodName[0].upper() + methodName[1:]
+
+    def getEncoding(self):
+        service = self.yamlApi[tags.serviceTag]
+        if not self.hasField(service, tags.encodingTag):
+            return ApiEncoding.jsonEncoding
+
+        encoding = service[tags.encodingTag]
+        if encoding in [ApiEncoding.jsonEncoding, ApiEncoding.msgpackEncoding]:
+            return encoding
+
+        return None
+
     def __loadStruct(self, struct):
         structObject = {}
         fieldNames = []
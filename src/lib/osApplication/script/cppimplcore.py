@@ -1,6 +1,7 @@
 import os.path
 from cppbase import CppBase
 from apilex import ApiTags as tags
+from apilex import ApiEncoding
 
 
 class CppImplCore(CppBase):
@@ -31,8 +32,11 @@ class CppImplCore(CppBase):
         self.file.write('     * \\class ' + skeletonName + '\n')
         self.file.write('     */\n')
         self.file.write('    ' + skeletonName + '::' + skeletonName +
-                        '(const NS_OSBASE::data::Uri &uri, const std::string &realm) : ' + baseClass + '("' +
-                        name + 'Service", uri, realm) {\n')
+                        '(const NS_OSBASE::data::Uri &uri, const std::string &realm, ' +
+                        'NS_OSBASE::application::TaskLoopPtr pTaskLoop) : ' + baseClass + '("' +
+                        name + 'Service", uri, realm, pTaskLoop) {\n')
+        if self.getEncoding() != ApiEncoding.jsonEncoding:
+            self.file.write('        setEncoding(NS_OSBASE::application::ServiceEncoding::' + self.getEncoding() + ');\n')
         self.file.write('    }\n\n')
 
         hasEvent = self.hasField(self.yamlApi, tags.eventsTag)
@@ -52,13 +56,35 @@ class CppImplCore(CppBase):
 
                 self.file.write('    }\n\n')
 
+        if self.hasField(self.yamlApi, tags.processTag):
+            for method in self.yamlApi[tags.processTag]:
+                if not self.getCache(method) is None:
+                    self.file.write('    void ' + skeletonName + '::' + self.getInvalidateName(method) + '() const {\n')
+                    self.file.write('        invalidateCache("' + method[tags.nameTag] + '");\n')
+                    self.file.write('    }\n\n')
+
+        if self.hasField(self.yamlApi, tags.processTag):
+            for method in self.yamlApi[tags.processTag]:
+                if not self.getStream(method) is None:
+                    qualifier = ' const' if self.hasField(method, tags.constTag) and method[tags.constTag] else ''
+                    self.file.write('    ' + self.getCppType(method[tags.typeTag]) + ' ' + skeletonName + '::' + method[tags.nameTag] +
+                                    '(' + ', '.join(self.getArgumentDeclarations(method)) + ')' + qualifier + ' {\n')
+                    self.file.write('        throw NS_OSBASE::application::ServiceException("the stream \'' + method[tags.nameTag] +
+                                    '\' is read through a stub");\n')
+                    self.file.write('    }\n\n')
+
         self.file.write('    void ' + skeletonName + '::doRegister() {\n')
         self.file.write('        ' + baseClass + '::doRegister();\n')
         if self.hasField(self.yamlApi, tags.processTag):
             for method in self.yamlApi[tags.processTag]:
                 methodName = method[tags.nameTag]
-                self.file.write('        registerCall("' + self.getUri(method, tags.uriTag) + '", this, &' +
-                                skeletonName + '::' + methodName + ');\n')
+                concurrency = self.getConcurrency(method)
+                registerName = 'registerCall' if self.getStream(method) is None else 'registerStream'
+                self.file.write('        ' + registerName + '("' + self.getUri(method, tags.uriTag) + '", this, &' +
+                                skeletonName + '::' + methodName)
+                if concurrency != 0:
+                    self.file.write(', ' + str(concurrency))
+                self.file.write(');\n')
         self.file.write('    }\n\n')
 
         self.file.write('    void ' + skeletonName + '::doUnregister() {\n')
@@ -29,8 +29,26 @@ class CppImplHeader(CppBase):
         self.file.write('     */\n')
         self.file.write('    class ' + skeletonName + ' : public NS_OSBASE::application::ServiceImpl<' +
                         serviceName + '> {\n')
+
+        if self.hasField(self.yamlApi, tags.processTag):
+            streams = [method for method in self.yamlApi[tags.processTag] if not self.getStream(method) is None]
+            if len(streams) != 0:
+                self.file.write('    public:\n')
+            for method in streams:
+                methodName = method[tags.nameTag]
+                qualifier = ' const' if self.hasField(method, tags.constTag) and method[tags.constTag] else ''
+                arguments = self.getArgumentDeclarations(method)
+                self.file.write('        ' + self.getCppType(method[tags.typeTag]) + ' ' + methodName + '(' + ', '.join(arguments) +
+                                ')' + qualifier + ' override final; // read through a stub\n')
+                self.file.write('        virtual void ' + methodName + '(' +
+                                ', '.join(['NS_OSBASE::application::IServiceStreamWriterPtr<' + self.getStream(method) + '> pWriter'] +
+                                          arguments) + ')' + qualifier + ' = 0;\n')
+            if len(streams) != 0:
+                self.file.write('\n')
+
         self.file.write('    protected:\n')
-        self.file.write('        ' + skeletonName + '(const NS_OSBASE::data::Uri &uri, const std::string &realm);\n\n')
+        self.file.write('        ' + skeletonName + '(const NS_OSBASE::data::Uri &uri, const std::string &realm, ' +
+                        'NS_OSBASE::application::TaskLoopPtr pTaskLoop = nullptr);\n\n')
 
         hasEvent = self.hasField(self.yamlApi, tags.eventsTag)
         if hasEvent:
@@ -45,6 +63,16 @@ class CppImplHeader(CppBase):
         if hasEvent:
             self.file.write('\n')
 
+        hasCache = False
+        if self.hasField(self.yamlApi, tags.processTag):
+            for method in self.yamlApi[tags.processTag]:
+                if not self.getCache(method) is None:
+                    hasCache = True
+                    self.file.write('        void ' + self.getInvalidateName(method) + '() const;\n')
+
+        if hasCache:
+            self.file.write('\n')
+
         self.file.write('        void doRegister() override final;\n')
         self.file.write('        void doUnregister () override final;\n')
         self.file.write('    };\n')
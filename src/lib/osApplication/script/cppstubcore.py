@@ -1,5 +1,6 @@
 import os.path
 from apilex import ApiTags as tags
+from apilex import ApiEncoding
 from cppbase import CppBase
 
 
@@ -16,6 +17,7 @@ class CppStubCore(CppBase):
     def __addIncludes(self):
         headerRelPath = self.getRelativeTargetedPath(self.file.name, self.header)
         self.file.write('#include "' + headerRelPath + '"\n')
+        self.file.write('#include "osApplication/ServiceBatch.h"\n')
         self.file.write('#include "osApplication/ServiceStub.h"\n\n')
 
     def __getBaseClassName(self, withNamespace):
@@ -59,7 +61,40 @@ class CppStubCore(CppBase):
         self.file.write('            ')
         if methodType != 'void':
             self.file.write('return ')
-        self.file.write(self.__getBaseClassName(False) + '::invoke<' + methodType + '>("' + self.getUri(method, tags.uriTag) + '"')
+        streamType = self.getStream(method)
+        if not streamType is None:
+            self.file.write(self.__getBaseClassName(False) + '::invokeStream<' + streamType + '>("' +
+                            self.getUri(method, tags.uriTag) + '", ' + str(self.getWindow(method)))
+        else:
+            invokeName = 'invoke' if self.getCache(method) is None else 'invokeCached'
+            self.file.write(self.__getBaseClassName(False) + '::' + invokeName + '<' + methodType + '>("' +
+                            self.getUri(method, tags.uriTag) + '"')
+        for argName in argNames:
+            self.file.write(', ' + argName)
+        self.file.write(');\n')
+        self.file.write('        }\n\n')
+
+    def __addCoMethod(self, method):
+        if not self.getStream(method) is None or not self.getCache(method) is None:
+            return  # a cached result is read from the cache by the default version
+
+        if self.hasField(method, tags.typeTag):
+            methodType = self.getCppType(method[tags.typeTag])
+            if methodType is None:
+                return
+        else:
+            methodType = 'void'
+
+        argNames = [argument[tags.nameTag] for argument in method[tags.argumentsTag]] \
+            if self.hasField(method, tags.argumentsTag) else []
+        self.file.write('        NS_OSBASE::application::CoTask<' + methodType + '> ' + self.getCoMethodName(method) + '(' +
+                        ', '.join(self.getArgumentDeclarations(method)) + ') ')
+        if self.hasField(method, tags.constTag) and method[tags.constTag]:
+            self.file.write('const ')
+
+        self.file.write('override {\n')
+        self.file.write('            co_return co_await ' + self.__getBaseClassName(False) + '::coInvoke<' + methodType + '>("' +
+                        self.getUri(method, tags.uriTag) + '"')
         for argName in argNames:
             self.file.write(', ' + argName)
         self.file.write(');\n')
@@ -90,12 +125,31 @@ class CppStubCore(CppBase):
                         stubClassName +
                         '(const NS_OSBASE::data::Uri& uri, const std::string &realm, '
                         'NS_OSBASE::application::TaskLoopPtr pTaskLoop) : ' + self.__getBaseClassName(False)
-                        + '(' + '"' + serviceName + '"' + ', uri, realm, pTaskLoop) {}\n\n')
+                        + '(' + '"' + serviceName + '"' + ', uri, realm, pTaskLoop) {')
+        ctorBody = []
+        if self.getEncoding() != ApiEncoding.jsonEncoding:
+            ctorBody.append('setEncoding(NS_OSBASE::application::ServiceEncoding::' + self.getEncoding() + ');')
+        if tags.processTag in self.yamlApi and not self.yamlApi[tags.processTag] is None:
+            for method in self.yamlApi[tags.processTag]:
+                cache = self.getCache(method)
+                if not cache is None:
+                    ctorBody.append('setCache("' + self.getUri(method, tags.uriTag) + '", "' + method[tags.nameTag] +
+                                    '", { std::chrono::milliseconds(' + str(cache[0]) + '), ' + str(cache[1]) + ' });')
+        for line in ctorBody:
+            self.file.write('\n            ' + line)
+        if len(ctorBody) != 0:
+            self.file.write('\n        ')
+        self.file.write('}\n\n')
 
         if tags.processTag in self.yamlApi and not self.yamlApi[tags.processTag] is None:
             for method in self.yamlApi[tags.processTag]:
                 self.__addMethod(method)
 
+            self.file.write('#ifdef __cpp_impl_coroutine\n')
+            for method in self.yamlApi[tags.processTag]:
+                self.__addCoMethod(method)
+            self.file.write('#endif\n')
+
         self.file.write('    protected:\n')
         self.file.write('        void doRegister() override final {\n')
         self.file.write('            ' + self.__getBaseClassName(False) + '::doRegister();\n')
@@ -109,6 +163,67 @@ class CppStubCore(CppBase):
 
         self.file.write('    };\n\n')
 
+    def __getBatchBaseClassName(self, withNamespace):
+        className = self.yamlApi[tags.serviceTag][tags.nameTag]
+        templateArgs = '<' + className + 'Service, ' + className + 'Batch>'
+        if withNamespace:
+            return 'NS_OSBASE::application::ServiceBatch' + templateArgs
+
+        return 'ServiceBatch' + templateArgs
+
+    def __addBatchMethod(self, method):
+        if not self.getStream(method) is None:
+            return
+
+        if self.hasField(method, tags.typeTag):
+            methodType = self.getCppType(method[tags.typeTag])
+            if methodType is None:
+                return
+        else:
+            methodType = 'void'
+
+        methodName = method[tags.nameTag]
+        self.file.write('        std::future<' + methodType + '> ' + methodName + '(')
+        argNames = []
+        if self.hasField(method, tags.argumentsTag):
+            for argument in method[tags.argumentsTag]:
+                argName = argument[tags.nameTag]
+                if argName in argNames:
+                    return
+
+                argType = self.getCppType(argument[tags.typeTag])
+                if argType is None:
+                    return
+
+                if len(argNames) != 0:
+                    self.file.write(', ')
+                self.file.write(argType + ' ' + argName)
+                argNames.append(argName)
+        self.file.write(') override {\n')
+        self.file.write('            return ' + self.__getBatchBaseClassName(False) + '::invoke<' + methodType + '>("' +
+                        self.getUri(method, tags.uriTag) + '"')
+        for argName in argNames:
+            self.file.write(', ' + argName)
+        self.file.write(');\n')
+        self.file.write('        }\n\n')
+
+    def __addBatchClass(self):
+        serviceName = self.yamlApi[tags.serviceTag][tags.nameTag] + 'Service'
+        batchClassName = serviceName + 'Batch'
+        self.file.write('    /*\n')
+        self.file.write('     * \\class ' + batchClassName + '\n')
+        self.file.write('     */\n')
+        self.file.write('    class ' + batchClassName + ' : public ' + self.__getBatchBaseClassName(True) + ' {\n')
+        self.file.write('    public:\n')
+        self.file.write('        ' + batchClassName + '(' + serviceName + 'Ptr pStub, const std::chrono::milliseconds &window) : ' +
+                        self.__getBatchBaseClassName(False) + '(pStub, window) {}\n\n')
+
+        if tags.processTag in self.yamlApi and not self.yamlApi[tags.processTag] is None:
+            for method in self.yamlApi[tags.processTag]:
+                self.__addBatchMethod(method)
+
+        self.file.write('    };\n\n')
+
     def __addMaker(self):
         serviceName = self.yamlApi[tags.serviceTag][tags.nameTag] + 'Service'
         stubClassName = serviceName + 'Stub'
@@ -116,6 +231,12 @@ class CppStubCore(CppBase):
             '    ' + serviceName + 'Ptr makeStub(const NS_OSBASE::data::Uri& uri, const std::string &realm, '
                                    'NS_OSBASE::application::TaskLoopPtr pTaskLoop) {\n')
         self.file.write('        return std::make_shared<' + stubClassName + '>(uri, realm, pTaskLoop);\n')
+        self.file.write('    }\n\n')
+
+        batchName = self.yamlApi[tags.serviceTag][tags.nameTag] + 'Batch'
+        self.file.write(
+            '    ' + batchName + 'Ptr makeBatch(' + serviceName + 'Ptr pStub, const std::chrono::milliseconds &window) {\n')
+        self.file.write('        return std::make_shared<' + serviceName + 'Batch>(pStub, window);\n')
         self.file.write('    }\n')
 
     def generate(self):
@@ -123,5 +244,6 @@ class CppStubCore(CppBase):
         self.__addIncludes()
         self.addNamespace(True)
         self.__addStubClass()
+        self.__addBatchClass()
         self.__addMaker()
         self.addNamespace(False)
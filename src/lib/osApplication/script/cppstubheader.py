@@ -27,11 +27,15 @@ class CppStubHeader(CppBase):
 
     def __addIncludes(self):
         self.file.write('#include "osApplication/IService.h"\n')
+        self.file.write('#include "osApplication/Coroutine.h"\n')
+        self.file.write('#include "osApplication/IServiceStream.h"\n')
         self.file.write('#include "osApplication/ServiceException.h"\n')
         self.file.write('#include "osApplication/TaskLoop.h"\n')
         self.file.write('#include "osCore/Serialization/CoreKeySerializer.h"\n')
+        self.file.write('#include "osCore/Serialization/JsonSerializer.h"\n')
         self.file.write('#include "osCore/Serialization/Serializer.h"\n')
         self.file.write('#include "osData/AsyncData.h"\n')
+        self.file.write('#include <future>\n')
 
         # check for uri types
         uriFound = False
@@ -268,6 +272,84 @@ class CppStubHeader(CppBase):
 
         self.process[methodName] = self.getUri(method, methodName)
 
+    def __addCoMethod(self, method):
+        if not self.getStream(method) is None:
+            return  # the chunks of a stream are already read without blocking
+
+        if self.hasField(method, tags.typeTag):
+            methodType = self.getCppType(method[tags.typeTag])
+            if methodType is None:
+                return
+        else:
+            methodType = 'void'
+
+        methodName = method[tags.nameTag]
+        argNames = [argument[tags.nameTag] for argument in method[tags.argumentsTag]] \
+            if self.hasField(method, tags.argumentsTag) else []
+        self.file.write('        /**\n')
+        self.file.write('         * \\brief Awaitable version of ' + methodName + '(), the thread of the awaiting coroutine is not '
+                        'blocked by the stub\n')
+        self.file.write('         */\n')
+        self.file.write('        virtual NS_OSBASE::application::CoTask<' + methodType + '> ' + self.getCoMethodName(method) + '(' +
+                        ', '.join(self.getArgumentDeclarations(method)) + ')')
+        if self.hasField(method, tags.constTag) and method[tags.constTag]:
+            self.file.write(' const')
+
+        self.file.write(' {\n')
+        self.file.write('            co_return ' + methodName + '(' + ', '.join(argNames) + ');\n')
+        self.file.write('        }\n\n')
+
+    def __addBatchMethod(self, method):
+        if not self.getStream(method) is None:
+            return  # the chunks of a stream are not returned by a batch
+
+        if self.hasField(method, tags.typeTag):
+            methodType = self.getCppType(method[tags.typeTag])
+            if methodType is None:
+                return
+        else:
+            methodType = 'void'
+
+        methodName = method[tags.nameTag]
+        self.file.write('        virtual std::future<' + methodType + '> ' + methodName + '(')
+        if self.hasField(method, tags.argumentsTag):
+            argNames = []
+            for argument in method[tags.argumentsTag]:
+                argName = argument[tags.nameTag]
+                if argName in argNames:
+                    return
+
+                argType = self.getCppType(argument[tags.typeTag])
+                if argType is None:
+                    return
+
+                if len(argNames) != 0:
+                    self.file.write(', ')
+                self.file.write(argType + ' ' + argName)
+                argNames.append(argName)
+
+        self.file.write(') = 0;\n')
+
+    def __addBatch(self, className, serviceName):
+        batchName = className + 'Batch'
+        self.file.write('    /**\n')
+        self.file.write('     * \\brief Batch of the calls of ' + className + ', sent in one invocation '
+                        '(see NS_OSBASE::application::ServiceBatch)\n')
+        self.file.write('     */\n')
+        self.file.write('    class ' + batchName + ' : public NS_OSBASE::application::IServiceBatch {\n')
+        self.file.write('    public:\n')
+
+        if self.hasField(self.yamlApi, tags.processTag):
+            for method in self.yamlApi[tags.processTag]:
+                self.__addBatchMethod(method)
+
+        self.file.write('    };\n\n')
+        self.file.write('    using ' + batchName + 'Ptr = std::shared_ptr<' + batchName + '>;\n\n')
+        self.file.write(
+            '    ' + batchName + 'Ptr makeBatch(' + serviceName + 'Ptr pStub, '
+                                 'const std::chrono::milliseconds &window = std::chrono::milliseconds(0));\n')
+        self.file.write('\n')
+
     def __addProcess(self):
         if self.hasField(self.yamlApi, tags.moduleTag):
             return
@@ -294,6 +376,12 @@ class CppStubHeader(CppBase):
             for method in self.yamlApi[tags.processTag]:
                 self.__addMethod(method)
 
+            # the stub awaits the invocations, the impl and the other implementations execute the method
+            self.file.write('#ifdef __cpp_impl_coroutine\n')
+            for method in self.yamlApi[tags.processTag]:
+                self.__addCoMethod(method)
+            self.file.write('#endif\n')
+
         self.file.write('    };\n\n')
         self.file.write(
             '    using ' + serviceName + ' = NS_OSBASE::application::IService<' + className + '>;\n')
@@ -302,6 +390,7 @@ class CppStubHeader(CppBase):
             '    ' + serviceName + 'Ptr makeStub(const NS_OSBASE::data::Uri& uri, const std::string &realm, '
                                    'NS_OSBASE::application::TaskLoopPtr pTaskLoop = nullptr);\n')
         self.file.write('\n')
+        self.__addBatch(className, serviceName)
 
     def __addEvents(self):
         if self.hasField(self.yamlApi, tags.moduleTag):
@@ -342,6 +431,7 @@ class CppStubHeader(CppBase):
                 type_declaration += ', ' + field
 
             self.file.write('OS_KEY_SERIALIZE_STRUCT(' + type_declaration + ');\n')
+            self.file.write('OS_JSON_SERIALIZE_STRUCT(' + type_declaration + ');\n')
             self.file.write('OS_SERIALIZE_STRUCT(' + type_declaration + ');\n')
 
     def __addEnumConverters(self):
@@ -0,0 +1,82 @@
+// \file  CallDispatcher.cpp
+// \brief Implementation of the class CallDispatcher
+
+#include "osApplication/CallDispatcher.h"
+#include <algorithm>
+
+namespace NS_OSBASE::application {
+
+    /*
+     * \class CallDispatcher
+     */
+    CallDispatcher::CallDispatcher(TaskLoopPoolPtr pPool, const size_t concurrency)
+        : m_pPool(std::move(pPool)), m_concurrency(std::max<size_t>(concurrency, 1)) {
+    }
+
+    CallDispatcher::~CallDispatcher() {
+        std::vector<TaskLoopPtr> strands;
+        {
+            const std::lock_guard locker(m_mutex);
+            m_pendingCalls.clear();
+            strands = m_strands;
+        }
+
+        // wait for the running calls: they don't dispatch the pending ones anymore
+        for (auto const &pStrand : strands) {
+            pStrand->stop();
+        }
+    }
+
+    void CallDispatcher::dispatch(InlineTask call) {
+        TaskLoop *pStrand = nullptr;
+        {
+            const std::lock_guard locker(m_mutex);
+            if (!m_idleStrands.empty()) {
+                pStrand = m_idleStrands.back();
+                m_idleStrands.pop_back();
+            } else if (m_strands.size() < m_concurrency) {
+                m_strands.push_back(m_pPool->makeStrand());
+                pStrand = m_strands.back().get();
+                pStrand->runAsync();
+            } else {
+                m_pendingCalls.push_back(std::move(call));
+                return;
+            }
+        }
+
+        execute(*pStrand, std::move(call));
+    }
+
+    size_t CallDispatcher::getConcurrency() const {
+        return m_concurrency;
+    }
+
+    size_t CallDispatcher::getNbPendingCalls() const {
+        const std::lock_guard locker(m_mutex);
+        return m_pendingCalls.size();
+    }
+
+    void CallDispatcher::execute(TaskLoop &strand, InlineTask call) {
+        // the strand keeps executing the queued calls until there is none
+        strand.post([this, &strand, call = std::move(call)]() mutable {
+            call.execute();
+            onCallEnd(strand);
+        });
+    }
+
+    void CallDispatcher::onCallEnd(TaskLoop &strand) {
+        InlineTask call;
+        {
+            const std::lock_guard locker(m_mutex);
+            if (m_pendingCalls.empty()) {
+                m_idleStrands.push_back(&strand);
+                return;
+            }
+
+            call = std::move(m_pendingCalls.front());
+            m_pendingCalls.pop_front();
+        }
+
+        execute(strand, std::move(call));
+    }
+} // namespace NS_OSBASE::application
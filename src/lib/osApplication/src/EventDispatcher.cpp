@@ -0,0 +1,49 @@
+// \file  EventDispatcher.cpp
+// \brief Implementation of the class EventDispatcher
+
+#include "osApplication/EventDispatcher.h"
+
+namespace NS_OSBASE::application {
+
+    /*
+     * \class EventDispatcher
+     */
+    void EventDispatcher::subscribe(const std::string &topic) {
+        const std::unique_lock lock(m_mutex);
+        auto &pTopic = m_topics[topic];
+        if (pTopic == nullptr) {
+            pTopic = std::make_shared<Topic>();
+        }
+        ++pTopic->nbSubscribers;
+    }
+
+    void EventDispatcher::unsubscribe(const std::string &topic) {
+        const std::unique_lock lock(m_mutex);
+        auto const itTopic = m_topics.find(topic);
+        if (itTopic == m_topics.cend()) {
+            return;
+        }
+
+        auto const &pTopic = itTopic->second;
+        if (--pTopic->nbSubscribers == 0) {
+            m_topics.erase(itTopic);
+        } else if (pTopic->nbSubscribers == 1) {
+            // no more sharing: the last messages are released
+            const std::lock_guard topicLock(pTopic->mutex);
+            pTopic->decoded.clear();
+        }
+    }
+
+    EventDispatcher::Counters EventDispatcher::getCounters() const {
+        return { m_nbDecodes, m_nbShares };
+    }
+
+    EventDispatcher::TopicPtr EventDispatcher::findSharedTopic(const std::string &topic) const {
+        const std::shared_lock lock(m_mutex);
+        auto const itTopic = m_topics.find(topic);
+        if (itTopic == m_topics.cend() || itTopic->second->nbSubscribers < 2) {
+            return nullptr;
+        }
+        return itTopic->second;
+    }
+} // namespace NS_OSBASE::application
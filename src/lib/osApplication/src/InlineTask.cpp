@@ -0,0 +1,61 @@
+// \file  InlineTask.cpp
+// \brief Implementation of the class InlineTask
+
+#include "osApplication/InlineTask.h"
+
+namespace NS_OSBASE::application {
+
+    /*
+     * \class InlineTask
+     */
+    InlineTask::InlineTask(InlineTask &&other) noexcept {
+        *this = std::move(other);
+    }
+
+    InlineTask::~InlineTask() {
+        reset();
+    }
+
+    InlineTask &InlineTask::operator=(InlineTask &&other) noexcept {
+        if (this != &other) {
+            reset();
+            if (other.m_pOperations != nullptr) {
+                other.m_pOperations->move(m_storage, other.m_storage);
+                m_pOperations       = other.m_pOperations;
+                other.m_pOperations = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    void InlineTask::execute() {
+        if (m_pOperations != nullptr) {
+            m_pOperations->execute(m_storage);
+        }
+    }
+
+    bool InlineTask::empty() const {
+        return m_pOperations == nullptr;
+    }
+
+    bool InlineTask::isInline() const {
+        return m_pOperations != nullptr && m_pOperations->bInline;
+    }
+
+    const std::type_info &InlineTask::getType() const {
+        return m_pOperations != nullptr ? m_pOperations->getType(m_storage) : typeid(void);
+    }
+
+    void InlineTask::reset() {
+        if (m_pOperations != nullptr) {
+            m_pOperations->destroy(m_storage);
+            m_pOperations = nullptr;
+        }
+    }
+
+    // maker
+    InlineTask makeInlineTask(ITaskPtr pTask) {
+        return InlineTask::emplace<internal::SharedTaskCallable>(std::move(pTask));
+    }
+
+} // namespace NS_OSBASE::application
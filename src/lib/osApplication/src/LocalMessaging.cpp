@@ -0,0 +1,155 @@
+// \file  LocalMessaging.cpp
+// \brief Implementation of the class LocalMessaging
+
+#include "osApplication/LocalMessaging.h"
+#include <algorithm>
+#include <mutex>
+
+namespace NS_OSBASE::application {
+
+    namespace {
+        /*
+         * \class LocalCallResult
+         */
+        class LocalCallResult : public data::IMessaging::ICallResult {
+        public:
+            LocalCallResult(data::IMessaging::IClientDelegatePtr pClientDelegate, data::IMessaging::IErrorDelegatePtr pErrorDelegate)
+                : m_pClientDelegate(std::move(pClientDelegate)), m_pErrorDelegate(std::move(pErrorDelegate)) {
+            }
+
+            ~LocalCallResult() override {
+                fail("no result returned by the call");
+            }
+
+            void yield(const data::IMessaging::JsonText &json) override {
+                if (!m_bAnswered.exchange(true)) {
+                    m_pClientDelegate->onResult(json);
+                }
+            }
+
+            void fail(const std::string &error) override {
+                if (!m_bAnswered.exchange(true)) {
+                    m_pErrorDelegate->onError(error);
+                }
+            }
+
+        private:
+            data::IMessaging::IClientDelegatePtr m_pClientDelegate;
+            data::IMessaging::IErrorDelegatePtr m_pErrorDelegate;
+            std::atomic_bool m_bAnswered = false;
+        };
+    } // namespace
+
+    /*
+     * \class ILocalSubscriber
+     */
+    ILocalSubscriber::~ILocalSubscriber() = default;
+
+    /*
+     * \class LocalMessaging
+     */
+    bool LocalMessaging::isEnabled() const {
+        return m_bEnabled;
+    }
+
+    void LocalMessaging::setEnabled(const bool bEnabled) {
+        m_bEnabled = bEnabled;
+    }
+
+    std::string LocalMessaging::makeUri(const data::Uri &brokerUri, const std::string &realm, const std::string &uri) {
+        return type_cast<std::string>(brokerUri) + "/" + realm + "/" + uri;
+    }
+
+    void LocalMessaging::registerService(const std::string &uri) {
+        const std::unique_lock lock(m_mutex);
+        ++m_services[uri];
+    }
+
+    void LocalMessaging::unregisterService(const std::string &uri) {
+        const std::unique_lock lock(m_mutex);
+        auto const itService = m_services.find(uri);
+        if (itService != m_services.cend() && --itService->second == 0) {
+            m_services.erase(itService);
+        }
+    }
+
+    bool LocalMessaging::isServiceRegistered(const std::string &uri) const {
+        const std::shared_lock lock(m_mutex);
+        return m_services.find(uri) != m_services.cend();
+    }
+
+    void LocalMessaging::registerCall(const std::string &uri, data::IMessaging::ISupplierDelegatePtr pDelegate) {
+        const std::unique_lock lock(m_mutex);
+        m_calls[uri] = pDelegate;
+    }
+
+    void LocalMessaging::unregisterCall(const std::string &uri, data::IMessaging::ISupplierDelegatePtr pDelegate) {
+        const std::unique_lock lock(m_mutex);
+        auto const itCall = m_calls.find(uri);
+        if (itCall == m_calls.cend()) {
+            return;
+        }
+
+        // only if not registered again meanwhile (ex: by another instance)
+        auto const pRegisteredDelegate = itCall->second.lock();
+        if (pRegisteredDelegate == nullptr || pRegisteredDelegate == pDelegate) {
+            m_calls.erase(itCall);
+        }
+    }
+
+    data::IMessaging::ISupplierDelegatePtr LocalMessaging::findCall(const std::string &uri) const {
+        const std::shared_lock lock(m_mutex);
+        auto const itCall = m_calls.find(uri);
+        return itCall == m_calls.cend() ? nullptr : itCall->second.lock();
+    }
+
+    void LocalMessaging::subscribe(const std::string &topic, ILocalSubscriberPtr pSubscriber) {
+        const std::unique_lock lock(m_mutex);
+        auto &subscribers    = m_subscribers[topic];
+        auto const isExpired = [](auto const &pWSubscriber) { return pWSubscriber.expired(); };
+        subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(), isExpired), subscribers.end());
+        subscribers.push_back(pSubscriber);
+    }
+
+    void LocalMessaging::unsubscribe(const std::string &topic, ILocalSubscriberPtr pSubscriber) {
+        const std::unique_lock lock(m_mutex);
+        auto const itSubscribers = m_subscribers.find(topic);
+        if (itSubscribers == m_subscribers.cend()) {
+            return;
+        }
+
+        auto &subscribers = itSubscribers->second;
+        subscribers.erase(std::remove_if(subscribers.begin(),
+                              subscribers.end(),
+                              [&pSubscriber](auto const &pWSubscriber) {
+                                  auto const pRegisteredSubscriber = pWSubscriber.lock();
+                                  return pRegisteredSubscriber == nullptr || pRegisteredSubscriber == pSubscriber;
+                              }),
+            subscribers.end());
+        if (subscribers.empty()) {
+            m_subscribers.erase(itSubscribers);
+        }
+    }
+
+    std::vector<ILocalSubscriberPtr> LocalMessaging::getSubscribers(const std::string &topic) const {
+        const std::shared_lock lock(m_mutex);
+        std::vector<ILocalSubscriberPtr> subscribers;
+        auto const itSubscribers = m_subscribers.find(topic);
+        if (itSubscribers == m_subscribers.cend()) {
+            return subscribers;
+        }
+
+        subscribers.reserve(itSubscribers->second.size());
+        for (auto const &pWSubscriber : itSubscribers->second) {
+            if (auto pSubscriber = pWSubscriber.lock(); pSubscriber != nullptr) {
+                subscribers.push_back(std::move(pSubscriber));
+            }
+        }
+        return subscribers;
+    }
+
+    data::IMessaging::ICallResultPtr LocalMessaging::makeCallResult(
+        data::IMessaging::IClientDelegatePtr pClientDelegate, data::IMessaging::IErrorDelegatePtr pErrorDelegate) {
+        return std::make_shared<LocalCallResult>(std::move(pClientDelegate), std::move(pErrorDelegate));
+    }
+} // namespace NS_OSBASE::application
@@ -0,0 +1,100 @@
+// \file  ServiceCache.cpp
+// \brief Implementation of the class ServiceCache
+
+#include "osApplication/ServiceCache.h"
+
+namespace NS_OSBASE::application {
+
+    /*
+     * \class ServiceCache::Counters
+     */
+    ServiceCache::Counters &ServiceCache::Counters::operator+=(const Counters &other) {
+        nbHits += other.nbHits;
+        nbMisses += other.nbMisses;
+        nbEvictions += other.nbEvictions;
+        nbInvalidations += other.nbInvalidations;
+        return *this;
+    }
+
+    /*
+     * \class ServiceCache
+     */
+    ServiceCache::ServiceCache(const Options &options) : m_options(options) {
+    }
+
+    const ServiceCache::Options &ServiceCache::getOptions() const {
+        return m_options;
+    }
+
+    std::optional<std::any> ServiceCache::find(const std::string &key) {
+        const std::lock_guard lock(m_mutex);
+        auto const itEntryIndex = m_entryIndexes.find(key);
+        if (itEntryIndex == m_entryIndexes.cend()) {
+            ++m_counters.nbMisses;
+            return {};
+        }
+
+        auto const itEntry = itEntryIndex->second;
+        if (m_options.ttl.count() != 0 && clock::now() >= itEntry->expiration) {
+            evict(itEntry);
+            ++m_counters.nbMisses;
+            return {};
+        }
+
+        m_entries.splice(m_entries.begin(), m_entries, itEntry);
+        ++m_counters.nbHits;
+        return itEntry->value;
+    }
+
+    std::uint64_t ServiceCache::getGeneration() const {
+        const std::lock_guard lock(m_mutex);
+        return m_generation;
+    }
+
+    void ServiceCache::insert(const std::string &key, std::any &&value, const std::uint64_t generation) {
+        const std::lock_guard lock(m_mutex);
+        if (generation != m_generation) {
+            return;
+        }
+
+        auto const expiration = clock::now() + m_options.ttl;
+        if (auto const itEntryIndex = m_entryIndexes.find(key); itEntryIndex != m_entryIndexes.cend()) {
+            auto const itEntry  = itEntryIndex->second;
+            itEntry->value      = std::move(value);
+            itEntry->expiration = expiration;
+            m_entries.splice(m_entries.begin(), m_entries, itEntry);
+            return;
+        }
+
+        if (m_options.capacity != 0 && m_entries.size() >= m_options.capacity) {
+            evict(std::prev(m_entries.end()));
+        }
+
+        m_entries.push_front({ key, std::move(value), expiration });
+        m_entryIndexes.emplace(key, m_entries.begin());
+    }
+
+    void ServiceCache::clear() {
+        const std::lock_guard lock(m_mutex);
+        m_entries.clear();
+        m_entryIndexes.clear();
+        ++m_generation;
+        ++m_counters.nbInvalidations;
+    }
+
+    std::size_t ServiceCache::getSize() const {
+        const std::lock_guard lock(m_mutex);
+        return m_entries.size();
+    }
+
+    ServiceCache::Counters ServiceCache::getCounters() const {
+        const std::lock_guard lock(m_mutex);
+        return m_counters;
+    }
+
+    void ServiceCache::evict(Entries::iterator itEntry) {
+        m_entryIndexes.erase(itEntry->key);
+        m_entries.erase(itEntry);
+        ++m_counters.nbEvictions;
+    }
+} // namespace NS_OSBASE::application
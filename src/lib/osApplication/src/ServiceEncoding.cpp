@@ -0,0 +1,125 @@
+// \file  ServiceEncoding.cpp
+// \brief Implementation of the wire encodings of the services
+
+#include "osApplication/ServiceEncoding.h"
+#include "osCore/Serialization/FactoryNames.h"
+#include <algorithm>
+#include <array>
+#include <sstream>
+
+namespace NS_OSBASE::application {
+
+    namespace {
+        constexpr char s_jsonName[]    = "json";
+        constexpr char s_msgPackName[] = "msgpack";
+        constexpr char s_binaryMark    = '\0'; // first character of the binary payloads
+
+        constexpr char s_base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        std::string encodeBase64(const std::vector<unsigned char> &buffer) {
+            std::string encoded;
+            encoded.reserve(1 + (buffer.size() + 2) / 3 * 4);
+            encoded.push_back(s_binaryMark);
+
+            size_t index = 0;
+            for (; index + 2 < buffer.size(); index += 3) {
+                auto const bits = (buffer[index] << 16) | (buffer[index + 1] << 8) | buffer[index + 2];
+                encoded.push_back(s_base64Chars[(bits >> 18) & 0x3f]);
+                encoded.push_back(s_base64Chars[(bits >> 12) & 0x3f]);
+                encoded.push_back(s_base64Chars[(bits >> 6) & 0x3f]);
+                encoded.push_back(s_base64Chars[bits & 0x3f]);
+            }
+
+            if (auto const remaining = buffer.size() - index; remaining != 0) {
+                auto const bits = (buffer[index] << 16) | (remaining == 2 ? buffer[index + 1] << 8 : 0);
+                encoded.push_back(s_base64Chars[(bits >> 18) & 0x3f]);
+                encoded.push_back(s_base64Chars[(bits >> 12) & 0x3f]);
+                encoded.push_back(remaining == 2 ? s_base64Chars[(bits >> 6) & 0x3f] : '=');
+                encoded.push_back('=');
+            }
+
+            return encoded;
+        }
+
+        std::string decodeBase64(const std::string &payload) {
+            static const auto s_values = []() {
+                std::array<signed char, 256> values{};
+                values.fill(-1);
+                for (size_t index = 0; index < 64; ++index) {
+                    values[static_cast<unsigned char>(s_base64Chars[index])] = static_cast<signed char>(index);
+                }
+                return values;
+            }();
+
+            std::string decoded;
+            decoded.reserve(payload.size() / 4 * 3);
+
+            // skip the binary mark, stop on the padding (or any invalid character)
+            unsigned int bits = 0;
+            int nbBits        = 0;
+            for (auto itChar = std::next(payload.cbegin()); itChar != payload.cend(); ++itChar) {
+                auto const value = s_values[static_cast<unsigned char>(*itChar)];
+                if (value < 0) {
+                    break;
+                }
+
+                bits = (bits << 6) | static_cast<unsigned int>(value);
+                nbBits += 6;
+                if (nbBits >= 8) {
+                    nbBits -= 8;
+                    decoded.push_back(static_cast<char>((bits >> nbBits) & 0xff));
+                }
+            }
+
+            return decoded;
+        }
+    } // namespace
+
+    std::string getEncodingName(const ServiceEncoding encoding) {
+        return encoding == ServiceEncoding::msgpack ? s_msgPackName : s_jsonName;
+    }
+
+    std::optional<ServiceEncoding> findEncoding(const std::string &encodingName) {
+        if (encodingName == s_jsonName) {
+            return ServiceEncoding::json;
+        }
+        if (encodingName == s_msgPackName) {
+            return ServiceEncoding::msgpack;
+        }
+
+        return {};
+    }
+
+    bool isEncodingAvailable(const ServiceEncoding encoding) {
+        auto const families   = core::getKeyStreamFamilies();
+        auto const familyName = encoding == ServiceEncoding::msgpack ? core::FACTORY_NAME_MSGPACK_STREAM : core::FACTORY_NAME_JSON_STREAM;
+        return std::find(families.cbegin(), families.cend(), familyName) != families.cend();
+    }
+
+    core::KeyStreamPtr<std::string> makeServiceStream(const ServiceEncoding encoding) {
+        return encoding == ServiceEncoding::msgpack ? core::makeMsgPackStream() : core::makeJsonStream();
+    }
+
+    core::KeyStreamPtr<std::string> makeServiceStream(const std::string &payload) {
+        if (getPayloadEncoding(payload) == ServiceEncoding::msgpack) {
+            return core::makeKeyStream(core::FACTORY_NAME_MSGPACK_STREAM, decodeBase64(payload));
+        }
+
+        return core::makeKeyStream(core::FACTORY_NAME_JSON_STREAM, payload);
+    }
+
+    ServiceEncoding getPayloadEncoding(const std::string &payload) {
+        return !payload.empty() && payload.front() == s_binaryMark ? ServiceEncoding::msgpack : ServiceEncoding::json;
+    }
+
+    std::string makePayload(const ServiceEncoding encoding, const core::KeyStream<std::string> &keyStream) {
+        if (encoding == ServiceEncoding::msgpack) {
+            return encodeBase64(keyStream.getBuffer());
+        }
+
+        std::ostringstream oss;
+        oss << keyStream;
+        return oss.str();
+    }
+
+} // namespace NS_OSBASE::application
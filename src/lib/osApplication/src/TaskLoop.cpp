@@ -2,19 +2,106 @@
 // \brief Implementation of the class TaskLoop
 
 #include "osApplication/TaskLoop.h"
+#include "osApplication/TaskLoopPool.h"
 #include "osData/Log.h"
 #include "osCore/Exception/Exception.h"
+#include "osCore/Misc/Scope.h"
 #include "osCore/Misc/ScopeValue.h"
+#include <algorithm>
+#include <condition_variable>
+#include <utility>
 
 namespace {
     const char *runningError = "loop is already running!";
-}
+
+    thread_local const NS_OSBASE::application::TaskLoop *t_pCurrentStrand = nullptr; // strand executed by the current worker
+
+    std::uint64_t toMicroseconds(const std::chrono::system_clock::duration &duration) {
+        auto const count = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        return count > 0 ? static_cast<std::uint64_t>(count) : 0;
+    }
+} // namespace
 
 namespace NS_OSBASE::application {
+    /*
+     * \class TaskLoop::Watchdog
+     */
+    class TaskLoop::Watchdog {
+    public:
+        Watchdog(const TaskLoop &taskLoop, const std::chrono::milliseconds &threshold, IStallDelegateWPtr pDelegate)
+            : m_taskLoop(taskLoop), m_threshold(threshold), m_pDelegate(pDelegate), m_thread([this]() { run(); }) {
+        }
+
+        ~Watchdog() {
+            {
+                const std::lock_guard locker(m_mutex);
+                m_bEnd = true;
+            }
+            m_endCV.notify_all();
+            m_thread.join();
+        }
+
+    private:
+        void run() {
+            auto const period              = std::max(m_threshold / 2, std::chrono::milliseconds(1));
+            std::uint64_t reportedSequence = 0;
+            std::unique_lock<std::mutex> locker(m_mutex);
+            while (!m_endCV.wait_for(locker, period, [this]() { return m_bEnd; })) {
+                // seqlock on the running task: 2 modulo 4 while a task is running
+                auto const sequence = m_taskLoop.m_taskSequence.load(std::memory_order_acquire);
+                if (sequence % 4 != 2 || sequence == reportedSequence) {
+                    continue;
+                }
+
+                auto const start = clock::time_point(clock::duration(m_taskLoop.m_taskStart.load(std::memory_order_relaxed)));
+                auto const pType = m_taskLoop.m_pTaskType.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (m_taskLoop.m_taskSequence.load(std::memory_order_relaxed) != sequence) {
+                    continue;
+                }
+
+                auto const duration = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - start);
+                if (duration < m_threshold) {
+                    continue;
+                }
+
+                reportedSequence = sequence;
+                if (auto const pDelegate = m_pDelegate.lock(); pDelegate != nullptr && pType != nullptr) {
+                    locker.unlock();
+                    pDelegate->onStall(pType->name(), duration);
+                    locker.lock();
+                }
+            }
+        }
+
+        const TaskLoop &m_taskLoop;
+        const std::chrono::milliseconds m_threshold;
+        IStallDelegateWPtr m_pDelegate;
+        std::mutex m_mutex;
+        std::condition_variable m_endCV;
+        bool m_bEnd = false;
+        std::thread m_thread; // last member: started once the others are initialized
+    };
+
+    /*
+     * \class TaskLoop
+     */
+    TaskLoop::TaskLoop() = default;
+
+    TaskLoop::TaskLoop(TaskLoopPool &pool) : m_pPool(&pool) {
+    }
+
     TaskLoop::~TaskLoop() {
         if (isRunning()) {
-            stop();
+            if (isStrand()) {
+                // no more owner: no worker can execute it anymore
+                endStrand(nullptr);
+            } else {
+                stop();
+            }
         }
+
+        setWatchdog(std::chrono::milliseconds::zero(), nullptr);
     }
 
     const TaskQueue::time_point &TaskLoop::getLastTimeStamp() const {
@@ -22,6 +109,11 @@ namespace NS_OSBASE::application {
     }
 
     void TaskLoop::run() {
+        if (isStrand()) {
+            runAsync().get();
+            return;
+        }
+
         m_thId = std::this_thread::get_id();
 
         {
@@ -33,21 +125,10 @@ namespace NS_OSBASE::application {
 
         m_bEnd = false;
         while (!m_bEnd) {
-            if (auto const pTask = m_taskScheduler.waitForTask(); pTask != nullptr) {
-                try {
-                    oscheck::throwIfCrash([&pTask]() { pTask->execute(); });
-                } catch (const core::LogicException &e) {
-                    oslog::error(data::OS_LOG_CHANNEL_APPLICATION) << e.what() << oslog::end();
-                } catch (const core::RuntimeException &e) {
-                    oslog::error(data::OS_LOG_CHANNEL_APPLICATION) << e.what() << oslog::end();
-                    if (auto const pDelegate = m_pRuntimeErrorDelegate.lock(); pDelegate != nullptr) {
-                        pDelegate->onRuntimeError(e.what());
-                    } else {
-                        throw e;
-                    }
-                }
-            }
+            m_taskScheduler.waitForNextTasks(m_batch, m_batchSize);
+            executeBatch();
         }
+        m_batch.clear();
     }
 
     std::shared_future<void> TaskLoop::runAsync() {
@@ -56,6 +137,15 @@ namespace NS_OSBASE::application {
             throw TaskLoopException(runningError);
         }
 
+        if (isStrand()) {
+            m_strandEnd            = std::promise<void>();
+            m_asyncRunSharedReturn = m_strandEnd.get_future().share();
+            m_bStrandRunning       = true;
+            m_bEnd                 = false;
+            wakeUpStrand();
+            return m_asyncRunSharedReturn;
+        }
+
         m_asyncRunSharedReturn = std::async([this]() { run(); }).share();
         return m_asyncRunSharedReturn;
     }
@@ -65,11 +155,18 @@ namespace NS_OSBASE::application {
         return !m_bEnd;
     }
 
+    bool TaskLoop::isStrand() const {
+        return m_pPool != nullptr;
+    }
+
     void TaskLoop::stop() {
         push([this]() { m_bEnd = true; });
-        auto const currentThId = std::this_thread::get_id();
-        if (m_thId != currentThId && m_asyncRunSharedReturn.valid()) {
-            m_asyncRunSharedReturn.wait();
+        if (!isCurrentThread() && m_asyncRunSharedReturn.valid()) {
+            if (isStrand() && m_pPool->isWorkerThread()) {
+                m_pPool->waitHelping(m_asyncRunSharedReturn); // the strand may need this worker to execute its end
+            } else {
+                m_asyncRunSharedReturn.wait();
+            }
         }
         m_bEnd = true;
     }
@@ -77,4 +174,221 @@ namespace NS_OSBASE::application {
     void TaskLoop::setRuntimeErrorDelegate(IRuntimeErrorDelegatePtr pDelegate) {
         m_pRuntimeErrorDelegate = pDelegate;
     }
+
+    size_t TaskLoop::getBatchSize() const {
+        return m_batchSize;
+    }
+
+    void TaskLoop::setBatchSize(const size_t batchSize) {
+        m_batchSize = std::max<size_t>(batchSize, 1);
+    }
+
+    void TaskLoop::setCapacity(const size_t capacity, const TaskQueue::OverflowPolicy policy) {
+        m_taskScheduler.setCapacity(capacity, policy);
+    }
+
+    size_t TaskLoop::getCapacity() const {
+        return m_taskScheduler.getCapacity();
+    }
+
+    TaskQueue::OverflowPolicy TaskLoop::getOverflowPolicy() const {
+        return m_taskScheduler.getOverflowPolicy();
+    }
+
+    TaskQueue::OverflowCounters TaskLoop::getOverflowCounters() const {
+        return m_taskScheduler.getOverflowCounters();
+    }
+
+    void TaskLoop::setStatisticsEnabled(const bool bEnabled) {
+        if (bEnabled && !m_bStatisticsEnabled) {
+            resetStatistics();
+        }
+        m_bStatisticsEnabled = bEnabled;
+    }
+
+    bool TaskLoop::isStatisticsEnabled() const {
+        return m_bStatisticsEnabled;
+    }
+
+    TaskLoopStatistics TaskLoop::getStatistics() const {
+        TaskLoopStatistics statistics;
+        statistics.schedulingDelay = m_schedulingDelay;
+        statistics.executionTime   = m_executionTime;
+        statistics.queueDepth      = m_queueDepth;
+        statistics.duration        = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - m_statisticsStart.load());
+        return statistics;
+    }
+
+    void TaskLoop::resetStatistics() {
+        m_schedulingDelay.reset();
+        m_executionTime.reset();
+        m_queueDepth.reset();
+        m_statisticsStart = clock::now();
+    }
+
+    void TaskLoop::setWatchdog(const std::chrono::milliseconds &threshold, IStallDelegatePtr pDelegate) {
+        const std::lock_guard locker(m_watchdogMutex);
+        m_pWatchdog.reset();
+        m_bWatchdogEnabled = threshold > std::chrono::milliseconds::zero() && pDelegate != nullptr;
+        if (m_bWatchdogEnabled) {
+            m_pWatchdog = std::make_unique<Watchdog>(*this, threshold, pDelegate);
+        }
+    }
+
+    void TaskLoop::executeTask(InlineTask &task) {
+        if (m_bStatisticsEnabled.load(std::memory_order_relaxed) || m_bWatchdogEnabled.load(std::memory_order_relaxed)) {
+            executeInstrumentedTask(task);
+        } else {
+            executeGuardedTask(task);
+        }
+    }
+
+    void TaskLoop::executeGuardedTask(InlineTask &task) {
+        try {
+            oscheck::throwIfCrash([&task]() { task.execute(); });
+        } catch (const core::LogicException &e) {
+            oslog::error(data::OS_LOG_CHANNEL_APPLICATION) << e.what() << oslog::end();
+        } catch (const core::RuntimeException &e) {
+            oslog::error(data::OS_LOG_CHANNEL_APPLICATION) << e.what() << oslog::end();
+            if (auto const pDelegate = m_pRuntimeErrorDelegate.lock(); pDelegate != nullptr) {
+                pDelegate->onRuntimeError(e.what());
+            } else {
+                throw e;
+            }
+        }
+    }
+
+    void TaskLoop::executeInstrumentedTask(InlineTask &task) {
+        auto const start              = clock::now();
+        auto const bStatisticsEnabled = m_bStatisticsEnabled.load(std::memory_order_relaxed);
+        if (bStatisticsEnabled) {
+            m_schedulingDelay.record(toMicroseconds(start - m_taskScheduler.getLastTimeStamp()));
+            m_queueDepth.record(m_taskScheduler.getNbTasks());
+        }
+
+        // published to the watchdog: odd while written, 2 modulo 4 while the task is running
+        auto const sequence = m_taskSequence.load(std::memory_order_relaxed);
+        m_taskSequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_taskStart.store(start.time_since_epoch().count(), std::memory_order_relaxed);
+        m_pTaskType.store(&task.getType(), std::memory_order_relaxed);
+        m_taskSequence.store(sequence + 2, std::memory_order_release);
+
+        auto const endGuard = core::make_scope_exit([this, start, sequence, bStatisticsEnabled]() {
+            m_taskSequence.store(sequence + 4, std::memory_order_release);
+            if (bStatisticsEnabled) {
+                m_executionTime.record(toMicroseconds(clock::now() - start));
+            }
+        });
+        executeGuardedTask(task);
+    }
+
+    size_t TaskLoop::executeBatch() {
+        size_t nbTasks = 0;
+        while (!m_bEnd) {
+            auto task = m_batch.pop();
+            if (task.empty()) {
+                break;
+            }
+
+            ++nbTasks;
+            executeTask(task);
+        }
+
+        return nbTasks;
+    }
+
+    bool TaskLoop::isCurrentThread() const {
+        return isStrand() ? t_pCurrentStrand == this : m_thId == std::this_thread::get_id();
+    }
+
+    void TaskLoop::runStrand() {
+        // called by a worker of the pool: only one worker at a time executes a strand (nested in a strand stopping another one)
+        auto const pPreviousStrand = std::exchange(t_pCurrentStrand, this);
+        m_thId                     = std::this_thread::get_id();
+
+        try {
+            size_t nbTasks = 0;
+            while (nbTasks < s_strandSliceSize && !m_bEnd) {
+                m_taskScheduler.pullNextTasks(m_batch, std::min<size_t>(m_batchSize, s_strandSliceSize - nbTasks));
+                if (m_batch.empty()) {
+                    break;
+                }
+                nbTasks += executeBatch();
+            }
+        } catch (...) {
+            endStrand(std::current_exception());
+        }
+        m_batch.clear();
+
+        if (m_bEnd) {
+            endStrand(nullptr);
+        }
+
+        t_pCurrentStrand = pPreviousStrand;
+        m_bScheduled     = false;
+        std::atomic_thread_fence(std::memory_order_seq_cst); // sees the tasks pushed while m_bScheduled was set (see scheduleStrand())
+        wakeUpStrand();
+    }
+
+    void TaskLoop::scheduleStrand() {
+        if (m_pPool == nullptr || m_bEnd) {
+            return;
+        }
+
+        // the task is ready: the queue is not read (nor its lock taken) to schedule the strand. A strand already scheduled finds the
+        // task when its worker runs it, or when it clears m_bScheduled (see runStrand())
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!m_bScheduled.load() && !m_bScheduled.exchange(true)) {
+            m_pPool->schedule(shared_from_this());
+        }
+    }
+
+    void TaskLoop::wakeUpStrand() {
+        if (m_pPool == nullptr || m_bEnd) {
+            return;
+        }
+
+        auto const nextTimeStamp = m_taskScheduler.getNextTimeStamp();
+        if (nextTimeStamp == TaskQueue::time_point::max()) {
+            return;
+        }
+
+        if (nextTimeStamp <= clock::now()) {
+            if (!m_bScheduled.exchange(true)) {
+                m_pPool->schedule(shared_from_this());
+            }
+            return;
+        }
+
+        const std::lock_guard locker(m_wakeUpMutex);
+        if (nextTimeStamp < m_wakeUpTimeStamp) {
+            m_wakeUpTimeStamp = nextTimeStamp;
+            m_pPool->scheduleAt(nextTimeStamp, weak_from_this());
+        }
+    }
+
+    void TaskLoop::onStrandWakeUp(const TaskQueue::time_point &timestamp) {
+        {
+            const std::lock_guard locker(m_wakeUpMutex);
+            if (m_wakeUpTimeStamp == timestamp) {
+                m_wakeUpTimeStamp = TaskQueue::time_point::max();
+            }
+        }
+
+        wakeUpStrand();
+    }
+
+    void TaskLoop::endStrand(std::exception_ptr pException) {
+        m_bEnd = true;
+        if (!m_bStrandRunning.exchange(false)) {
+            return;
+        }
+
+        if (pException != nullptr) {
+            m_strandEnd.set_exception(pException);
+        } else {
+            m_strandEnd.set_value();
+        }
+    }
 } // namespace NS_OSBASE::application
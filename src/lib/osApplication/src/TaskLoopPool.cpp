@@ -0,0 +1,158 @@
+// \file  TaskLoopPool.cpp
+// \brief Implementation of the class TaskLoopPool
+
+#include "osApplication/TaskLoopPool.h"
+#include <algorithm>
+
+namespace {
+    thread_local const NS_OSBASE::application::TaskLoopPool *t_pCurrentPool = nullptr; // pool of the current worker
+    thread_local size_t t_nCurrentWorker                                     = 0;       // index of the current worker
+} // namespace
+
+namespace NS_OSBASE::application {
+
+    /*
+     * \class TaskLoopPool
+     */
+    TaskLoopPoolPtr TaskLoopPool::create(const size_t nbWorkers) {
+        return TaskLoopPoolPtr(new TaskLoopPool(std::max<size_t>(nbWorkers, 1)));
+    }
+
+    TaskLoopPoolPtr TaskLoopPool::getShared() {
+        static std::mutex mutex;
+        static std::weak_ptr<TaskLoopPool> pWSharedPool; // not owned: the workers are not joined by the destruction of the statics
+
+        const std::lock_guard locker(mutex);
+        auto pSharedPool = pWSharedPool.lock();
+        if (pSharedPool == nullptr) {
+            pSharedPool  = create();
+            pWSharedPool = pSharedPool;
+        }
+        return pSharedPool;
+    }
+
+    TaskLoopPool::TaskLoopPool(const size_t nbWorkers) {
+        m_timerLoop.runAsync();
+
+        for (size_t nWorker = 0; nWorker < nbWorkers; ++nWorker) {
+            m_workers.push_back(std::make_unique<Worker>());
+        }
+
+        for (size_t nWorker = 0; nWorker < nbWorkers; ++nWorker) {
+            m_workers[nWorker]->thread = std::thread([this, nWorker]() { runWorker(nWorker); });
+        }
+    }
+
+    TaskLoopPool::~TaskLoopPool() {
+        {
+            const std::lock_guard locker(m_readyMutex);
+            m_bEnd = true;
+        }
+        m_readyCV.notify_all();
+
+        for (auto const &pWorker : m_workers) {
+            pWorker->thread.join();
+        }
+
+        m_timerLoop.stop();
+    }
+
+    TaskLoopPtr TaskLoopPool::makeStrand() {
+        return TaskLoopPtr(new TaskLoop(*this));
+    }
+
+    size_t TaskLoopPool::getWorkerCount() const {
+        return m_workers.size();
+    }
+
+    void TaskLoopPool::schedule(TaskLoopPtr pStrand) {
+        // a strand rescheduled by a worker stays on this worker (cache locality), the others are dispatched round robin
+        auto const nWorker = t_pCurrentPool == this ? t_nCurrentWorker : m_nextWorker++ % m_workers.size();
+        auto &worker       = *m_workers[nWorker];
+
+        m_nbReadyStrands.fetch_add(1);
+        {
+            const std::lock_guard locker(worker.mutex);
+            worker.readyStrands.push_back(std::move(pStrand));
+        }
+
+        // seen by a worker going to sleep, or the worker is seen sleeping (both sequentially consistent): no lost wake-up
+        if (m_nbSleepingWorkers.load() != 0) {
+            const std::lock_guard locker(m_readyMutex);
+            m_readyCV.notify_one();
+        }
+    }
+
+    void TaskLoopPool::scheduleAt(const TaskQueue::time_point &timestamp, TaskLoopWPtr pStrand) {
+        auto const delay = std::max(std::chrono::ceil<std::chrono::milliseconds>(timestamp - TaskQueue::clock::now()),
+            std::chrono::milliseconds::zero());
+
+        m_timerLoop.pushSingleShot(delay, [pStrand, timestamp]() {
+            if (auto const pLockedStrand = pStrand.lock(); pLockedStrand != nullptr) {
+                pLockedStrand->onStrandWakeUp(timestamp);
+            }
+        });
+    }
+
+    void TaskLoopPool::runWorker(const size_t nWorker) {
+        t_pCurrentPool   = this;
+        t_nCurrentWorker = nWorker;
+
+        while (!m_bEnd) {
+            if (auto const pStrand = popStrand(nWorker); pStrand != nullptr) {
+                pStrand->runStrand();
+                continue;
+            }
+
+            std::unique_lock locker(m_readyMutex);
+            m_nbSleepingWorkers.fetch_add(1);
+            m_readyCV.wait(locker, [this]() { return m_nbReadyStrands.load() != 0 || m_bEnd; });
+            m_nbSleepingWorkers.fetch_sub(1);
+        }
+    }
+
+    TaskLoopPtr TaskLoopPool::popStrand(const size_t nWorker) {
+        // own deque first (FIFO: the strands of a worker are executed in turn), then steal from the back of the others
+        auto const nbWorkers = m_workers.size();
+        for (size_t nOffset = 0; nOffset < nbWorkers; ++nOffset) {
+            auto &worker = *m_workers[(nWorker + nOffset) % nbWorkers];
+            TaskLoopPtr pStrand;
+
+            {
+                const std::lock_guard locker(worker.mutex);
+                if (worker.readyStrands.empty()) {
+                    continue;
+                }
+
+                if (nOffset == 0) {
+                    pStrand = std::move(worker.readyStrands.front());
+                    worker.readyStrands.pop_front();
+                } else {
+                    pStrand = std::move(worker.readyStrands.back());
+                    worker.readyStrands.pop_back();
+                }
+            }
+
+            m_nbReadyStrands.fetch_sub(1);
+            return pStrand;
+        }
+
+        return nullptr;
+    }
+
+    bool TaskLoopPool::isWorkerThread() const {
+        return t_pCurrentPool == this;
+    }
+
+    void TaskLoopPool::waitHelping(const std::shared_future<void> &end) {
+        // the awaited strand may need this worker: the worker keeps executing the ready strands, the current one is not queued
+        constexpr auto pollingPeriod = std::chrono::milliseconds(1);
+        while (end.wait_for(std::chrono::milliseconds::zero()) != std::future_status::ready) {
+            if (auto const pStrand = popStrand(t_nCurrentWorker); pStrand != nullptr) {
+                pStrand->runStrand();
+            } else {
+                end.wait_for(pollingPeriod);
+            }
+        }
+    }
+} // namespace NS_OSBASE::application
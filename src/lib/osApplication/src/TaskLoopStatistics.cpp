@@ -0,0 +1,124 @@
+// \file  TaskLoopStatistics.cpp
+// \brief Implementation of the classes Histogram and TaskLoopStatistics
+
+#include "osApplication/TaskLoopStatistics.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace NS_OSBASE::application {
+
+    /*
+     * \class Histogram
+     */
+    Histogram::Histogram(const Histogram &other) {
+        *this = other;
+    }
+
+    Histogram &Histogram::operator=(const Histogram &other) {
+        if (this != &other) {
+            for (std::size_t index = 0; index < s_nbBuckets; ++index) {
+                m_buckets[index].store(other.m_buckets[index].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            m_count.store(other.m_count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            m_sum.store(other.m_sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            m_max.store(other.m_max.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+    void Histogram::record(const std::uint64_t value) {
+        m_buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+
+        auto max = m_max.load(std::memory_order_relaxed);
+        while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    void Histogram::reset() {
+        for (auto &bucket : m_buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+
+    std::uint64_t Histogram::getCount() const {
+        return m_count.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t Histogram::getSum() const {
+        return m_sum.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t Histogram::getMax() const {
+        return m_max.load(std::memory_order_relaxed);
+    }
+
+    double Histogram::getMean() const {
+        auto const count = getCount();
+        return count == 0 ? 0. : static_cast<double>(getSum()) / static_cast<double>(count);
+    }
+
+    std::uint64_t Histogram::getPercentile(const double percentile) const {
+        std::uint64_t count = 0;
+        for (auto const &bucket : m_buckets) {
+            count += bucket.load(std::memory_order_relaxed);
+        }
+
+        if (count == 0) {
+            return 0;
+        }
+
+        auto const rank = std::max<std::uint64_t>(
+            static_cast<std::uint64_t>(std::ceil(std::clamp(percentile, 0., 100.) * static_cast<double>(count) / 100.)), 1);
+        std::uint64_t cumulatedCount = 0;
+        for (std::size_t index = 0; index < s_nbBuckets; ++index) {
+            cumulatedCount += m_buckets[index].load(std::memory_order_relaxed);
+            if (cumulatedCount >= rank) {
+                return std::min(getBucketUpperBound(index), getMax());
+            }
+        }
+
+        return getMax();
+    }
+
+    std::uint64_t Histogram::getBucketCount(const std::size_t index) const {
+        return index < s_nbBuckets ? m_buckets[index].load(std::memory_order_relaxed) : 0;
+    }
+
+    std::uint64_t Histogram::getBucketUpperBound(const std::size_t index) {
+        if (index + 1 >= s_nbBuckets) {
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+
+        return (std::uint64_t(1) << index) - 1;
+    }
+
+    std::size_t Histogram::getBucketIndex(const std::uint64_t value) {
+        std::size_t index = 0;
+        for (auto remaining = value; remaining != 0 && index + 1 < s_nbBuckets; remaining >>= 1) {
+            ++index;
+        }
+        return index;
+    }
+
+    /*
+     * \struct TaskLoopStatistics
+     */
+    std::uint64_t TaskLoopStatistics::getNbTasks() const {
+        return executionTime.getCount();
+    }
+
+    double TaskLoopStatistics::getTasksPerSecond() const {
+        if (duration <= std::chrono::milliseconds::zero()) {
+            return 0.;
+        }
+
+        return static_cast<double>(getNbTasks()) * 1000. / static_cast<double>(duration.count());
+    }
+
+} // namespace NS_OSBASE::application
@@ -6,6 +6,76 @@
 
 namespace NS_OSBASE::application {
 
+    /*
+     * \class TaskQueue::CoalescedTask
+     */
+    class TaskQueue::CoalescedTask final : public ITask {
+    public:
+        explicit CoalescedTask(ITaskPtr pTask) : m_pTask(std::move(pTask)) {
+        }
+
+        void execute() override {
+            if (m_bEnabled) {
+                std::atomic_load(&m_pTask)->execute();
+            }
+        }
+
+        bool isEnabled() const override {
+            return m_bEnabled;
+        }
+
+        void setEnabled(const bool bEnabled) override {
+            m_bEnabled = bEnabled;
+        }
+
+        ITaskPtr getTask() const {
+            return std::atomic_load(&m_pTask);
+        }
+
+        void setTask(ITaskPtr pTask) {
+            std::atomic_store(&m_pTask, std::move(pTask));
+        }
+
+    private:
+        ITaskPtr m_pTask; // last pushed task
+        std::atomic_bool m_bEnabled = true;
+    };
+
+    /*
+     * \class TaskQueue::Batch
+     */
+    TaskQueue::Batch::~Batch() {
+        clear();
+    }
+
+    InlineTask TaskQueue::Batch::pop() {
+        if (empty())
+            return InlineTask();
+
+        if (m_pTaskQueue->m_nbCriticals != m_nbCriticals) {
+            // a critical task must be executed before the remaining ones
+            clear();
+            return InlineTask();
+        }
+
+        auto &entry                  = m_entries[m_nextEntry++];
+        m_pTaskQueue->m_lastTimeStamp = entry.timestamp;
+        return toInlineTask(std::move(entry));
+    }
+
+    bool TaskQueue::Batch::empty() const {
+        return m_nextEntry == m_entries.size();
+    }
+
+    void TaskQueue::Batch::clear() {
+        if (!empty()) {
+            m_pTaskQueue->giveBackEntries(*this);
+        }
+
+        m_entries.clear();
+        m_nextEntry = 0;
+    }
+
     /*
      * \class TaskQueue
      */
@@ -14,95 +84,670 @@ namespace NS_OSBASE::application {
     }
 
     ITaskPtr TaskQueue::waitUntilTask(const time_point &timestamp) {
-        std::unique_lock<std::mutex> locker(m_scheduledTasksMutex);
-        ITaskPtr pTask;
-        bool bTimestampReached = false;
-        do {
-            auto const taskTimestamp         = m_scheduledTasks.empty() ? timestamp : m_scheduledTasks.front().timestamp;
-            const bool bWaitForTaskTimeStamp = taskTimestamp < timestamp;
-            m_lastTimeStamp                  = taskTimestamp < timestamp ? taskTimestamp : timestamp;
+        return toTaskPtr(waitUntilEntry(timestamp));
+    }
 
-            bTimestampReached = m_scheduledTasksCV.wait_until(locker, m_lastTimeStamp) == std::cv_status::timeout;
-            if (bTimestampReached && bWaitForTaskTimeStamp) {
-                locker.unlock();
-                pTask = popTask(m_lastTimeStamp);
-            }
-        } while (!bTimestampReached && !m_scheduledTasks.empty());
+    ITaskPtr TaskQueue::pullTask() {
+        return toTaskPtr(pullEntry());
+    }
 
-        return pTask;
+    InlineTask TaskQueue::pullNextTask() {
+        return toInlineTask(pullEntry());
     }
 
-    ITaskPtr TaskQueue::pullTask() {
-        std::unique_lock<std::mutex> locker(m_scheduledTasksMutex);
-        if (m_scheduledTasks.empty())
-            return nullptr;
+    InlineTask TaskQueue::waitForNextTask(const std::chrono::milliseconds &delay) {
+        return toInlineTask(
+            waitUntilEntry(delay == std::chrono::milliseconds::max() ? std::chrono::time_point<clock>::max() : clock::now() + delay));
+    }
 
-        ITaskPtr pTask;
-        auto const now           = clock::now();
-        auto const taskTimestamp = m_scheduledTasks.front().timestamp;
+    void TaskQueue::pullNextTasks(Batch &batch, const size_t maxCount) {
+        batch.clear();
 
-        if (taskTimestamp <= now) {
-            m_lastTimeStamp = taskTimestamp;
-            locker.unlock();
-            pTask = popTask(taskTimestamp);
+        Locker locker(m_scheduledTasksMutex);
+        if (isReadyTask(locker)) {
+            takeEntries(locker, batch, maxCount);
         }
+    }
 
-        return pTask;
+    void TaskQueue::waitForNextTasks(Batch &batch, const size_t maxCount, const std::chrono::milliseconds &delay) {
+        batch.clear();
+
+        Locker locker(m_scheduledTasksMutex);
+        if (waitUntilReadyTask(locker,
+                delay == std::chrono::milliseconds::max() ? std::chrono::time_point<clock>::max() : clock::now() + delay)) {
+            takeEntries(locker, batch, maxCount);
+        }
     }
 
     bool TaskQueue::isRemainingTasks() const {
         std::unique_lock<std::mutex> locker(m_scheduledTasksMutex);
-        return !m_scheduledTasks.empty();
+        return hasEntries() || !m_intakeTasks.empty();
+    }
+
+    TaskQueue::time_point TaskQueue::getNextTimeStamp() {
+        Locker locker(m_scheduledTasksMutex);
+        mergeIntakeTasks(locker);
+        return getTopTimeStamp();
     }
 
     void TaskQueue::clearTasks() {
-        std::unique_lock<std::mutex> locker(m_scheduledTasksMutex);
-        m_scheduledTasks.clear();
+        Locker locker(m_scheduledTasksMutex);
+        mergeIntakeTasks(locker);
+        for (auto &lane : m_lanes) {
+            m_nbTasks -= lane.scheduledTasks.size() + lane.deadlineTasks.size() + lane.readyTasks.size();
+            lane.scheduledTasks.clear();
+            lane.deadlineTasks.clear();
+            lane.readyTasks.clear();
+            lane.nbSkips = 0;
+        }
+        m_coalescedTasks.clear();
+        m_notFullCV.notify_all();
     }
 
     const TaskQueue::time_point &TaskQueue::getLastTimeStamp() const {
         return m_lastTimeStamp;
     }
 
-    ITaskPtr TaskQueue::pushScheduledTask(
-        const time_point &timeStampRef, const std::chrono::milliseconds &delay, ITaskPtr pTask, const bool bRepeated) {
-        using namespace std::chrono_literals;
+    void TaskQueue::setCapacity(const size_t capacity, const OverflowPolicy policy) {
+        const std::lock_guard<std::mutex> locker(m_scheduledTasksMutex);
+        m_capacity       = capacity;
+        m_overflowPolicy = policy;
+        m_notFullCV.notify_all();
+    }
+
+    size_t TaskQueue::getCapacity() const {
+        return m_capacity;
+    }
+
+    TaskQueue::OverflowPolicy TaskQueue::getOverflowPolicy() const {
+        return m_overflowPolicy;
+    }
+
+    TaskQueue::OverflowCounters TaskQueue::getOverflowCounters() const {
+        return { m_nbRejectedTasks, m_nbDroppedTasks, m_nbBlockedPushes };
+    }
+
+    size_t TaskQueue::getNbTasks() const {
+        return m_nbTasks;
+    }
 
+    ITaskPtr TaskQueue::pushScheduledTask(const TaskAttributes &attributes,
+        const time_point &timeStampRef,
+        const std::chrono::milliseconds &delay,
+        ITaskPtr pTask,
+        const bool bRepeated) {
         if (pTask == nullptr)
             return nullptr;
 
-        std::unique_lock<std::mutex> locker(m_scheduledTasksMutex);
+        Entry entry{ timeStampRef, pTask, bRepeated ? delay : std::chrono::milliseconds::min(), 0, InlineTask(), attributes };
+        switch (admitEntry(entry)) {
+        case Admission::rejected:
+            return nullptr;
+        case Admission::coalesced:
+            return pTask;
+        case Admission::accepted:
+            break;
+        }
+
+        if (delay == std::chrono::milliseconds::zero() && !bRepeated) {
+            pushIntakeTask(std::move(entry));
+            return pTask;
+        }
+
+        Locker locker(m_scheduledTasksMutex);
+        pushScheduledTask(locker, timeStampRef, delay, std::move(entry));
+        return pTask;
+    }
+
+    void TaskQueue::pushScheduledTask(
+        Locker &locker, const time_point &timeStampRef, const std::chrono::milliseconds &delay, Entry &&entry) {
+        using namespace std::chrono_literals;
+        mergeIntakeTasks(locker);
 
-        time_point timeStamp;
         if (delay == std::chrono::milliseconds::min()) {
-            if (m_scheduledTasks.empty())
-                timeStamp = timeStampRef;
+            if (!hasEntries())
+                entry.timestamp = timeStampRef;
             else
-                timeStamp = std::min(m_scheduledTasks.front().timestamp, timeStampRef) - 1ms;
+                entry.timestamp = std::min(getTopTimeStamp(), timeStampRef) - 1ms;
+
+            if (!m_immediateTimeStamp.has_value())
+                m_immediateTimeStamp = entry.timestamp;
         } else {
-            timeStamp = timeStampRef + delay;
+            // saturated: an infinite delay (milliseconds::max()) must not overflow the time point
+            auto const margin = std::chrono::duration_cast<std::chrono::milliseconds>(time_point::max() - timeStampRef);
+            entry.timestamp   = delay >= margin ? time_point::max() : timeStampRef + delay;
         }
 
-        m_scheduledTasks.push_back(ScheduledTask({ timeStamp, pTask, bRepeated ? delay : std::chrono::milliseconds::min() }));
-        m_scheduledTasks.sort([](auto const &lhs, auto const &rhs) { return lhs.timestamp < rhs.timestamp; });
+        auto const bCritical = entry.attributes.priority == TaskPriority::critical;
+        storeEntry(std::move(entry));
+        if (bCritical) {
+            ++m_nbCriticals;
+        }
         m_scheduledTasksCV.notify_one();
-        return pTask;
     }
 
-    ITaskPtr TaskQueue::popTask(const time_point &timeStamp) {
+    void TaskQueue::postScheduledTask(const TaskAttributes &attributes, InlineTask &&task) {
+        Entry entry{ clock::now(), nullptr, std::chrono::milliseconds::min(), 0, std::move(task), attributes };
+        if (admitEntry(entry) == Admission::accepted) {
+            pushIntakeTask(std::move(entry));
+        }
+    }
+
+    ITaskPtr TaskQueue::pushCoalescedScheduledTask(
+        const TaskAttributes &attributes, const std::chrono::milliseconds &delay, ITaskPtr pTask, const Coalescing coalescing) {
+        if (pTask == nullptr)
+            return nullptr;
+
+        if (attributes.key.empty()) {
+            return pushScheduledTask(attributes, clock::now(), delay, pTask, coalescing == Coalescing::throttle);
+        }
+
+        auto const now = clock::now();
+        Locker locker(m_scheduledTasksMutex);
+        mergeIntakeTasks(locker);
+
+        if (coalescing != Coalescing::debounce) {
+            if (auto pPendingTask = findCoalescedTask(attributes.key); pPendingTask != nullptr) {
+                // the pending task keeps its place and executes the last pushed callback
+                pPendingTask->setTask(std::move(pTask));
+                return pPendingTask;
+            }
+        }
+
+        auto pCoalescedTask = std::make_shared<CoalescedTask>(std::move(pTask));
+        Entry entry{ now,
+            pCoalescedTask,
+            coalescing == Coalescing::throttle ? delay : std::chrono::milliseconds::min(),
+            0,
+            InlineTask(),
+            attributes };
+        if (!tryReserveTask(m_capacity)) {
+            switch (admitOverflowEntry(locker, entry)) {
+            case Admission::rejected:
+                return nullptr;
+            case Admission::coalesced:
+                m_coalescedTasks.try_emplace(attributes.key, pCoalescedTask);
+                return findCoalescedTask(attributes.key);
+            case Admission::accepted:
+                break;
+            }
+        }
+
+        // the lock may have been released while waiting for a free place
+        if (auto pPendingTask = findCoalescedTask(attributes.key); pPendingTask != nullptr) {
+            if (coalescing != Coalescing::debounce) {
+                pPendingTask->setTask(pCoalescedTask->getTask());
+                releaseTask();
+                return pPendingTask;
+            }
+
+            // debounce: the pending task is cancelled, the pushed one is delayed
+            pPendingTask->setEnabled(false);
+        }
+
+        m_coalescedTasks[attributes.key] = pCoalescedTask;
+        pushScheduledTask(locker, now, delay, std::move(entry));
+        return pCoalescedTask;
+    }
+
+    TaskQueue::CoalescedTaskPtr TaskQueue::findCoalescedTask(const std::string &key) {
+        auto const itTask = m_coalescedTasks.find(key);
+        if (itTask == m_coalescedTasks.end())
+            return nullptr;
+
+        if (!itTask->second->isEnabled()) {
+            // cancelled by the owner of the task
+            m_coalescedTasks.erase(itTask);
+            return nullptr;
+        }
+
+        return itTask->second;
+    }
+
+    void TaskQueue::forgetCoalescedTask(const Entry &entry) {
+        if (entry.attributes.key.empty())
+            return;
+
+        auto const itTask = m_coalescedTasks.find(entry.attributes.key);
+        if (itTask != m_coalescedTasks.end() && itTask->second == entry.pTask) {
+            m_coalescedTasks.erase(itTask);
+        }
+    }
+
+    void TaskQueue::takeCoalescedTask(Entry &entry) {
         using namespace std::chrono_literals;
-        std::unique_lock<std::mutex> locker(m_scheduledTasksMutex);
-        auto const scheduledTask = m_scheduledTasks.front();
-        m_scheduledTasks.pop_front();
 
-        auto pTask = scheduledTask.pTask;
+        if (entry.attributes.key.empty())
+            return;
 
-        if (pTask->isEnabled() && scheduledTask.delayRepetition >= 0ms) {
-            locker.unlock();
-            pushScheduledTask(timeStamp, scheduledTask.delayRepetition, pTask, true);
+        auto const itTask = m_coalescedTasks.find(entry.attributes.key);
+        if (itTask == m_coalescedTasks.end() || itTask->second != entry.pTask)
+            return;
+
+        auto const pCoalescedTask = itTask->second;
+        if (!pCoalescedTask->isEnabled() || entry.delayRepetition < 0ms) {
+            m_coalescedTasks.erase(itTask);
         }
 
-        return pTask;
+        if (pCoalescedTask->isEnabled()) {
+            // the executed task is the last pushed one: a further push doesn't modify it
+            entry.pTask = pCoalescedTask->getTask();
+        }
+    }
+
+    void TaskQueue::pushIntakeTask(Entry &&entry) {
+        auto const bCritical = entry.attributes.priority == TaskPriority::critical;
+        if (!m_intakeTasks.tryPush(std::move(entry))) {
+            // full ring: the entries are merged first to keep the order
+            Locker locker(m_scheduledTasksMutex);
+            mergeIntakeTasks(locker);
+            storeEntry(std::move(entry));
+            if (bCritical) {
+                ++m_nbCriticals;
+            }
+            m_scheduledTasksCV.notify_one();
+            return;
+        }
+
+        if (bCritical) {
+            ++m_nbCriticals;
+        }
+
+        // the consumer sets the flag before checking the ring: if it didn't see the entry, the flag is seen here
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_bConsumerWaiting) {
+            const std::lock_guard<std::mutex> locker(m_scheduledTasksMutex);
+            m_scheduledTasksCV.notify_one();
+        }
+    }
+
+    TaskQueue::Admission TaskQueue::admitEntry(Entry &entry) {
+        if (tryReserveTask(m_capacity)) {
+            return Admission::accepted;
+        }
+
+        // full queue
+        Locker locker(m_scheduledTasksMutex);
+        mergeIntakeTasks(locker);
+        return admitOverflowEntry(locker, entry);
+    }
+
+    TaskQueue::Admission TaskQueue::admitOverflowEntry(Locker &locker, Entry &entry) {
+        switch (m_overflowPolicy.load()) {
+        case OverflowPolicy::block:
+            if (std::this_thread::get_id() == m_consumerThreadId) {
+                // the consumer would wait for itself
+                ++m_nbTasks;
+                return Admission::accepted;
+            }
+
+            ++m_nbBlockedPushes;
+            ++m_nbBlockedProducers;
+            while (!tryReserveTask(m_capacity)) {
+                m_notFullCV.wait(locker);
+            }
+            --m_nbBlockedProducers;
+            return Admission::accepted;
+
+        case OverflowPolicy::dropOldest:
+            if (dropOldestEntry(entry.attributes.priority)) {
+                // the place of the dropped task is taken by the pushed one
+                ++m_nbDroppedTasks;
+                return Admission::accepted;
+            }
+            break;
+
+        case OverflowPolicy::coalesce:
+            if (coalesceEntry(entry)) {
+                ++m_nbDroppedTasks;
+                return Admission::coalesced;
+            }
+            break;
+
+        case OverflowPolicy::dropNewest:
+            break;
+        }
+
+        ++m_nbRejectedTasks;
+        return Admission::rejected;
+    }
+
+    bool TaskQueue::tryReserveTask(const size_t capacity) {
+        if (capacity == 0) {
+            ++m_nbTasks;
+            return true;
+        }
+
+        auto nbTasks = m_nbTasks.load();
+        do {
+            if (nbTasks >= capacity) {
+                return false;
+            }
+        } while (!m_nbTasks.compare_exchange_weak(nbTasks, nbTasks + 1));
+
+        return true;
+    }
+
+    void TaskQueue::releaseTask() {
+        --m_nbTasks;
+        if (m_nbBlockedProducers != 0) {
+            m_notFullCV.notify_one();
+        }
+    }
+
+    bool TaskQueue::dropOldestEntry(const TaskPriority priority) {
+        using namespace std::chrono_literals;
+
+        // the first pushed of the ready tasks: a repeated task is never dropped, its next repetition is pushed when it is pulled
+        auto const now         = clock::now();
+        auto const isDroppable = [&now](const Entry &entry) { return entry.delayRepetition < 0ms && entry.timestamp <= now; };
+        for (auto index = s_nbLanes; index-- > static_cast<size_t>(priority);) {
+            auto &lane = m_lanes[index];
+            isReadyLane(lane, now);
+
+            auto itReadyEntry = lane.readyTasks.end();
+            for (auto itEntry = lane.readyTasks.begin(); itEntry != lane.readyTasks.end(); ++itEntry) {
+                if ((itReadyEntry == lane.readyTasks.end() || itEntry->sequence < itReadyEntry->sequence) && isDroppable(*itEntry)) {
+                    itReadyEntry = itEntry;
+                }
+            }
+
+            auto const pScheduledEntry = lane.scheduledTasks.findFirstIf(isDroppable);
+            auto const bReadyEntry     = itReadyEntry != lane.readyTasks.end();
+            if (pScheduledEntry != nullptr && (!bReadyEntry || pScheduledEntry->sequence < itReadyEntry->sequence)) {
+                forgetCoalescedTask(lane.scheduledTasks.extract(pScheduledEntry));
+                return true;
+            }
+
+            if (bReadyEntry) {
+                auto const entry = std::move(*itReadyEntry);
+                lane.readyTasks.erase(itReadyEntry);
+                std::make_heap(lane.readyTasks.begin(), lane.readyTasks.end(), &TaskQueue::isLaterDeadline);
+                forgetCoalescedTask(entry);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool TaskQueue::coalesceEntry(Entry &entry) {
+        if (entry.attributes.key.empty()) {
+            return false;
+        }
+
+        if (auto pPendingTask = findCoalescedTask(entry.attributes.key); pPendingTask != nullptr && entry.pTask != nullptr) {
+            pPendingTask->setTask(std::move(entry.pTask));
+            return true;
+        }
+
+        auto const isSameKey = [&key = entry.attributes.key](const Entry &pendingEntry) {
+            return pendingEntry.attributes.key == key && (pendingEntry.pTask == nullptr || pendingEntry.pTask->isEnabled());
+        };
+        for (auto &lane : m_lanes) {
+            auto pPendingEntry = lane.scheduledTasks.findIf(isSameKey);
+            if (pPendingEntry == nullptr) {
+                pPendingEntry = lane.deadlineTasks.findIf(isSameKey);
+            }
+            if (pPendingEntry == nullptr) {
+                auto const itEntry = std::find_if(lane.readyTasks.begin(), lane.readyTasks.end(), isSameKey);
+                pPendingEntry      = itEntry == lane.readyTasks.end() ? nullptr : &*itEntry;
+            }
+
+            if (pPendingEntry != nullptr) {
+                // the pushed task takes the place of the pending one
+                forgetCoalescedTask(*pPendingEntry);
+                pPendingEntry->pTask = std::move(entry.pTask);
+                pPendingEntry->task  = std::move(entry.task);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void TaskQueue::mergeIntakeTasks(Locker &) {
+        Entry entry;
+        while (m_intakeTasks.tryPop(entry)) {
+            storeEntry(std::move(entry));
+        }
+    }
+
+    void TaskQueue::storeEntry(Entry &&entry) {
+        // order of insertion over all the lanes and wheels
+        entry.sequence = m_sequence++;
+        restoreEntry(std::move(entry));
+    }
+
+    void TaskQueue::restoreEntry(Entry &&entry) {
+        auto &lane = getLane(entry.attributes.priority);
+        if (entry.attributes.deadline == std::chrono::milliseconds::max()) {
+            lane.scheduledTasks.repush(std::move(entry));
+        } else {
+            lane.deadlineTasks.repush(std::move(entry));
+        }
+    }
+
+    bool TaskQueue::hasEntries() const {
+        return std::any_of(m_lanes.cbegin(), m_lanes.cend(), [](const Lane &lane) {
+            return !lane.scheduledTasks.empty() || !lane.deadlineTasks.empty() || !lane.readyTasks.empty();
+        });
+    }
+
+    TaskQueue::time_point TaskQueue::getTopTimeStamp() {
+        auto timeStamp = time_point::max();
+        for (auto &lane : m_lanes) {
+            if (!lane.readyTasks.empty()) {
+                timeStamp = std::min(timeStamp, lane.readyTasks.front().timestamp);
+            }
+            if (!lane.scheduledTasks.empty()) {
+                timeStamp = std::min(timeStamp, lane.scheduledTasks.top().timestamp);
+            }
+            if (!lane.deadlineTasks.empty()) {
+                timeStamp = std::min(timeStamp, lane.deadlineTasks.top().timestamp);
+            }
+        }
+        return timeStamp;
+    }
+
+    std::optional<TaskQueue::Entry> TaskQueue::pullEntry() {
+        Locker locker(m_scheduledTasksMutex);
+        mergeIntakeTasks(locker);
+
+        m_consumerThreadId = std::this_thread::get_id();
+        auto entry         = popReadyEntry(locker, clock::now());
+        if (entry.has_value()) {
+            m_lastTimeStamp = entry->timestamp;
+        }
+        return entry;
+    }
+
+    std::optional<TaskQueue::Entry> TaskQueue::waitUntilEntry(const time_point &timestamp) {
+        Locker locker(m_scheduledTasksMutex);
+        m_consumerThreadId = std::this_thread::get_id();
+        if (!waitUntilReadyTask(locker, timestamp))
+            return std::nullopt;
+
+        auto entry = popReadyEntry(locker, std::max(clock::now(), m_lastTimeStamp));
+        if (entry.has_value()) {
+            m_lastTimeStamp = entry->timestamp;
+        }
+        return entry;
+    }
+
+    bool TaskQueue::isReadyTask(Locker &locker) {
+        mergeIntakeTasks(locker);
+        return getTopTimeStamp() <= clock::now();
+    }
+
+    bool TaskQueue::waitUntilReadyTask(Locker &locker, const time_point &timestamp) {
+        bool bTimestampReached = false;
+        do {
+            mergeIntakeTasks(locker);
+
+            auto const taskTimestamp         = std::min(getTopTimeStamp(), timestamp);
+            const bool bWaitForTaskTimeStamp = taskTimestamp < timestamp;
+            m_lastTimeStamp                  = taskTimestamp;
+
+            if (bWaitForTaskTimeStamp && taskTimestamp <= clock::now()) {
+                // already ready: no need to sleep
+                return true;
+            }
+
+            // eventcount: the flag is set before checking the ring, the producers check it after their push
+            m_bConsumerWaiting = true;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_intakeTasks.empty()) {
+                bTimestampReached = m_scheduledTasksCV.wait_until(locker, m_lastTimeStamp) == std::cv_status::timeout;
+            }
+            m_bConsumerWaiting = false;
+
+            mergeIntakeTasks(locker);
+            if (bTimestampReached && bWaitForTaskTimeStamp) {
+                return hasEntries();
+            }
+        } while (!bTimestampReached && hasEntries());
+
+        return false;
+    }
+
+    std::optional<TaskQueue::Entry> TaskQueue::popReadyEntry(Locker &locker, const time_point &now) {
+        using namespace std::chrono_literals;
+
+        // the highest ready lane, unless a lower ready lane has been skipped too many times
+        std::array<bool, s_nbLanes> readyLanes{};
+        std::optional<size_t> selectedLane;
+        for (size_t index = 0; index < s_nbLanes; ++index) {
+            readyLanes[index] = isReadyLane(m_lanes[index], now);
+            if (readyLanes[index] && (!selectedLane.has_value() || m_lanes[index].nbSkips >= s_starvationLimit)) {
+                selectedLane = index;
+            }
+        }
+
+        if (!selectedLane.has_value())
+            return std::nullopt;
+
+        for (size_t index = 0; index < s_nbLanes; ++index) {
+            auto &nbSkips = m_lanes[index].nbSkips;
+            nbSkips       = readyLanes[index] && index != *selectedLane ? nbSkips + 1 : 0;
+        }
+
+        auto entry = popLaneEntry(m_lanes[*selectedLane]);
+        releaseTask();
+
+        if (entry.pTask != nullptr && entry.pTask->isEnabled() && entry.delayRepetition >= 0ms) {
+            ++m_nbTasks;
+            pushScheduledTask(locker,
+                entry.timestamp,
+                entry.delayRepetition,
+                { time_point(), entry.pTask, entry.delayRepetition, 0, InlineTask(), entry.attributes });
+        }
+
+        takeCoalescedTask(entry);
+        return entry;
+    }
+
+    void TaskQueue::takeEntries(Locker &locker, Batch &batch, const size_t maxCount) {
+        batch.m_pTaskQueue  = this;
+        batch.m_nbCriticals = m_nbCriticals;
+        m_consumerThreadId  = std::this_thread::get_id();
+        m_immediateTimeStamp.reset();
+
+        auto const now = clock::now();
+        while (batch.m_entries.size() < maxCount) {
+            auto entry = popReadyEntry(locker, now);
+            if (!entry.has_value()) {
+                break;
+            }
+            batch.m_entries.push_back(std::move(*entry));
+        }
+    }
+
+    void TaskQueue::giveBackEntries(Batch &batch) {
+        Locker locker(m_scheduledTasksMutex);
+
+        auto const bInterrupted = m_nbCriticals != batch.m_nbCriticals;
+        m_nbTasks += batch.m_entries.size() - batch.m_nextEntry;
+        for (auto index = batch.m_nextEntry; index < batch.m_entries.size(); ++index) {
+            auto &entry = batch.m_entries[index];
+
+            // the repetitions have already been pushed when the batch was taken
+            entry.delayRepetition = std::chrono::milliseconds::min();
+            if (bInterrupted && m_immediateTimeStamp.has_value() && entry.attributes.priority == TaskPriority::critical) {
+                // behind the immediate tasks, before the other ones of the critical lane
+                entry.timestamp = *m_immediateTimeStamp;
+                storeEntry(std::move(entry));
+            } else {
+                restoreEntry(std::move(entry));
+            }
+        }
+
+        m_scheduledTasksCV.notify_one();
+    }
+
+    TaskQueue::Lane &TaskQueue::getLane(const TaskPriority priority) {
+        return m_lanes[static_cast<size_t>(priority)];
+    }
+
+    bool TaskQueue::isReadyLane(Lane &lane, const time_point &now) {
+        while (!lane.deadlineTasks.empty() && lane.deadlineTasks.top().timestamp <= now) {
+            lane.readyTasks.push_back(lane.deadlineTasks.pop());
+            std::push_heap(lane.readyTasks.begin(), lane.readyTasks.end(), &TaskQueue::isLaterDeadline);
+        }
+
+        return !lane.readyTasks.empty() || (!lane.scheduledTasks.empty() && lane.scheduledTasks.top().timestamp <= now);
+    }
+
+    TaskQueue::Entry TaskQueue::popLaneEntry(Lane &lane) {
+        // the ready tasks with a deadline first
+        if (!lane.readyTasks.empty()) {
+            std::pop_heap(lane.readyTasks.begin(), lane.readyTasks.end(), &TaskQueue::isLaterDeadline);
+            auto entry = std::move(lane.readyTasks.back());
+            lane.readyTasks.pop_back();
+            return entry;
+        }
+
+        if (lane.deadlineTasks.empty() ||
+            (!lane.scheduledTasks.empty() && lane.scheduledTasks.top().timestamp <= lane.deadlineTasks.top().timestamp)) {
+            return lane.scheduledTasks.pop();
+        }
+        return lane.deadlineTasks.pop();
+    }
+
+    TaskQueue::time_point TaskQueue::getDeadline(const Entry &entry) {
+        // saturated: a far deadline must not overflow the time point
+        auto const margin = std::chrono::duration_cast<std::chrono::milliseconds>(time_point::max() - entry.timestamp);
+        return entry.attributes.deadline >= margin ? time_point::max() : entry.timestamp + entry.attributes.deadline;
+    }
+
+    bool TaskQueue::isLaterDeadline(const Entry &lhs, const Entry &rhs) {
+        auto const lhsDeadline = getDeadline(lhs);
+        auto const rhsDeadline = getDeadline(rhs);
+        if (lhsDeadline != rhsDeadline)
+            return lhsDeadline > rhsDeadline;
+
+        return lhs.timestamp != rhs.timestamp ? lhs.timestamp > rhs.timestamp : lhs.sequence > rhs.sequence;
+    }
+
+    ITaskPtr TaskQueue::toTaskPtr(std::optional<Entry> &&entry) {
+        if (!entry.has_value())
+            return nullptr;
+
+        if (entry->pTask != nullptr)
+            return entry->pTask;
+
+        // fire-and-forget task pulled through the ITaskPtr interface
+        return makeTask([pTask = std::make_shared<InlineTask>(std::move(entry->task))]() { pTask->execute(); });
+    }
+
+    InlineTask TaskQueue::toInlineTask(std::optional<Entry> &&entry) {
+        if (!entry.has_value())
+            return InlineTask();
+
+        if (entry->pTask != nullptr)
+            return makeInlineTask(std::move(entry->pTask));
+
+        return std::move(entry->task);
     }
 
 } // namespace NS_OSBASE::application
@@ -0,0 +1,270 @@
+// \file  TimingWheel.cpp
+// \brief Implementation of the class TimingWheel
+
+#include "osApplication/TimingWheel.h"
+#include <algorithm>
+#include <iterator>
+
+namespace {
+    std::uint64_t rotateRight(const std::uint64_t value, const std::size_t shift) {
+        return shift == 0 ? value : (value >> shift) | (value << (64 - shift));
+    }
+
+    std::size_t countTrailingZeros(std::uint64_t value) {
+        std::size_t count = 0;
+        while ((value & 1) == 0) {
+            value >>= 1;
+            ++count;
+        }
+        return count;
+    }
+} // namespace
+
+namespace NS_OSBASE::application {
+
+    /*
+     * \class TimingWheel
+     */
+    void TimingWheel::push(Entry entry) {
+        entry.sequence = m_sequence++;
+        repush(std::move(entry));
+    }
+
+    void TimingWheel::repush(Entry entry) {
+        auto const tick = toTick(entry.timestamp);
+        if (empty()) {
+            m_horizon = tick + 1;
+        }
+
+        if (tick < m_horizon) {
+            pushHeap(std::move(entry));
+        } else {
+            pushWheel(std::move(entry));
+        }
+    }
+
+    const TimingWheel::Entry &TimingWheel::top() {
+        normalize();
+        return m_nearTasks.front();
+    }
+
+    TimingWheel::Entry TimingWheel::pop() {
+        normalize();
+        std::pop_heap(m_nearTasks.begin(), m_nearTasks.end(), &TimingWheel::isAfter);
+        auto entry = std::move(m_nearTasks.back());
+        m_nearTasks.pop_back();
+        return entry;
+    }
+
+    bool TimingWheel::empty() const {
+        return size() == 0;
+    }
+
+    std::size_t TimingWheel::size() const {
+        return m_nearTasks.size() + m_wheelSize;
+    }
+
+    TimingWheel::Entry *TimingWheel::findIf(const std::function<bool(const Entry &)> &predicate) {
+        auto const findInVector = [&predicate](std::vector<Entry> &entries) -> Entry * {
+            auto const itEntry = std::find_if(entries.begin(), entries.end(), predicate);
+            return itEntry == entries.end() ? nullptr : &*itEntry;
+        };
+
+        if (auto const pEntry = findInVector(m_nearTasks); pEntry != nullptr) {
+            return pEntry;
+        }
+
+        for (auto &level : m_levels) {
+            for (auto &slot : level.slots) {
+                if (auto const pEntry = findInVector(slot); pEntry != nullptr) {
+                    return pEntry;
+                }
+            }
+        }
+
+        return findInVector(m_overflowTasks);
+    }
+
+    TimingWheel::Entry *TimingWheel::findFirstIf(const std::function<bool(const Entry &)> &predicate) {
+        Entry *pFirstEntry      = nullptr;
+        auto const findInVector = [&predicate, &pFirstEntry](std::vector<Entry> &entries) {
+            for (auto &entry : entries) {
+                if ((pFirstEntry == nullptr || entry.sequence < pFirstEntry->sequence) && predicate(entry)) {
+                    pFirstEntry = &entry;
+                }
+            }
+        };
+
+        findInVector(m_nearTasks);
+        for (auto &level : m_levels) {
+            for (auto &slot : level.slots) {
+                findInVector(slot);
+            }
+        }
+        findInVector(m_overflowTasks);
+
+        return pFirstEntry;
+    }
+
+    TimingWheel::Entry TimingWheel::extract(const Entry *pEntry) {
+        auto const isIn = [pEntry](const std::vector<Entry> &entries) {
+            return !entries.empty() && pEntry >= entries.data() && pEntry < entries.data() + entries.size();
+        };
+        auto const extractLast = [pEntry](std::vector<Entry> &entries) {
+            // the entry is swapped with the last one, then removed
+            auto const itEntry = entries.begin() + (pEntry - entries.data());
+            if (itEntry != std::prev(entries.end())) {
+                std::iter_swap(itEntry, std::prev(entries.end()));
+            }
+            auto entry = std::move(entries.back());
+            entries.pop_back();
+            return entry;
+        };
+
+        if (isIn(m_nearTasks)) {
+            auto entry = extractLast(m_nearTasks);
+            std::make_heap(m_nearTasks.begin(), m_nearTasks.end(), &TimingWheel::isAfter);
+            return entry;
+        }
+
+        --m_wheelSize;
+        for (auto &level : m_levels) {
+            for (std::size_t nSlot = 0; nSlot < s_nbSlots; ++nSlot) {
+                auto &slot = level.slots[nSlot];
+                if (isIn(slot)) {
+                    auto entry = extractLast(slot);
+                    if (slot.empty()) {
+                        level.occupancy &= ~(std::uint64_t(1) << nSlot);
+                    }
+                    return entry;
+                }
+            }
+        }
+
+        auto entry = extractLast(m_overflowTasks);
+        std::make_heap(m_overflowTasks.begin(), m_overflowTasks.end(), &TimingWheel::isAfter);
+        return entry;
+    }
+
+    void TimingWheel::clear() {
+        m_nearTasks.clear();
+        m_overflowTasks.clear();
+        for (auto &level : m_levels) {
+            for (auto &slot : level.slots) {
+                slot.clear();
+            }
+            level.occupancy = 0;
+        }
+        m_wheelSize = 0;
+    }
+
+    TimingWheel::tick_type TimingWheel::toTick(const time_point &timestamp) {
+        return std::chrono::floor<std::chrono::milliseconds>(timestamp.time_since_epoch()).count();
+    }
+
+    bool TimingWheel::isAfter(const Entry &lhs, const Entry &rhs) {
+        return lhs.timestamp != rhs.timestamp ? lhs.timestamp > rhs.timestamp : lhs.sequence > rhs.sequence;
+    }
+
+    void TimingWheel::pushHeap(Entry &&entry) {
+        m_nearTasks.push_back(std::move(entry));
+        std::push_heap(m_nearTasks.begin(), m_nearTasks.end(), &TimingWheel::isAfter);
+    }
+
+    void TimingWheel::pushWheel(Entry &&entry) {
+        auto const tick = toTick(entry.timestamp);
+        ++m_wheelSize;
+
+        for (std::size_t index = 0; index < s_nbLevels; ++index) {
+            auto const shift = index * s_slotBits;
+            if ((tick >> shift) - (m_horizon >> shift) < static_cast<tick_type>(s_nbSlots)) {
+                auto &level      = m_levels[index];
+                auto const nSlot = static_cast<std::size_t>(tick >> shift) & (s_nbSlots - 1);
+                level.slots[nSlot].push_back(std::move(entry));
+                level.occupancy |= std::uint64_t(1) << nSlot;
+                return;
+            }
+        }
+
+        m_overflowTasks.push_back(std::move(entry));
+        std::push_heap(m_overflowTasks.begin(), m_overflowTasks.end(), &TimingWheel::isAfter);
+    }
+
+    void TimingWheel::normalize() {
+        // Move the earliest slot of the wheel towards the heap until the heap contains the next task.
+        // On tie the highest level is cascaded first: its slot may contain tasks earlier than the lower level slot.
+        while (m_nearTasks.empty() && m_wheelSize != 0) {
+            auto bestLevel = s_nbLevels;
+            tick_type bestTick{};
+            tick_type bestBlock{};
+
+            if (!m_overflowTasks.empty()) {
+                bestTick = toTick(m_overflowTasks.front().timestamp);
+            }
+
+            for (auto index = s_nbLevels; index-- > 0;) {
+                auto const &level = m_levels[index];
+                if (level.occupancy == 0) {
+                    continue;
+                }
+
+                auto const shift        = index * s_slotBits;
+                auto const currentBlock = m_horizon >> shift;
+                auto const nFirstSlot   = static_cast<std::size_t>(currentBlock) & (s_nbSlots - 1);
+                auto const offset       = countTrailingZeros(rotateRight(level.occupancy, nFirstSlot));
+                auto const block        = currentBlock + static_cast<tick_type>(offset);
+                auto const tick         = std::max(block << shift, m_horizon);
+
+                if ((bestLevel == s_nbLevels && m_overflowTasks.empty()) || tick < bestTick) {
+                    bestLevel = index;
+                    bestTick  = tick;
+                    bestBlock = block;
+                }
+            }
+
+            if (bestLevel == s_nbLevels) {
+                // overflow: bring back in the wheel the tasks reachable from the new horizon
+                m_horizon              = bestTick;
+                auto const shift       = (s_nbLevels - 1) * s_slotBits;
+                auto const isReachable = [this, shift](const Entry &entry) {
+                    return (toTick(entry.timestamp) >> shift) - (m_horizon >> shift) < static_cast<tick_type>(s_nbSlots);
+                };
+
+                while (!m_overflowTasks.empty() && isReachable(m_overflowTasks.front())) {
+                    std::pop_heap(m_overflowTasks.begin(), m_overflowTasks.end(), &TimingWheel::isAfter);
+                    auto entry = std::move(m_overflowTasks.back());
+                    m_overflowTasks.pop_back();
+                    --m_wheelSize;
+                    pushWheel(std::move(entry));
+                }
+                continue;
+            }
+
+            auto &level      = m_levels[bestLevel];
+            auto const nSlot = static_cast<std::size_t>(bestBlock) & (s_nbSlots - 1);
+            Slot entries;
+            entries.swap(m_spareSlot);
+            entries.swap(level.slots[nSlot]);
+            level.occupancy &= ~(std::uint64_t(1) << nSlot);
+            m_wheelSize -= entries.size();
+
+            if (bestLevel == 0) {
+                // the slot covers a single tick: all its tasks become near-term
+                m_horizon = bestBlock + 1;
+                for (auto &entry : entries) {
+                    pushHeap(std::move(entry));
+                }
+            } else {
+                // cascade the slot on the lower levels
+                m_horizon = bestTick;
+                for (auto &entry : entries) {
+                    pushWheel(std::move(entry));
+                }
+            }
+
+            entries.clear();
+            entries.swap(m_spareSlot);
+        }
+    }
+
+} // namespace NS_OSBASE::application
@@ -6,4 +6,5 @@
 namespace NS_OSBASE::core {
     constexpr char FACTORY_NAME_XML_STREAM[] = "osbase.core.impl.RapidXml";
     constexpr char FACTORY_NAME_JSON_STREAM[] = "osbase.core.impl.RapidJson";
+    constexpr char FACTORY_NAME_MSGPACK_STREAM[] = "osbase.core.impl.MsgPack";
 } // namespace NS_OSBASE::core
@@ -0,0 +1,62 @@
+// \file  JsonReader.h
+// \brief Declaration of the class JsonReader
+
+#pragma once
+#include <string>
+#include <string_view>
+
+namespace NS_OSBASE::core {
+
+    /**
+     * \brief 	This class represents:
+     *				- a pull reader of a json text, reading the values in place (no DOM, no virtual call)
+     * \remark  Any read not matching the text puts the reader in an invalid state, all the following reads fail.\n
+     *          Iteration on an array:
+     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     reader.beginArray();
+     while (reader.nextItem()) {
+        reader.readInt(value);
+     }
+     return reader.isValid();
+     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     * \ingroup PACKAGE_KEYSTREAM
+     */
+    class JsonReader {
+    public:
+        explicit JsonReader(const std::string_view &json);
+
+        bool isValid() const; //!< no read error
+        bool isEnd();         //!< the text is entirely read (trailing whitespaces)
+        bool isNull();        //!< the next value is null (not read)
+
+        bool readNull();
+        bool readBool(bool &bValue);
+        bool readInt(int &value); //!< integer number in the range of int
+        bool readDouble(double &value);
+        bool readString(std::string &str);
+        bool skipValue();
+
+        bool beginArray();
+        bool nextItem(); //!< false at the end of the array or on error
+        bool beginObject();
+        bool nextKey(std::string_view &key); //!< false at the end of the object or on error - key valid until the next read
+
+    private:
+        static constexpr size_t s_maxDepth = 512; // nested arrays / objects skipped
+
+        bool next(const char separator, const char end);
+        bool skipValue(const size_t depth);
+        bool skipNumber();
+        bool readHex4(unsigned int &value);
+        bool consume(const std::string_view &literal);
+        bool fail();
+        char peek();
+
+        const char *m_pCurrent;
+        const char *m_pEnd;
+        bool m_bValid = true;
+        bool m_bFirst = false;
+        std::string m_key;
+    };
+
+} // namespace NS_OSBASE::core
@@ -0,0 +1,116 @@
+// \file  JsonSerializer.h
+// \brief Declaration of the class JsonSerializer
+
+#pragma once
+#include "JsonReader.h"
+#include "JsonWriter.h"
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace NS_OSBASE::core {
+
+    /**
+     * \brief   This class represents the direct json serialization / deserialization strategies
+     *
+     * The values are written / read straight from a json text, without DOM nor virtual call. The json text is the one of the json
+     * key-stream (same keys, integers exchanged as int), so both sides can use either the key-stream or the direct serialization.\n
+     * A specialization defines isDefined = true and the methods write() and read(). The structures are specialized with the macro
+     * OS_JSON_SERIALIZE_STRUCT.
+     * \remark  A failed read (unexpected json) lets the caller fall back to the key-stream deserialization, which applies the default
+     * values.
+     * \ingroup PACKAGE_KEYSTREAM
+     */
+    template <typename TValue, typename = void>
+    struct JsonSerializer {
+        static constexpr bool isDefined = false;
+
+        // declared only, for the structures having a field without direct serializer (never called, see isDefined)
+        static void write(JsonWriter &writer, const TValue &value);
+        static bool read(JsonReader &reader, TValue &value);
+    };
+
+    template <typename TValue>
+    inline constexpr bool is_json_serializable_v = JsonSerializer<TValue>::isDefined; //!< indicate if TValue has a direct json serializer
+
+    /**
+     * \brief   Serialize a value in json text
+     * \remark  TValue must have a direct json serializer
+     */
+    template <typename TValue>
+    std::string toJson(const TValue &value);
+
+    /**
+     * \brief   Deserialize a value from a json text
+     * \param   json    json text
+     * \param   value   value read - must be initialized with the default values (kept for the missing members)
+     * \return  false if the text doesn't match the value: value is then partially read
+     * \remark  TValue must have a direct json serializer
+     */
+    template <typename TValue>
+    bool fromJson(const std::string_view &json, TValue &value);
+
+    /** \cond */
+    template <>
+    struct JsonSerializer<bool> {
+        static constexpr bool isDefined = true;
+        static void write(JsonWriter &writer, const bool bValue);
+        static bool read(JsonReader &reader, bool &bValue);
+    };
+
+    template <typename TValue>
+    struct JsonSerializer<TValue, std::enable_if_t<std::is_integral_v<TValue> || std::is_enum_v<TValue>>> { // except bool (above)
+        static constexpr bool isDefined = true;
+        static void write(JsonWriter &writer, const TValue value);
+        static bool read(JsonReader &reader, TValue &value);
+    };
+
+    template <typename TValue>
+    struct JsonSerializer<TValue, std::enable_if_t<std::is_floating_point_v<TValue>>> {
+        static constexpr bool isDefined = true;
+        static void write(JsonWriter &writer, const TValue value);
+        static bool read(JsonReader &reader, TValue &value);
+    };
+
+    template <>
+    struct JsonSerializer<std::string> {
+        static constexpr bool isDefined = true;
+        static void write(JsonWriter &writer, const std::string &value);
+        static bool read(JsonReader &reader, std::string &value);
+    };
+
+    template <>
+    struct JsonSerializer<std::wstring> {
+        static constexpr bool isDefined = true;
+        static void write(JsonWriter &writer, const std::wstring &value);
+        static bool read(JsonReader &reader, std::wstring &value);
+    };
+
+    template <typename TValue>
+    struct JsonSerializer<std::vector<TValue>> {
+        static constexpr bool isDefined = is_json_serializable_v<TValue>;
+        static void write(JsonWriter &writer, const std::vector<TValue> &values);
+        static bool read(JsonReader &reader, std::vector<TValue> &values);
+    };
+
+    template <typename TValue>
+    struct JsonSerializer<std::optional<TValue>> {
+        static constexpr bool isDefined = is_json_serializable_v<TValue>;
+        static void write(JsonWriter &writer, const std::optional<TValue> &value);
+        static bool read(JsonReader &reader, std::optional<TValue> &value);
+    };
+
+    template <typename... TArgs>
+    struct JsonSerializer<std::tuple<TArgs...>> {
+        static constexpr bool isDefined = (is_json_serializable_v<TArgs> && ...);
+        static void write(JsonWriter &writer, const std::tuple<TArgs...> &value);
+        static bool read(JsonReader &reader, std::tuple<TArgs...> &value);
+    };
+    /** \endcond */
+
+} // namespace NS_OSBASE::core
+
+#include "JsonSerializer.inl"
+#include "JsonSerializerMacros.h"
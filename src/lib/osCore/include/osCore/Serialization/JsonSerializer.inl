@@ -0,0 +1,217 @@
+// \file  JsonSerializer.inl
+// \brief Implementation of the class JsonSerializer
+
+#pragma once
+#include "Converters.h"
+
+namespace NS_OSBASE::core {
+
+    template <typename TValue>
+    std::string toJson(const TValue &value) {
+        static_assert(is_json_serializable_v<TValue>, "JsonSerializer undefined!");
+
+        std::string json;
+        JsonWriter writer(json);
+        JsonSerializer<TValue>::write(writer, value);
+        return json;
+    }
+
+    template <typename TValue>
+    bool fromJson(const std::string_view &json, TValue &value) {
+        static_assert(is_json_serializable_v<TValue>, "JsonSerializer undefined!");
+
+        JsonReader reader(json);
+        return JsonSerializer<TValue>::read(reader, value) && reader.isEnd();
+    }
+
+#pragma region JsonSerializer < bool>
+    /*
+     * JsonSerializer<bool>
+     */
+    inline void JsonSerializer<bool>::write(JsonWriter &writer, const bool bValue) {
+        writer.writeBool(bValue);
+    }
+
+    inline bool JsonSerializer<bool>::read(JsonReader &reader, bool &bValue) {
+        return reader.readBool(bValue);
+    }
+#pragma endregion
+
+#pragma region JsonSerializer < TInteger>
+    /*
+     * JsonSerializer<TInteger> & JsonSerializer<TEnum>: exchanged as int, as the key-streams
+     */
+    template <typename TValue>
+    void JsonSerializer<TValue, std::enable_if_t<std::is_integral_v<TValue> || std::is_enum_v<TValue>>>::write(
+        JsonWriter &writer, const TValue value) {
+        writer.writeInt(static_cast<int>(value));
+    }
+
+    template <typename TValue>
+    bool JsonSerializer<TValue, std::enable_if_t<std::is_integral_v<TValue> || std::is_enum_v<TValue>>>::read(
+        JsonReader &reader, TValue &value) {
+        int intValue = 0;
+        if (!reader.readInt(intValue)) {
+            return false;
+        }
+
+        value = static_cast<TValue>(intValue);
+        return true;
+    }
+#pragma endregion
+
+#pragma region JsonSerializer < TFloating>
+    /*
+     * JsonSerializer<TFloating>
+     */
+    template <typename TValue>
+    void JsonSerializer<TValue, std::enable_if_t<std::is_floating_point_v<TValue>>>::write(JsonWriter &writer, const TValue value) {
+        writer.writeDouble(static_cast<double>(value));
+    }
+
+    template <typename TValue>
+    bool JsonSerializer<TValue, std::enable_if_t<std::is_floating_point_v<TValue>>>::read(JsonReader &reader, TValue &value) {
+        double doubleValue = 0;
+        if (!reader.readDouble(doubleValue)) {
+            return false;
+        }
+
+        value = static_cast<TValue>(doubleValue);
+        return true;
+    }
+#pragma endregion
+
+#pragma region JsonSerializer < std::string>
+    /*
+     * JsonSerializer<std::string> & JsonSerializer<std::wstring>
+     */
+    inline void JsonSerializer<std::string>::write(JsonWriter &writer, const std::string &value) {
+        writer.writeString(value);
+    }
+
+    inline bool JsonSerializer<std::string>::read(JsonReader &reader, std::string &value) {
+        return reader.readString(value);
+    }
+
+    inline void JsonSerializer<std::wstring>::write(JsonWriter &writer, const std::wstring &value) {
+        writer.writeString(type_cast<std::string>(value));
+    }
+
+    inline bool JsonSerializer<std::wstring>::read(JsonReader &reader, std::wstring &value) {
+        std::string str;
+        if (!reader.readString(str)) {
+            return false;
+        }
+
+        value = type_cast<std::wstring>(str);
+        return true;
+    }
+#pragma endregion
+
+#pragma region JsonSerializer < std::vector < TValue>>
+    /*
+     * JsonSerializer<std::vector<TValue>>
+     */
+    template <typename TValue>
+    void JsonSerializer<std::vector<TValue>>::write(JsonWriter &writer, const std::vector<TValue> &values) {
+        writer.beginArray();
+        for (const TValue &value : values) {
+            JsonSerializer<TValue>::write(writer, value);
+        }
+        writer.endArray();
+    }
+
+    template <typename TValue>
+    bool JsonSerializer<std::vector<TValue>>::read(JsonReader &reader, std::vector<TValue> &values) {
+        if (!reader.beginArray()) {
+            return false;
+        }
+
+        std::vector<TValue> readValues;
+        while (reader.nextItem()) {
+            TValue value{};
+            if (!JsonSerializer<TValue>::read(reader, value)) {
+                return false;
+            }
+            readValues.push_back(std::move(value));
+        }
+
+        // an empty array keeps the default values, as the key-streams
+        if (reader.isValid() && !readValues.empty()) {
+            values = std::move(readValues);
+        }
+
+        return reader.isValid();
+    }
+#pragma endregion
+
+#pragma region JsonSerializer < std::optional < TValue>>
+    /*
+     * JsonSerializer<std::optional<TValue>>
+     */
+    template <typename TValue>
+    void JsonSerializer<std::optional<TValue>>::write(JsonWriter &writer, const std::optional<TValue> &value) {
+        if (value.has_value()) {
+            JsonSerializer<TValue>::write(writer, value.value());
+        } else {
+            writer.writeNull();
+        }
+    }
+
+    template <typename TValue>
+    bool JsonSerializer<std::optional<TValue>>::read(JsonReader &reader, std::optional<TValue> &value) {
+        if (reader.isNull()) {
+            value.reset();
+            return reader.readNull();
+        }
+
+        if (!value.has_value()) {
+            value.emplace();
+        }
+
+        return JsonSerializer<TValue>::read(reader, value.value());
+    }
+#pragma endregion
+
+#pragma region JsonSerializer < std::tuple < TArgs...>>
+    /*
+     * JsonSerializer<std::tuple<TArgs...>>
+     */
+    template <typename... TArgs>
+    void JsonSerializer<std::tuple<TArgs...>>::write(JsonWriter &writer, const std::tuple<TArgs...> &value) {
+        writer.beginArray();
+        std::apply([&writer](const TArgs &...args) { (JsonSerializer<TArgs>::write(writer, args), ...); }, value);
+        writer.endArray();
+    }
+
+    template <typename... TArgs>
+    bool JsonSerializer<std::tuple<TArgs...>>::read(JsonReader &reader, std::tuple<TArgs...> &value) {
+        if (!reader.beginArray()) {
+            return false;
+        }
+
+        // the missing rows keep their default values, the extra rows are ignored, as the key-streams
+        bool bEnd       = false;
+        auto const read = [&reader, &bEnd](auto &arg) {
+            if (bEnd || !reader.nextItem()) {
+                bEnd = true;
+                return reader.isValid();
+            }
+            return JsonSerializer<std::decay_t<decltype(arg)>>::read(reader, arg);
+        };
+
+        if (!std::apply([&read](TArgs &...args) { return (read(args) && ...); }, value)) {
+            return false;
+        }
+
+        while (!bEnd && reader.nextItem()) {
+            if (!reader.skipValue()) {
+                return false;
+            }
+        }
+
+        return reader.isValid();
+    }
+#pragma endregion
+
+} // namespace NS_OSBASE::core
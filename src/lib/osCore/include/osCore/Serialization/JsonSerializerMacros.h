@@ -0,0 +1,121 @@
+// \brief Macros helpers for JsonSerializer
+
+#pragma once
+#include "JsonSerializer.h"
+#include "KeySerializer.h"
+#include "osCore/Misc/MacroHelpers.h"
+#include <string_view>
+
+#ifndef NSCORE
+#define OS_NSCORE ::NS_OSBASE::core
+#endif
+
+/**
+ * \brief This macro helper implements the direct json serialization of a structure
+ *
+ * This macro helps to implement the direct json serialization of structures, complementary to OS_KEY_SERIALIZE_STRUCT (same json).\n
+ * The members are read through a table of the fields, in the declaration order first. The unknown members are skipped, the missing
+ * ones keep their default value.\n
+ * The structure is serializable only if all its fields are (e.g. a field without direct serializer lets the structure be
+ * serialized by the key-streams).\n
+ * Constraints:
+ *  - all fields must be public
+ *  - must be placed at the global namespace
+ *  .
+ *  \n
+ *  Example:
+ ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ namespace mynamespace {
+ struct MyStruct {
+    int field1;
+    std::string field2;
+ }
+ OS_KEY_SERIALIZE_STRUCT(mynamespace::MyStruct, field1, field2)
+ OS_JSON_SERIALIZE_STRUCT(mynamespace::MyStruct, field1, field2)
+ ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ *
+ * \ingroup PACKAGE_KEYSTREAM
+ */
+#define OS_JSON_SERIALIZE_STRUCT(...) OS_JSON_SERIALIZE_STRUCT_MACRO(__VA_ARGS__)(__VA_ARGS__)
+
+// This macro returns OS_JSON_SERIALIZE_STRUCT_FIELD or OS_JSON_SERIALIZE_STRUCT_FIELDS, depending if the list of arguments contains 1
+// or more items (see OS_KEY_SERIALIZE_STRUCT_MACRO)
+#define OS_JSON_SERIALIZE_STRUCT_MACRO(...)                                                                                                \
+    OS_EXPAND(OS_STATIC_JOIN(OS_JSON_SERIALIZE_STRUCT, OS_KEY_SERIALIZE_FIELD_OR_FIELDS(__VA_ARGS__)))
+
+// Serialization without fields: null, as the key-streams
+#define OS_JSON_SERIALIZE_STRUCT_FIELD(_struct_name)                                                                                       \
+    template <>                                                                                                                            \
+    struct OS_NSCORE::JsonSerializer<_struct_name> {                                                                                       \
+        static constexpr bool isDefined = true;                                                                                            \
+        static inline void write(JsonWriter &writer, const _struct_name &) {                                                               \
+            writer.writeNull();                                                                                                            \
+        }                                                                                                                                  \
+        static inline bool read(JsonReader &reader, _struct_name &) {                                                                      \
+            return reader.skipValue();                                                                                                     \
+        }                                                                                                                                  \
+    };
+
+// Serialization with field(s)
+#define OS_JSON_SERIALIZE_STRUCT_FIELDS(_struct_name, ...)                                                                                 \
+    template <>                                                                                                                            \
+    struct OS_NSCORE::JsonSerializer<_struct_name> {                                                                                       \
+    private:                                                                                                                               \
+        using type      = _struct_name;                                                                                                    \
+        using read_type = bool (*)(JsonReader &, type &);                                                                                  \
+        struct Field {                                                                                                                     \
+            std::string_view name;                                                                                                         \
+            read_type read;                                                                                                                \
+        };                                                                                                                                 \
+                                                                                                                                           \
+        static constexpr Field s_fields[] = { OS_FOREACH(OS_JSON_SERIALIZE_FIELD_ENTRY, __VA_ARGS__) };                                    \
+        static constexpr size_t s_nbFields = sizeof(s_fields) / sizeof(Field);                                                            \
+                                                                                                                                           \
+    public:                                                                                                                                \
+        static constexpr bool isDefined = true OS_FOREACH(OS_JSON_SERIALIZE_FIELD_DEFINED, __VA_ARGS__);                                   \
+                                                                                                                                           \
+        static void write(JsonWriter &writer, const type &value) {                                                                         \
+            writer.beginObject();                                                                                                          \
+            OS_FOREACH(OS_JSON_SERIALIZE_FIELD, __VA_ARGS__)                                                                               \
+            writer.endObject();                                                                                                            \
+        }                                                                                                                                  \
+        static bool read(JsonReader &reader, type &value) {                                                                                \
+            if (!reader.beginObject()) {                                                                                                   \
+                return false;                                                                                                              \
+            }                                                                                                                              \
+                                                                                                                                           \
+            size_t index = 0;                                                                                                              \
+            std::string_view key;                                                                                                          \
+            while (reader.nextKey(key)) {                                                                                                  \
+                index = findField(key, index);                                                                                             \
+                if (!(index < s_nbFields ? s_fields[index].read(reader, value) : reader.skipValue())) {                                    \
+                    return false;                                                                                                          \
+                }                                                                                                                          \
+                ++index;                                                                                                                   \
+            }                                                                                                                              \
+                                                                                                                                           \
+            return reader.isValid();                                                                                                       \
+        }                                                                                                                                  \
+                                                                                                                                           \
+    private:                                                                                                                               \
+        static size_t findField(const std::string_view &key, const size_t expectedIndex) {                                                 \
+            if (expectedIndex < s_nbFields && s_fields[expectedIndex].name == key) {                                                       \
+                return expectedIndex;                                                                                                      \
+            }                                                                                                                              \
+            for (size_t index = 0; index < s_nbFields; ++index) {                                                                          \
+                if (s_fields[index].name == key) {                                                                                         \
+                    return index;                                                                                                          \
+                }                                                                                                                          \
+            }                                                                                                                              \
+            return s_nbFields;                                                                                                             \
+        }                                                                                                                                  \
+    };
+
+#define OS_JSON_SERIALIZE_FIELD_ENTRY(_field)                                                                                              \
+    Field{ OS_TO_STR(_field),                                                                                                              \
+        [](JsonReader &reader, type &value) { return OS_NSCORE::JsonSerializer<decltype(type::_field)>::read(reader, value._field); } },
+#define OS_JSON_SERIALIZE_FIELD_DEFINED(_field) &&OS_NSCORE::is_json_serializable_v<decltype(type::_field)>
+#define OS_JSON_SERIALIZE_FIELD(_field)                                                                                                    \
+    writer.writeKey(OS_TO_STR(_field));                                                                                                    \
+    OS_NSCORE::JsonSerializer<decltype(type::_field)>::write(writer, value._field);
@@ -0,0 +1,39 @@
+// \file  JsonWriter.h
+// \brief Declaration of the class JsonWriter
+
+#pragma once
+#include <string>
+#include <string_view>
+
+namespace NS_OSBASE::core {
+
+    /**
+     * \brief 	This class represents:
+     *				- a writer of compact json text, appending directly to a string (no DOM, no virtual call)
+     * \remark  The separators between the values and the members are written by the writer
+     * \ingroup PACKAGE_KEYSTREAM
+     */
+    class JsonWriter {
+    public:
+        explicit JsonWriter(std::string &buffer);
+
+        void writeNull();
+        void writeBool(const bool bValue);
+        void writeInt(const long long value);
+        void writeDouble(const double value); //!< shortest representation, null if not finite
+        void writeString(const std::string_view &str);
+
+        void beginArray();
+        void endArray();
+        void beginObject();
+        void endObject();
+        void writeKey(const std::string_view &key); //!< key of the next member - must not need to be escaped (identifier)
+
+    private:
+        void separate();
+
+        std::string &m_buffer;
+        bool m_bSeparate = false;
+    };
+
+} // namespace NS_OSBASE::core
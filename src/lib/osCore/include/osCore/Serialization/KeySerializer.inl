@@ -172,11 +172,11 @@ namespace NS_OSBASE::core {
     template <typename TKey, typename TValue>
     std::optional<TValue> KeyValueSerializer<TKey, std::optional<TValue>>::getValue(
         KeyStream<TKey> &keyStream, const TKey &key, const std::optional<TValue> &defaultValue) {
-        if (keyStream.isKeyExist(key)) {
-            return KeyValueSerializer<TKey, TValue>::getValue(keyStream, key, defaultValue ? *defaultValue : TValue{});
+        if (!keyStream.isKeyExist(key) || (keyStream.hasNull() && KeyValueSerializer<TKey, void>::getValue(keyStream, key))) {
+            return {}; // missing or null
         }
 
-        return {};
+        return KeyValueSerializer<TKey, TValue>::getValue(keyStream, key, defaultValue ? *defaultValue : TValue{});
     }
 
     template <typename TKey, typename TValue>
@@ -50,6 +50,13 @@ namespace NS_OSBASE::core {
         TValue getValue(const TValue &defaultValue);
         /** \} */
 
+        /**
+         * \brief  Indicates if a null value (see getValue()) differs from an empty one: read back as an empty optional
+         */
+        virtual bool hasNull() const {
+            return true;
+        }
+
         /** \{
          *  \brief  Serialize a value at the current position - the return indicate the success
          */
@@ -141,6 +148,15 @@ namespace NS_OSBASE::core {
      */
     KeyStreamPtr<std::string> makeKeyStream(const std::string &factoryName, std::istream &&is);
 
+    /**
+     * \brief Create a key stream by its factory name and its content
+     *
+     * \param   factoryName name of the factory
+     * \param   content     content to read (binary for the binary families)
+     * \ingroup PACKAGE_KEYSTREAM
+     */
+    KeyStreamPtr<std::string> makeKeyStream(const std::string &factoryName, const std::string &content);
+
     /**
      * \brief Create an empty key-stream based on an Xml concrete realization
      * \remark  The type of the key is a std::string
@@ -198,6 +214,36 @@ namespace NS_OSBASE::core {
      * \ingroup PACKAGE_OSCOREIMPL
      */
     KeyStreamPtr<std::string> makeJsonStream(std::istream &&is);
+
+    /**
+     * \brief Create an empty key-stream based on a MessagePack concrete realization
+     * \remark  The type of the key is a std::string. The navigation is the one of the Json realization, the buffer is binary (compact, not
+     * null-terminated): use getBuffer() rather than the stream inspection.
+     * \ingroup PACKAGE_OSCOREIMPL
+     */
+    KeyStreamPtr<std::string> makeMsgPackStream();
+
+    /**
+     * \brief Create a key-stream based on a MessagePack concrete realization.
+     *
+     * The key-stream is filled based on the input stream <em>is</em> (binary)
+     *
+     * \param is    input stream containing the data (copy ref)
+     * \remark  The type of the key is a std::string
+     * \ingroup PACKAGE_OSCOREIMPL
+     */
+    KeyStreamPtr<std::string> makeMsgPackStream(std::istream &is);
+
+    /**
+     * \brief Create a key-stream based on a MessagePack concrete realization.
+     *
+     * The key-stream is filled based on the input stream <em>is</em> (binary)
+     *
+     * \param is    input stream containing the data (move)
+     * \remark  The type of the key is a std::string
+     * \ingroup PACKAGE_OSCOREIMPL
+     */
+    KeyStreamPtr<std::string> makeMsgPackStream(std::istream &&is);
     /** \}*/
 
     /**
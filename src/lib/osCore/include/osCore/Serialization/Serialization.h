@@ -201,6 +201,7 @@
 
 #include "Converters.h"
 #include "CoreKeySerializer.h"
+#include "JsonSerializer.h"
 #include "KeySerializer.h"
 #include "KeyStream.h"
 #include "KeyValue.h"
@@ -0,0 +1,381 @@
+// \file  JsonReader.cpp
+// \brief Implementation of the class JsonReader
+
+#include "osCore/Serialization/JsonReader.h"
+#include <charconv>
+#include <limits>
+
+namespace NS_OSBASE::core {
+
+    namespace {
+        bool isWhitespace(const char c) {
+            return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+        }
+
+        bool isDigit(const char c) {
+            return c >= '0' && c <= '9';
+        }
+
+        void appendUtf8(std::string &str, const unsigned int codePoint) {
+            if (codePoint < 0x80) {
+                str.push_back(static_cast<char>(codePoint));
+            } else if (codePoint < 0x800) {
+                str.push_back(static_cast<char>(0xc0 | (codePoint >> 6)));
+                str.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+            } else if (codePoint < 0x10000) {
+                str.push_back(static_cast<char>(0xe0 | (codePoint >> 12)));
+                str.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+                str.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+            } else {
+                str.push_back(static_cast<char>(0xf0 | (codePoint >> 18)));
+                str.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f)));
+                str.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+                str.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+            }
+        }
+    } // namespace
+
+    /*
+     * \class JsonReader
+     */
+    JsonReader::JsonReader(const std::string_view &json) : m_pCurrent(json.data()), m_pEnd(json.data() + json.size()) {
+    }
+
+    bool JsonReader::isValid() const {
+        return m_bValid;
+    }
+
+    bool JsonReader::isEnd() {
+        peek();
+        return m_bValid && m_pCurrent == m_pEnd;
+    }
+
+    bool JsonReader::isNull() {
+        return peek() == 'n';
+    }
+
+    bool JsonReader::readNull() {
+        return consume("null");
+    }
+
+    bool JsonReader::readBool(bool &bValue) {
+        switch (peek()) {
+        case 't':
+            bValue = true;
+            return consume("true");
+        case 'f':
+            bValue = false;
+            return consume("false");
+        default:
+            return fail();
+        }
+    }
+
+    bool JsonReader::readInt(int &value) {
+        peek();
+        auto const pBegin = m_pCurrent;
+        if (!skipNumber()) {
+            return false;
+        }
+
+        // integer only, as the key-streams
+        long long number  = 0;
+        auto const result = std::from_chars(pBegin, m_pCurrent, number);
+        if (result.ec != std::errc{} || result.ptr != m_pCurrent || number < std::numeric_limits<int>::min() ||
+            number > std::numeric_limits<int>::max()) {
+            return fail();
+        }
+
+        value = static_cast<int>(number);
+        return true;
+    }
+
+    bool JsonReader::readDouble(double &value) {
+        peek();
+        auto const pBegin = m_pCurrent;
+        if (!skipNumber()) {
+            return false;
+        }
+
+        auto const result = std::from_chars(pBegin, m_pCurrent, value);
+        return result.ec == std::errc{} && result.ptr == m_pCurrent ? true : fail();
+    }
+
+    bool JsonReader::readString(std::string &str) {
+        if (peek() != '"') {
+            return fail();
+        }
+
+        str.clear();
+        ++m_pCurrent;
+        auto pBegin = m_pCurrent; // beginning of the chars to copy as is
+        while (m_pCurrent != m_pEnd) {
+            auto const c = static_cast<unsigned char>(*m_pCurrent);
+            if (c == '"') {
+                str.append(pBegin, m_pCurrent);
+                ++m_pCurrent;
+                return true;
+            }
+
+            if (c < 0x20) {
+                return fail();
+            }
+
+            if (c != '\\') {
+                ++m_pCurrent;
+                continue;
+            }
+
+            str.append(pBegin, m_pCurrent);
+            if (++m_pCurrent == m_pEnd) {
+                return fail();
+            }
+
+            switch (*m_pCurrent++) {
+            case '"':
+                str.push_back('"');
+                break;
+            case '\\':
+                str.push_back('\\');
+                break;
+            case '/':
+                str.push_back('/');
+                break;
+            case 'b':
+                str.push_back('\b');
+                break;
+            case 'f':
+                str.push_back('\f');
+                break;
+            case 'n':
+                str.push_back('\n');
+                break;
+            case 'r':
+                str.push_back('\r');
+                break;
+            case 't':
+                str.push_back('\t');
+                break;
+            case 'u': {
+                unsigned int codePoint = 0;
+                if (!readHex4(codePoint)) {
+                    return false;
+                }
+
+                if (codePoint >= 0xd800 && codePoint <= 0xdbff) {
+                    // surrogate pair
+                    unsigned int lowSurrogate = 0;
+                    if (!consume("\\u") || !readHex4(lowSurrogate) || lowSurrogate < 0xdc00 || lowSurrogate > 0xdfff) {
+                        return fail();
+                    }
+                    codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (lowSurrogate - 0xdc00);
+                } else if (codePoint >= 0xdc00 && codePoint <= 0xdfff) {
+                    return fail();
+                }
+
+                appendUtf8(str, codePoint);
+                break;
+            }
+            default:
+                return fail();
+            }
+
+            pBegin = m_pCurrent;
+        }
+
+        return fail();
+    }
+
+    bool JsonReader::skipValue() {
+        return skipValue(0);
+    }
+
+    bool JsonReader::beginArray() {
+        if (peek() != '[') {
+            return fail();
+        }
+
+        ++m_pCurrent;
+        m_bFirst = true;
+        return true;
+    }
+
+    bool JsonReader::nextItem() {
+        return next(',', ']');
+    }
+
+    bool JsonReader::beginObject() {
+        if (peek() != '{') {
+            return fail();
+        }
+
+        ++m_pCurrent;
+        m_bFirst = true;
+        return true;
+    }
+
+    bool JsonReader::nextKey(std::string_view &key) {
+        if (!next(',', '}') || !readString(m_key)) {
+            return false;
+        }
+
+        if (peek() != ':') {
+            return fail();
+        }
+
+        ++m_pCurrent;
+        key = m_key;
+        return true;
+    }
+
+    bool JsonReader::next(const char separator, const char end) {
+        auto const c = peek();
+        if (!m_bValid) {
+            return false;
+        }
+
+        if (c == end) {
+            ++m_pCurrent;
+            m_bFirst = false; // the container is an item of its parent
+            return false;
+        }
+
+        if (m_bFirst) {
+            m_bFirst = false;
+            return true;
+        }
+
+        if (c != separator) {
+            return fail();
+        }
+
+        ++m_pCurrent;
+        return true;
+    }
+
+    bool JsonReader::skipValue(const size_t depth) {
+        if (depth > s_maxDepth) {
+            return fail();
+        }
+
+        switch (peek()) {
+        case '[':
+            beginArray();
+            while (nextItem()) {
+                if (!skipValue(depth + 1)) {
+                    return false;
+                }
+            }
+            return m_bValid;
+        case '{': {
+            beginObject();
+            std::string_view key;
+            while (nextKey(key)) {
+                if (!skipValue(depth + 1)) {
+                    return false;
+                }
+            }
+            return m_bValid;
+        }
+        case '"': {
+            std::string str;
+            return readString(str);
+        }
+        case 't':
+            return consume("true");
+        case 'f':
+            return consume("false");
+        case 'n':
+            return consume("null");
+        default:
+            return skipNumber();
+        }
+    }
+
+    bool JsonReader::skipNumber() {
+        // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+        auto const skipDigits = [this]() {
+            auto const pBegin = m_pCurrent;
+            while (m_pCurrent != m_pEnd && isDigit(*m_pCurrent)) {
+                ++m_pCurrent;
+            }
+            return m_pCurrent != pBegin;
+        };
+
+        if (m_pCurrent != m_pEnd && *m_pCurrent == '-') {
+            ++m_pCurrent;
+        }
+
+        auto const pIntegerPart = m_pCurrent;
+        if (!skipDigits() || (*pIntegerPart == '0' && m_pCurrent - pIntegerPart > 1)) {
+            return fail();
+        }
+
+        if (m_pCurrent != m_pEnd && *m_pCurrent == '.') {
+            ++m_pCurrent;
+            if (!skipDigits()) {
+                return fail();
+            }
+        }
+
+        if (m_pCurrent != m_pEnd && (*m_pCurrent == 'e' || *m_pCurrent == 'E')) {
+            ++m_pCurrent;
+            if (m_pCurrent != m_pEnd && (*m_pCurrent == '+' || *m_pCurrent == '-')) {
+                ++m_pCurrent;
+            }
+            if (!skipDigits()) {
+                return fail();
+            }
+        }
+
+        return m_bValid;
+    }
+
+    bool JsonReader::readHex4(unsigned int &value) {
+        if (m_pEnd - m_pCurrent < 4) {
+            return fail();
+        }
+
+        value = 0;
+        for (auto const pEnd = m_pCurrent + 4; m_pCurrent != pEnd; ++m_pCurrent) {
+            auto const c = *m_pCurrent;
+            value <<= 4;
+            if (isDigit(c)) {
+                value |= static_cast<unsigned int>(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                value |= static_cast<unsigned int>(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                value |= static_cast<unsigned int>(c - 'A' + 10);
+            } else {
+                return fail();
+            }
+        }
+
+        return true;
+    }
+
+    bool JsonReader::consume(const std::string_view &literal) {
+        peek();
+        if (!m_bValid || static_cast<size_t>(m_pEnd - m_pCurrent) < literal.size() ||
+            std::string_view(m_pCurrent, literal.size()) != literal) {
+            return fail();
+        }
+
+        m_pCurrent += literal.size();
+        return true;
+    }
+
+    bool JsonReader::fail() {
+        m_bValid = false;
+        return false;
+    }
+
+    char JsonReader::peek() {
+        while (m_pCurrent != m_pEnd && isWhitespace(*m_pCurrent)) {
+            ++m_pCurrent;
+        }
+
+        return m_bValid && m_pCurrent != m_pEnd ? *m_pCurrent : '\0';
+    }
+
+} // namespace NS_OSBASE::core
@@ -0,0 +1,141 @@
+// \file  JsonWriter.cpp
+// \brief Implementation of the class JsonWriter
+
+#include "osCore/Serialization/JsonWriter.h"
+#include <charconv>
+#include <cmath>
+
+namespace NS_OSBASE::core {
+
+    /*
+     * \class JsonWriter
+     */
+    JsonWriter::JsonWriter(std::string &buffer) : m_buffer(buffer) {
+    }
+
+    void JsonWriter::writeNull() {
+        separate();
+        m_buffer.append("null", 4);
+    }
+
+    void JsonWriter::writeBool(const bool bValue) {
+        separate();
+        if (bValue) {
+            m_buffer.append("true", 4);
+        } else {
+            m_buffer.append("false", 5);
+        }
+    }
+
+    void JsonWriter::writeInt(const long long value) {
+        separate();
+        char digits[24];
+        auto const result = std::to_chars(std::begin(digits), std::end(digits), value);
+        m_buffer.append(digits, result.ptr);
+    }
+
+    void JsonWriter::writeDouble(const double value) {
+        if (!std::isfinite(value)) {
+            writeNull(); // no json representation
+            return;
+        }
+
+        separate();
+        char digits[32];
+        auto const result = std::to_chars(std::begin(digits), std::end(digits), value);
+        m_buffer.append(digits, result.ptr);
+
+        // keep a double representation, as the key-streams
+        if (std::string_view(digits, result.ptr - digits).find_first_of(".e") == std::string_view::npos) {
+            m_buffer.append(".0", 2);
+        }
+    }
+
+    void JsonWriter::writeString(const std::string_view &str) {
+        static constexpr char s_hexDigits[] = "0123456789ABCDEF";
+
+        separate();
+        m_buffer.reserve(m_buffer.size() + str.size() + 2);
+        m_buffer.push_back('"');
+
+        auto itBegin = str.cbegin(); // beginning of the chars to copy as is
+        for (auto itChar = str.cbegin(); itChar != str.cend(); ++itChar) {
+            auto const c = static_cast<unsigned char>(*itChar);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+
+            m_buffer.append(itBegin, itChar);
+            itBegin = std::next(itChar);
+
+            m_buffer.push_back('\\');
+            switch (c) {
+            case '"':
+            case '\\':
+                m_buffer.push_back(static_cast<char>(c));
+                break;
+            case '\b':
+                m_buffer.push_back('b');
+                break;
+            case '\f':
+                m_buffer.push_back('f');
+                break;
+            case '\n':
+                m_buffer.push_back('n');
+                break;
+            case '\r':
+                m_buffer.push_back('r');
+                break;
+            case '\t':
+                m_buffer.push_back('t');
+                break;
+            default:
+                m_buffer.append("u00", 3);
+                m_buffer.push_back(s_hexDigits[c >> 4]);
+                m_buffer.push_back(s_hexDigits[c & 0xf]);
+                break;
+            }
+        }
+
+        m_buffer.append(itBegin, str.cend());
+        m_buffer.push_back('"');
+    }
+
+    void JsonWriter::beginArray() {
+        separate();
+        m_buffer.push_back('[');
+        m_bSeparate = false;
+    }
+
+    void JsonWriter::endArray() {
+        m_buffer.push_back(']');
+        m_bSeparate = true;
+    }
+
+    void JsonWriter::beginObject() {
+        separate();
+        m_buffer.push_back('{');
+        m_bSeparate = false;
+    }
+
+    void JsonWriter::endObject() {
+        m_buffer.push_back('}');
+        m_bSeparate = true;
+    }
+
+    void JsonWriter::writeKey(const std::string_view &key) {
+        separate();
+        m_buffer.push_back('"');
+        m_buffer.append(key);
+        m_buffer.append("\":", 2);
+        m_bSeparate = false;
+    }
+
+    void JsonWriter::separate() {
+        if (m_bSeparate) {
+            m_buffer.push_back(',');
+        }
+        m_bSeparate = true;
+    }
+
+} // namespace NS_OSBASE::core
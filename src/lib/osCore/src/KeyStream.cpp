@@ -15,18 +15,21 @@ namespace NS_OSBASE::core {
     }
 
     KeyStreamPtr<std::string> makeKeyStream(const std::string &factoryName, std::istream &is) {
+        is.unsetf(std::ios_base::skipws); // before the first read: the binary contents may start with a whitespace byte
         const std::istream_iterator<char> itIs(is);
         const std::istream_iterator<char> itEnd;
 
-        is.unsetf(std::ios_base::skipws);
-        std::string xmlContent(itIs, itEnd);
-        return TheFactoryManager.createInstance<KeyStream<std::string>>(factoryName, xmlContent);
+        return makeKeyStream(factoryName, std::string(itIs, itEnd));
     }
 
     KeyStreamPtr<std::string> makeKeyStream(const std::string &factoryName, std::istream &&is) {
         return makeKeyStream(factoryName, is);
     }
 
+    KeyStreamPtr<std::string> makeKeyStream(const std::string &factoryName, const std::string &content) {
+        return TheFactoryManager.createInstance<KeyStream<std::string>>(factoryName, content);
+    }
+
     // xml
     KeyStreamPtr<std::string> makeXmlStream() {
         return makeKeyStream(FACTORY_NAME_XML_STREAM);
@@ -52,6 +55,19 @@ namespace NS_OSBASE::core {
     KeyStreamPtr<std::string> makeJsonStream(std::istream &&is) {
         return makeJsonStream(is);
     }
+
+    // msgpack
+    KeyStreamPtr<std::string> makeMsgPackStream() {
+        return makeKeyStream(FACTORY_NAME_MSGPACK_STREAM);
+    }
+
+    KeyStreamPtr<std::string> makeMsgPackStream(std::istream &is) {
+        return makeKeyStream(FACTORY_NAME_MSGPACK_STREAM, is);
+    }
+
+    KeyStreamPtr<std::string> makeMsgPackStream(std::istream &&is) {
+        return makeMsgPackStream(is);
+    }
     /*
      * stream operators
      */
@@ -14,12 +14,13 @@
  */
 
 /**
- * \brief Macro mandatory to link with the current binary the concrete realizations (Xml & Json)
+ * \brief Macro mandatory to link with the current binary the concrete realizations (Xml, Json & MessagePack)
  * \ingroup PACKAGE_OSCOREIMPL
  */
 #define OS_CORE_IMPL_LINK()                                                                                                                \
     OS_CORE_LINK_KEYSTREAM_XML()                                                                                                           \
-    OS_CORE_LINK_KEYSTREAM_JSON()
+    OS_CORE_LINK_KEYSTREAM_JSON()                                                                                                          \
+    OS_CORE_LINK_KEYSTREAM_MSGPACK()
 
 /** \cond */
 #define OS_CORE_LINK_KEYSTREAM_XML()                                                                                                       \
@@ -34,4 +35,10 @@
         OS_LINK_FACTORY_N(StringKeyStream, RapidJsonStream, 1);                                                                            \
     }
 
+#define OS_CORE_LINK_KEYSTREAM_MSGPACK()                                                                                                   \
+    namespace NS_OSBASE::core::impl {                                                                                             \
+        OS_LINK_FACTORY_N(StringKeyStream, MsgPackStream, 0);                                                                              \
+        OS_LINK_FACTORY_N(StringKeyStream, MsgPackStream, 1);                                                                              \
+    }
+
 /** \endcond */
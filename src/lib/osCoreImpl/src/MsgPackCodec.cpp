@@ -0,0 +1,125 @@
+// \file  MsgPackCodec.cpp
+// \brief Implementation of the classes MsgPackWriter and MsgPackReader
+
+#include "MsgPackCodec.h"
+#include <cstring>
+
+namespace NS_OSBASE::core::impl {
+
+    /*
+     * \class MsgPackWriter
+     */
+    MsgPackWriter::MsgPackWriter(std::vector<unsigned char> &buffer) : m_buffer(buffer) {
+    }
+
+    void MsgPackWriter::writeNil() {
+        m_buffer.push_back(0xc0);
+    }
+
+    void MsgPackWriter::writeBool(const bool bValue) {
+        m_buffer.push_back(bValue ? 0xc3 : 0xc2);
+    }
+
+    void MsgPackWriter::writeInt(const std::int64_t value) {
+        if (value >= 0) {
+            writeUint(static_cast<std::uint64_t>(value));
+        } else if (value >= -32) {
+            m_buffer.push_back(static_cast<unsigned char>(value)); // negative fixint
+        } else if (value >= std::numeric_limits<std::int8_t>::min()) {
+            writeBigEndian(0xd0, static_cast<std::int8_t>(value));
+        } else if (value >= std::numeric_limits<std::int16_t>::min()) {
+            writeBigEndian(0xd1, static_cast<std::int16_t>(value));
+        } else if (value >= std::numeric_limits<std::int32_t>::min()) {
+            writeBigEndian(0xd2, static_cast<std::int32_t>(value));
+        } else {
+            writeBigEndian(0xd3, value);
+        }
+    }
+
+    void MsgPackWriter::writeUint(const std::uint64_t value) {
+        if (value <= 0x7f) {
+            m_buffer.push_back(static_cast<unsigned char>(value)); // positive fixint
+        } else if (value <= std::numeric_limits<std::uint8_t>::max()) {
+            writeBigEndian(0xcc, static_cast<std::uint8_t>(value));
+        } else if (value <= std::numeric_limits<std::uint16_t>::max()) {
+            writeBigEndian(0xcd, static_cast<std::uint16_t>(value));
+        } else if (value <= std::numeric_limits<std::uint32_t>::max()) {
+            writeBigEndian(0xce, static_cast<std::uint32_t>(value));
+        } else {
+            writeBigEndian(0xcf, value);
+        }
+    }
+
+    void MsgPackWriter::writeDouble(const double value) {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeBigEndian(0xcb, bits);
+    }
+
+    void MsgPackWriter::writeString(const char *pStr, const size_t length) {
+        if (length <= 0x1f) {
+            m_buffer.push_back(static_cast<unsigned char>(0xa0 | length)); // fixstr
+        } else if (length <= std::numeric_limits<std::uint8_t>::max()) {
+            writeBigEndian(0xd9, static_cast<std::uint8_t>(length));
+        } else if (length <= std::numeric_limits<std::uint16_t>::max()) {
+            writeBigEndian(0xda, static_cast<std::uint16_t>(length));
+        } else {
+            writeBigEndian(0xdb, static_cast<std::uint32_t>(length));
+        }
+
+        m_buffer.insert(m_buffer.end(), pStr, pStr + length);
+    }
+
+    void MsgPackWriter::writeArrayHeader(const size_t size) {
+        if (size <= 0x0f) {
+            m_buffer.push_back(static_cast<unsigned char>(0x90 | size)); // fixarray
+        } else if (size <= std::numeric_limits<std::uint16_t>::max()) {
+            writeBigEndian(0xdc, static_cast<std::uint16_t>(size));
+        } else {
+            writeBigEndian(0xdd, static_cast<std::uint32_t>(size));
+        }
+    }
+
+    void MsgPackWriter::writeMapHeader(const size_t size) {
+        if (size <= 0x0f) {
+            m_buffer.push_back(static_cast<unsigned char>(0x80 | size)); // fixmap
+        } else if (size <= std::numeric_limits<std::uint16_t>::max()) {
+            writeBigEndian(0xde, static_cast<std::uint16_t>(size));
+        } else {
+            writeBigEndian(0xdf, static_cast<std::uint32_t>(size));
+        }
+    }
+
+    /*
+     * \class MsgPackReader
+     */
+    MsgPackReader::MsgPackReader(const unsigned char *pData, const size_t size) : m_pData(pData), m_size(size) {
+    }
+
+    bool MsgPackReader::readFloat(double &value) {
+        std::uint32_t bits = 0;
+        if (!readBigEndian(bits)) {
+            return false;
+        }
+
+        float floatValue = 0;
+        std::memcpy(&floatValue, &bits, sizeof(floatValue));
+        value = static_cast<double>(floatValue);
+        return true;
+    }
+
+    bool MsgPackReader::readDouble(double &value) {
+        std::uint64_t bits = 0;
+        if (!readBigEndian(bits)) {
+            return false;
+        }
+
+        std::memcpy(&value, &bits, sizeof(value));
+        return true;
+    }
+
+    bool MsgPackReader::isAvailable(const size_t size) const {
+        return size <= m_size - m_position;
+    }
+
+} // namespace NS_OSBASE::core::impl
@@ -0,0 +1,94 @@
+// \file  MsgPackCodec.h
+// \brief Declaration of the classes MsgPackWriter and MsgPackReader
+
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace NS_OSBASE::core::impl {
+
+    /**
+     * \brief 	This class represents:
+     *				- a writer of values in the MessagePack format (https://msgpack.org), in their most compact form
+     */
+    class MsgPackWriter {
+    public:
+        explicit MsgPackWriter(std::vector<unsigned char> &buffer);
+
+        void writeNil();
+        void writeBool(const bool bValue);
+        void writeInt(const std::int64_t value);
+        void writeUint(const std::uint64_t value);
+        void writeDouble(const double value);
+        void writeString(const char *pStr, const size_t length);
+        void writeArrayHeader(const size_t size);
+        void writeMapHeader(const size_t size);
+
+        /**
+         * \brief   Write recursively a value of a DOM (rapidjson::Value interface)
+         * \remark  The arrays and the objects are written as MessagePack arrays and maps (string keys)
+         */
+        template <typename TValue>
+        void writeValue(const TValue &value);
+
+    private:
+        template <typename T>
+        void writeBigEndian(const unsigned char format, const T value);
+
+        std::vector<unsigned char> &m_buffer;
+    };
+
+    /**
+     * \brief 	This class represents:
+     *				- a reader of a MessagePack buffer generating the events of a SAX handler (rapidjson Handler interface)
+     * \remark  The reader is a generator of rapidjson::Document::Populate(). The extension and binary formats are not supported.
+     */
+    class MsgPackReader {
+    public:
+        MsgPackReader(const unsigned char *pData, const size_t size);
+
+        /**
+         * \brief   Generate the events of the value of the buffer
+         * \return  false if the buffer is not a single valid MessagePack value
+         */
+        template <typename THandler>
+        bool operator()(THandler &handler);
+
+    private:
+        static constexpr size_t s_maxDepth = 512; // nested arrays / maps
+
+        template <typename THandler>
+        bool readValue(THandler &handler, const size_t depth);
+
+        template <typename THandler>
+        bool readString(THandler &handler, const size_t length, const bool bKey);
+
+        template <typename THandler>
+        bool readArray(THandler &handler, const size_t size, const size_t depth);
+
+        template <typename THandler>
+        bool readMap(THandler &handler, const size_t size, const size_t depth);
+
+        template <typename THandler>
+        bool readInt(THandler &handler, const std::int64_t value);
+
+        template <typename THandler>
+        bool readUint(THandler &handler, const std::uint64_t value);
+
+        template <typename T>
+        bool readBigEndian(T &value);
+
+        bool readFloat(double &value);
+        bool readDouble(double &value);
+        bool isAvailable(const size_t size) const;
+
+        const unsigned char *m_pData;
+        size_t m_size;
+        size_t m_position = 0;
+    };
+
+} // namespace NS_OSBASE::core::impl
+
+#include "MsgPackCodec.inl"
@@ -0,0 +1,254 @@
+// \file  MsgPackCodec.inl
+// \brief Implementation of the classes MsgPackWriter and MsgPackReader
+
+#pragma once
+#include <type_traits>
+
+namespace NS_OSBASE::core::impl {
+
+    /*
+     * \class MsgPackWriter
+     */
+    template <typename TValue>
+    void MsgPackWriter::writeValue(const TValue &value) {
+        if (value.IsNull()) {
+            writeNil();
+        } else if (value.IsBool()) {
+            writeBool(value.GetBool());
+        } else if (value.IsDouble()) {
+            writeDouble(value.GetDouble());
+        } else if (value.IsInt64()) {
+            writeInt(value.GetInt64());
+        } else if (value.IsUint64()) {
+            writeUint(value.GetUint64());
+        } else if (value.IsString()) {
+            writeString(value.GetString(), value.GetStringLength());
+        } else if (value.IsArray()) {
+            writeArrayHeader(value.Size());
+            for (auto const &element : value.GetArray()) {
+                writeValue(element);
+            }
+        } else if (value.IsObject()) {
+            writeMapHeader(value.MemberCount());
+            for (auto const &member : value.GetObject()) {
+                writeString(member.name.GetString(), member.name.GetStringLength());
+                writeValue(member.value);
+            }
+        }
+    }
+
+    template <typename T>
+    void MsgPackWriter::writeBigEndian(const unsigned char format, const T value) {
+        auto const unsignedValue = static_cast<std::make_unsigned_t<T>>(value);
+
+        m_buffer.push_back(format);
+        for (auto shift = static_cast<int>(sizeof(T) - 1) * 8; shift >= 0; shift -= 8) {
+            m_buffer.push_back(static_cast<unsigned char>(unsignedValue >> shift));
+        }
+    }
+
+    /*
+     * \class MsgPackReader
+     */
+    template <typename THandler>
+    bool MsgPackReader::operator()(THandler &handler) {
+        m_position = 0;
+        return readValue(handler, 0) && m_position == m_size;
+    }
+
+    template <typename THandler>
+    bool MsgPackReader::readValue(THandler &handler, const size_t depth) {
+        if (depth > s_maxDepth || !isAvailable(1)) {
+            return false;
+        }
+
+        auto const format = m_pData[m_position++];
+        if (format <= 0x7f) {
+            return readUint(handler, format);
+        }
+        if (format >= 0xe0) {
+            return readInt(handler, static_cast<std::int8_t>(format));
+        }
+        if (format <= 0x8f) {
+            return readMap(handler, format & 0x0f, depth);
+        }
+        if (format <= 0x9f) {
+            return readArray(handler, format & 0x0f, depth);
+        }
+        if (format <= 0xbf) {
+            return readString(handler, format & 0x1f, false);
+        }
+
+        switch (format) {
+        case 0xc0:
+            return handler.Null();
+        case 0xc2:
+            return handler.Bool(false);
+        case 0xc3:
+            return handler.Bool(true);
+        case 0xca: {
+            double value = 0;
+            return readFloat(value) && handler.Double(value);
+        }
+        case 0xcb: {
+            double value = 0;
+            return readDouble(value) && handler.Double(value);
+        }
+        case 0xcc: {
+            std::uint8_t value = 0;
+            return readBigEndian(value) && readUint(handler, value);
+        }
+        case 0xcd: {
+            std::uint16_t value = 0;
+            return readBigEndian(value) && readUint(handler, value);
+        }
+        case 0xce: {
+            std::uint32_t value = 0;
+            return readBigEndian(value) && readUint(handler, value);
+        }
+        case 0xcf: {
+            std::uint64_t value = 0;
+            return readBigEndian(value) && readUint(handler, value);
+        }
+        case 0xd0: {
+            std::int8_t value = 0;
+            return readBigEndian(value) && readInt(handler, value);
+        }
+        case 0xd1: {
+            std::int16_t value = 0;
+            return readBigEndian(value) && readInt(handler, value);
+        }
+        case 0xd2: {
+            std::int32_t value = 0;
+            return readBigEndian(value) && readInt(handler, value);
+        }
+        case 0xd3: {
+            std::int64_t value = 0;
+            return readBigEndian(value) && readInt(handler, value);
+        }
+        case 0xd9: {
+            std::uint8_t length = 0;
+            return readBigEndian(length) && readString(handler, length, false);
+        }
+        case 0xda: {
+            std::uint16_t length = 0;
+            return readBigEndian(length) && readString(handler, length, false);
+        }
+        case 0xdb: {
+            std::uint32_t length = 0;
+            return readBigEndian(length) && readString(handler, length, false);
+        }
+        case 0xdc: {
+            std::uint16_t size = 0;
+            return readBigEndian(size) && readArray(handler, size, depth);
+        }
+        case 0xdd: {
+            std::uint32_t size = 0;
+            return readBigEndian(size) && readArray(handler, size, depth);
+        }
+        case 0xde: {
+            std::uint16_t size = 0;
+            return readBigEndian(size) && readMap(handler, size, depth);
+        }
+        case 0xdf: {
+            std::uint32_t size = 0;
+            return readBigEndian(size) && readMap(handler, size, depth);
+        }
+        default:
+            return false;
+        }
+    }
+
+    template <typename THandler>
+    bool MsgPackReader::readString(THandler &handler, const size_t length, const bool bKey) {
+        if (!isAvailable(length)) {
+            return false;
+        }
+
+        auto const pStr = reinterpret_cast<const char *>(m_pData + m_position);
+        m_position += length;
+
+        auto const rapidLength = static_cast<unsigned>(length);
+        return bKey ? handler.Key(pStr, rapidLength, true) : handler.String(pStr, rapidLength, true);
+    }
+
+    template <typename THandler>
+    bool MsgPackReader::readArray(THandler &handler, const size_t size, const size_t depth) {
+        // each element takes one byte at least: rejects the corrupted sizes before allocating
+        if (!isAvailable(size) || !handler.StartArray()) {
+            return false;
+        }
+
+        for (size_t index = 0; index < size; ++index) {
+            if (!readValue(handler, depth + 1)) {
+                return false;
+            }
+        }
+
+        return handler.EndArray(static_cast<unsigned>(size));
+    }
+
+    template <typename THandler>
+    bool MsgPackReader::readMap(THandler &handler, const size_t size, const size_t depth) {
+        if (!isAvailable(size * 2) || !handler.StartObject()) {
+            return false;
+        }
+
+        for (size_t index = 0; index < size; ++index) {
+            if (!isAvailable(1)) {
+                return false;
+            }
+
+            // keys: strings only
+            auto const format = m_pData[m_position++];
+            auto bKey         = false;
+            if (format >= 0xa0 && format <= 0xbf) {
+                bKey = readString(handler, format & 0x1f, true);
+            } else if (format == 0xd9) {
+                std::uint8_t length = 0;
+                bKey                = readBigEndian(length) && readString(handler, length, true);
+            } else if (format == 0xda) {
+                std::uint16_t length = 0;
+                bKey                 = readBigEndian(length) && readString(handler, length, true);
+            } else if (format == 0xdb) {
+                std::uint32_t length = 0;
+                bKey                 = readBigEndian(length) && readString(handler, length, true);
+            }
+
+            if (!bKey || !readValue(handler, depth + 1)) {
+                return false;
+            }
+        }
+
+        return handler.EndObject(static_cast<unsigned>(size));
+    }
+
+    template <typename THandler>
+    bool MsgPackReader::readInt(THandler &handler, const std::int64_t value) {
+        if (value >= 0) {
+            return readUint(handler, static_cast<std::uint64_t>(value));
+        }
+
+        return value >= std::numeric_limits<int>::min() ? handler.Int(static_cast<int>(value)) : handler.Int64(value);
+    }
+
+    template <typename THandler>
+    bool MsgPackReader::readUint(THandler &handler, const std::uint64_t value) {
+        return value <= std::numeric_limits<unsigned>::max() ? handler.Uint(static_cast<unsigned>(value)) : handler.Uint64(value);
+    }
+
+    template <typename T>
+    bool MsgPackReader::readBigEndian(T &value) {
+        if (!isAvailable(sizeof(T))) {
+            return false;
+        }
+
+        std::make_unsigned_t<T> unsignedValue = 0;
+        for (size_t index = 0; index < sizeof(T); ++index) {
+            unsignedValue = static_cast<std::make_unsigned_t<T>>((unsignedValue << 8) | m_pData[m_position++]);
+        }
+        value = static_cast<T>(unsignedValue);
+        return true;
+    }
+
+} // namespace NS_OSBASE::core::impl
@@ -0,0 +1,31 @@
+// \file  MsgPackStream.cpp
+// \brief Implementation of the class MsgPackStream
+
+#include "MsgPackStream.h"
+#include "MsgPackCodec.h"
+#include "osCore/Serialization/FactoryNames.h"
+#include "osCore/DesignPattern/AbstractFactory.h"
+
+namespace NS_OSBASE::core::impl {
+
+    OS_REGISTER_FACTORY_N(StringKeyStream, MsgPackStream, 0, FACTORY_NAME_MSGPACK_STREAM)
+    OS_REGISTER_FACTORY_N(StringKeyStream, MsgPackStream, 1, FACTORY_NAME_MSGPACK_STREAM, std::string)
+
+    /*
+     * \class MsgPackStream
+     */
+    MsgPackStream::MsgPackStream() = default;
+
+    MsgPackStream::MsgPackStream(const std::string &msgPackContent) {
+        MsgPackReader reader(reinterpret_cast<const unsigned char *>(msgPackContent.data()), msgPackContent.size());
+        getDocument().Populate(reader);
+    }
+
+    std::vector<unsigned char> MsgPackStream::getBuffer() const {
+        std::vector<unsigned char> buffer;
+        MsgPackWriter writer(buffer);
+        writer.writeValue(getDocument());
+        return buffer;
+    }
+
+} // namespace NS_OSBASE::core::impl
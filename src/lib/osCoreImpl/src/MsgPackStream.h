@@ -0,0 +1,23 @@
+// \file  MsgPackStream.h
+// \brief Declaration of the class MsgPackStream
+
+#pragma once
+#include "RapidJsonStream.h"
+
+namespace NS_OSBASE::core::impl {
+
+    /**
+     * \brief 	This class represents:
+     *				- the concrete implementation of the class KeyStream<std::string> serialized in the MessagePack binary format
+     * \remark  The navigation is the one of the json stream (same DOM), only the buffer differs: compact and without text conversion of
+     * the numbers. The buffer is binary (not null-terminated).
+     */
+    class MsgPackStream final : public RapidJsonStream {
+    public:
+        MsgPackStream();
+        MsgPackStream(const std::string &msgPackContent);
+
+        std::vector<unsigned char> getBuffer() const override;
+    };
+
+} // namespace NS_OSBASE::core::impl
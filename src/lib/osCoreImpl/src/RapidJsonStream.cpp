@@ -340,6 +340,14 @@ namespace NS_OSBASE::core::impl {
         return static_cast<size_t>(pCurrentValue->Size());
     }
 
+    rapidjson::Document &RapidJsonStream::getDocument() {
+        return m_document;
+    }
+
+    const rapidjson::Document &RapidJsonStream::getDocument() const {
+        return m_document;
+    }
+
     rapidjson::Value *RapidJsonStream::getCurrentValue(const bool bWithIndex) {
         return getCurrentValue(m_keys, bWithIndex);
     }
@@ -13,7 +13,7 @@ namespace NS_OSBASE::core::impl {
      * \brief 	This class represents:
      *				- the concrete implementation of the class KeyStream<std::string>
      */
-    class RapidJsonStream final : public KeyStream<std::string> {
+    class RapidJsonStream : public KeyStream<std::string> {
     public:
         RapidJsonStream();
         RapidJsonStream(const std::string &jsonContent);
@@ -52,6 +52,10 @@ namespace NS_OSBASE::core::impl {
 
         std::vector<unsigned char> getBuffer() const override;
 
+    protected:
+        rapidjson::Document &getDocument();             //!< Return the DOM of the stream
+        const rapidjson::Document &getDocument() const; //!< \copydoc getDocument()
+
     private:
         using keys_type = std::deque<std::pair<std::string, int>>;
 
@@ -103,6 +103,10 @@ namespace NS_OSBASE::core::impl {
         return setStrValue({});
     }
 
+    bool RapidXmlStream::hasNull() const {
+        return false; // an empty element: same as an empty string, or an element with children only
+    }
+
     KeyValue<std::string, void> RapidXmlStream::createKey(const std::string &key) {
         return openKey(key, true);
     }
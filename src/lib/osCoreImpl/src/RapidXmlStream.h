@@ -31,6 +31,7 @@ namespace NS_OSBASE::core::impl {
 
         bool getValue() override;
         bool setValue() override;
+        bool hasNull() const override;
 
         KeyValue<std::string, void> createKey(const std::string &key) override;
         KeyValue<std::string, void> openKey(const std::string &key) override;
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "osCore/Misc/NonCopyable.h"
+#include "osData/ThreadSettings.h"
 #include <memory>
 
 /**
@@ -36,6 +37,8 @@ namespace NS_OSBASE::data {
          * \return      the allocated port
          *
          * \remark  set the in param "port" to 0 will let the system to choose an available port provided as return value
+         * \remark  the WebSocket (ws://) and the RawSocket (rs://) messagings connect to the same port, the protocol is detected from
+         * the first bytes received
          */
         virtual unsigned short start(const unsigned short port) = 0;
 
@@ -45,7 +48,14 @@ namespace NS_OSBASE::data {
         virtual void stop() = 0;
     };
 
-    IBrokerPtr makeBroker(); //!< create a broker
+    /**
+     * \brief Create a broker
+     * \param cpus    affinity of the threads of the broker, empty for none
+     * \remark The router serves all the sessions from one IO thread and one event thread (a wampcc kernel): the cpus only pin them, the
+     * broker doesn't scale over several cores. It can't be sharded over several kernels either: each wampcc router keeps its own
+     * registrations and subscriptions, a publication or a call would not reach the sessions of the other shards.
+     */
+    IBrokerPtr makeBroker(const CpuSet &cpus = CpuSet{});
 
     /** \} */
 } // namespace NS_OSBASE::data
@@ -2,7 +2,9 @@
 
 #pragma once
 #include "osCore/DesignPattern/Observer.h"
+#include "osData/ThreadSettings.h"
 #include "osData/Uri.h"
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -68,6 +70,28 @@ namespace NS_OSBASE::data {
         using IClientDelegatePtr  = std::shared_ptr<IClientDelegate>; //!< alias of shared pointer to IClientDelegate
         using IClientDelegateWPtr = std::weak_ptr<IClientDelegate>;   //!< alias of weak pointer to IClientDelegate
 
+        /**
+         * \brief Interface passed to ISupplierDelegate::onCallAsync to return the result of an RPC call, from any thread
+         * \remark Only the first answer is sent. If the interface is released without answer, an error is returned to the caller.
+         */
+        class ICallResult {
+        public:
+            virtual ~ICallResult(); //!< Dtor
+
+            /**
+             * \brief Return the result of the call to the caller
+             * \param   json    Stringified JSON string containing the result of the call
+             */
+            virtual void yield(const JsonText &json) = 0;
+
+            /**
+             * \brief Return an error to the caller
+             * \param   error   String containing details about the error
+             */
+            virtual void fail(const std::string &error) = 0;
+        };
+        using ICallResultPtr = std::shared_ptr<ICallResult>; //!< alias of shared pointer to ICallResult
+
         /**
          * \brief Delegate interface passed when registering an RPC call. Will be used to compute the result of the RPC call
          **/
@@ -80,6 +104,15 @@ namespace NS_OSBASE::data {
              * \param   json    Stringified JSON string containing the parameters passed in the call
              */
             virtual std::string onCall(const JsonText &json) = 0;
+
+            /**
+             * \brief Function called by the messaging when an invoke of the registered RPC call happens: the result can be returned
+             * later, by another thread (the messaging is not blocked meanwhile)
+             * \remark By default, return immediately the result of onCall (the RuntimeException are returned as errors).
+             * \param   json        Stringified JSON string containing the parameters passed in the call
+             * \param   pResult     Interface returning the result of the call
+             */
+            virtual void onCallAsync(const JsonText &json, ICallResultPtr pResult);
         };
         using ISupplierDelegatePtr  = std::shared_ptr<ISupplierDelegate>; //!< alias of shared pointer to ISupplierDelegate
         using ISupplierDelegateWPtr = std::weak_ptr<ISupplierDelegate>;   // alias of weak pointer to ISupplierDelegate
@@ -117,6 +150,22 @@ namespace NS_OSBASE::data {
         using IErrorDelegatePtr  = std::shared_ptr<IErrorDelegate>; //!< alias of shared pointer to IErrorDelegate
         using IErrorDelegateWPtr = std::weak_ptr<IErrorDelegate>;   //!< alias of weak pointer to IErrorDelegate
 
+        /**
+         * \brief Batching of the publications (see setPublishBatching())
+         *
+         * The batching applies to the topics included by setPublishBatched() only, the other topics are published at once as plain
+         * events. The publications of a batched topic pending within the window are sent in one message, and the receivers get them in
+         * order. The pending publications are sent when the oldest one has waited the window, or when their payloads reach the byte
+         * budget.
+         * \warning A batch is one WAMP event with a payload per argument, marked by the kwarg "osbase.batch": all the subscribers of a
+         * batched topic must run a messaging reading it. An older one gets the first publication of the batch only, another WAMP client
+         * one event with all the arguments. Include a topic only when all its subscribers are known to read the batches.
+         */
+        struct PublishBatching {
+            std::chrono::milliseconds window = std::chrono::milliseconds(0); //!< delay of the publications, 0 for no batching
+            size_t maxBytes                  = 0;                            //!< bytes of payload sent at once, 0 for no budget
+        };
+
         ~IMessaging() override; //!< dtor
 
         virtual void connect() = 0;    //!< Method to connect to the messaging service. Needs to be called before using any of the other
@@ -180,10 +229,38 @@ namespace NS_OSBASE::data {
          */
         virtual void publish(const std::string &topic, const std::string &argsSerialized, IErrorDelegatePtr pError) const = 0;
 
+        /**
+         * \brief Set the batching of the publications of the messaging, none by default
+         * \remark The publications pending when the batching is changed are sent. The topics are batched once included by
+         * setPublishBatched().
+         */
+        virtual void setPublishBatching(const PublishBatching &batching) = 0;
+
+        /**
+         * \brief Include a topic in the batching, or exclude it back: a topic is published at once by default (see PublishBatching)
+         * \param   topic       Topic published
+         * \param   bBatched    true to batch the publications of the topic, false to publish them at once
+         */
+        virtual void setPublishBatched(const std::string &topic, const bool bBatched) = 0;
+
+        /**
+         * \brief Send the pending publications at once
+         * \remark An error of sending is reported to the error delegates of the publications
+         */
+        virtual void flush() const = 0;
+
         static inline std::string DEFAULT_REALM = "osbase";
     };
 
-    IMessagingPtr makeWampMessaging(const Uri &uri, const std::string &realm = IMessaging::DEFAULT_REALM); //!< create a IMessaging
+    /**
+     * \brief Create a IMessaging
+     * \param uri     uri of the broker: ws://host:port (WebSocket) or rs://host:port (RawSocket, lighter, not for the browsers)
+     * \param realm   realm of the messaging
+     * \param threads threads of the session, used by the first messaging connecting it (see ThreadSettings)
+     * \remark The messagings of the process connected to the same broker and realm share one session (socket, threads, reconnection)
+     */
+    IMessagingPtr makeWampMessaging(
+        const Uri &uri, const std::string &realm = IMessaging::DEFAULT_REALM, const ThreadSettings &threads = ThreadSettings{});
 
     /** \} */
 } // namespace NS_OSBASE::data
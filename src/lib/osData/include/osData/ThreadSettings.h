@@ -0,0 +1,34 @@
+// \brief Declaration of the settings of the threads of the messaging
+
+#pragma once
+#include "osCore/Serialization/CoreKeySerializer.h"
+#include "osCore/Serialization/KeySerializerMacros.h"
+#include <vector>
+
+namespace NS_OSBASE::data {
+
+    /**
+     * \addtogroup PACKAGE_OSBASE_IMESSAGING
+     * \{
+     */
+
+    using CpuSet = std::vector<unsigned short>; //!< indexes of the CPUs a thread can run on, empty for any CPU
+
+    /**
+     * \brief Threads of the WAMP session of a messaging
+     *
+     * The traffic of the session is spread over nbIoThreads connections to the broker, each one served by an IO thread and an event
+     * thread (a wampcc kernel): a call uri, a topic are bound to one connection, their messages stay ordered. The messages of different
+     * uris or topics are not ordered with each other beyond one IO thread.\n
+     * Only the client side is spread: each connection is one more session on the broker, still served by its single IO thread (see
+     * makeBroker()). More IO threads help a process bound to its own IO thread, not a loaded broker.
+     */
+    struct ThreadSettings {
+        unsigned short nbIoThreads = 1; //!< connections to the broker (each one an IO thread and an event thread)
+        CpuSet cpus;                    //!< affinity of the threads of the session, empty for none
+    };
+
+    /** \} */
+} // namespace NS_OSBASE::data
+
+OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::data::ThreadSettings, nbIoThreads, cpus)
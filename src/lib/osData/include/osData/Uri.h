@@ -5,6 +5,7 @@
 #include "osCore/Exception/LogicException.h"
 #include "osCore/Misc/TypeCast.h"
 #include "osCore/Serialization/CoreKeySerializer.h"
+#include "osCore/Serialization/JsonSerializer.h"
 #include "osCore/Serialization/KeySerializerMacros.h"
 #include <filesystem>
 #include <optional>
@@ -82,6 +83,7 @@ namespace NS_OSBASE::data {
         static const Uri &null() noexcept;                                          //!< return the null uri
         static const std::string &schemeFile() noexcept;                            //!< return the predefined scheme 'file'
         static const std::string &schemeWebsocket() noexcept;                       //!< return the predefined scheme 'ws'
+        static const std::string &schemeRawSocket() noexcept;                       //!< return the predefined scheme 'rs' (WAMP RawSocket)
         static const std::string &schemeHyperTextTransferProtocol() noexcept;       //!< return the predefined scheme 'http'
         static const std::string &schemeHyperTextTransferProtocolSecure() noexcept; //!< return the predefined scheme 'https'
         static const std::string &schemeFileTransferProtocol() noexcept;            //!< return the predefined scheme 'ftp'
@@ -108,6 +110,16 @@ struct NS_OSBASE::core::KeySerializer<std::string, NS_OSBASE::data::Uri, false>
     static bool setValue(KeyStream<std::string> &keyStream, const data::Uri &value);             //!< \private
 };
 
+/**
+ * \brief Direct json serialization of the Uri
+ */
+template <>
+struct NS_OSBASE::core::JsonSerializer<NS_OSBASE::data::Uri> {
+    static constexpr bool isDefined = true;                        //!< \private
+    static void write(JsonWriter &writer, const data::Uri &value); //!< \private
+    static bool read(JsonReader &reader, data::Uri &value);        //!< \private
+};
+
 /**
  * \brief Convert an Uri to a string
  */
@@ -8,8 +8,8 @@ namespace nscore = NS_OSBASE::core;
 
 namespace NS_OSBASE::data {
 
-    IBrokerPtr makeBroker() {
-        return nscore::TheFactoryManager.createInstance<IBroker>(WAMPCCBROCKER_FACTORY_NAME);
+    IBrokerPtr makeBroker(const CpuSet &cpus) {
+        return nscore::TheFactoryManager.createInstance<IBroker>(WAMPCCBROCKER_FACTORY_NAME, cpus);
     }
 
 } // namespace NS_OSBASE::data
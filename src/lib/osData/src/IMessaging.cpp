@@ -3,6 +3,7 @@
 #include "osData/IMessaging.h"
 #include "osData/FactoryNames.h"
 #include "osCore/DesignPattern/AbstractFactory.h"
+#include "osCore/Exception/RuntimeException.h"
 
 namespace nscore = NS_OSBASE::core;
 
@@ -24,12 +25,24 @@ namespace NS_OSBASE::data {
     IMessaging::~IMessaging() = default;
 
     IMessaging::IClientDelegate::~IClientDelegate()     = default;
+    IMessaging::ICallResult::~ICallResult()             = default;
     IMessaging::ISupplierDelegate::~ISupplierDelegate() = default;
     IMessaging::IEventDelegate::~IEventDelegate()       = default;
     IMessaging::IErrorDelegate::~IErrorDelegate()       = default;
 
-    IMessagingPtr makeWampMessaging(const Uri &uri, const std::string &realm) {
-        return nscore::TheFactoryManager.createInstance<IMessaging>(MESSAGINGWAMPCC_FACTORY_NAME, uri, realm);
+    /*
+     * \class IMessaging::ISupplierDelegate
+     */
+    void IMessaging::ISupplierDelegate::onCallAsync(const JsonText &json, ICallResultPtr pResult) {
+        try {
+            pResult->yield(onCall(json));
+        } catch (const nscore::RuntimeException &e) {
+            pResult->fail(e.what());
+        }
+    }
+
+    IMessagingPtr makeWampMessaging(const Uri &uri, const std::string &realm, const ThreadSettings &threads) {
+        return nscore::TheFactoryManager.createInstance<IMessaging>(MESSAGINGWAMPCC_FACTORY_NAME, uri, realm, threads);
     }
 
 } // namespace NS_OSBASE::data
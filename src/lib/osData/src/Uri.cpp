@@ -130,6 +130,11 @@ namespace NS_OSBASE::data {
         return schemeName;
     }
 
+    const std::string &Uri::schemeRawSocket() noexcept {
+        static const std::string schemeName = "rs";
+        return schemeName;
+    }
+
     const std::string &Uri::schemeHyperTextTransferProtocol() noexcept {
         static const std::string schemeName = "http";
         return schemeName;
@@ -163,6 +168,24 @@ bool nscore::KeySerializer<std::string, nsdata::Uri, false>::setValue(KeyStream<
     return keyStream.setValue(type_cast<std::string>(value));
 }
 
+void nscore::JsonSerializer<nsdata::Uri>::write(JsonWriter &writer, const nsdata::Uri &value) {
+    writer.writeString(type_cast<std::string>(value));
+}
+
+bool nscore::JsonSerializer<nsdata::Uri>::read(JsonReader &reader, nsdata::Uri &value) {
+    std::string strUri;
+    if (!reader.readString(strUri)) {
+        return false;
+    }
+
+    try {
+        value = type_cast<nsdata::Uri>(strUri);
+        return true;
+    } catch (const nsdata::BadUriException &) {
+        return false;
+    }
+}
+
 std::string type_converter<std::string, nsdata::Uri>::convert(const nsdata::Uri &uri) {
     if (uri == nsdata::Uri::null()) {
         return "";
@@ -0,0 +1,72 @@
+// \brief Implementation of the thread running the delegates of a messaging
+
+#include "DelegateDispatcher.h"
+#include "osData/Log.h"
+
+namespace NS_OSBASE::data::impl {
+
+    bool DelegateDispatcher::Queue::post(Task task) {
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_bStop) {
+                return false;
+            }
+            m_tasks.push_back(std::move(task));
+        }
+        m_cv.notify_one();
+        return true;
+    }
+
+    bool DelegateDispatcher::Queue::pop(Task &task) {
+        std::unique_lock lock(m_mutex);
+        m_cv.wait(lock, [this]() { return m_bStop || !m_tasks.empty(); });
+        if (m_bStop) {
+            return false;
+        }
+
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        return true;
+    }
+
+    void DelegateDispatcher::Queue::stop() {
+        std::deque<Task> tasks; // released unlocked: a released call returns its error
+        {
+            std::lock_guard lock(m_mutex);
+            m_bStop = true;
+            tasks.swap(m_tasks);
+        }
+        m_cv.notify_one();
+    }
+
+    DelegateDispatcher::~DelegateDispatcher() {
+        m_pQueue->stop();
+        if (!m_thread.joinable()) {
+            return;
+        }
+
+        if (m_thread.get_id() == std::this_thread::get_id()) {
+            m_thread.detach(); // messaging released by one of its delegates: the thread ends after it
+        } else {
+            m_thread.join();
+        }
+    }
+
+    DelegateDispatcher::QueuePtr DelegateDispatcher::getQueue() {
+        std::call_once(m_started, [this]() {
+            m_thread = std::thread([pQueue = m_pQueue]() {
+                Task task;
+                while (pQueue->pop(task)) {
+                    try {
+                        task();
+                    } catch (const std::exception &e) {
+                        oslog::error(OS_LOG_CHANNEL_DATA) << "Delegate of the messaging failed: " << e.what() << oslog::end();
+                    }
+                    task = nullptr;
+                }
+            });
+        });
+
+        return m_pQueue;
+    }
+} // namespace NS_OSBASE::data::impl
@@ -0,0 +1,54 @@
+// \brief Declaration of the thread running the delegates of a messaging
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace NS_OSBASE::data::impl {
+
+    /**
+     * \brief Thread running the delegates of a messaging (invocations and events), in order
+     *
+     * The WAMP session is shared by the messagings of the process: its event thread only posts the delegates here, a delegate may
+     * then wait for a result or an event received by the session (ex: a registered call invoking the call of another service).\n
+     * The delegates are posted in a queue shared with the posters: a poster never owns the thread, only the messaging stops it.
+     */
+    class DelegateDispatcher {
+    public:
+        using Task = std::function<void()>;
+
+        class Queue {
+        public:
+            bool post(Task task); //!< Return false if the dispatcher is stopped (the task is released)
+            bool pop(Task &task); //!< Wait for the next task, return false when the dispatcher is stopped
+            void stop();          //!< The pending tasks are released
+
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::deque<Task> m_tasks;
+            bool m_bStop = false;
+        };
+        using QueuePtr = std::shared_ptr<Queue>;
+
+        DelegateDispatcher() = default;
+        ~DelegateDispatcher();
+
+        DelegateDispatcher(const DelegateDispatcher &)            = delete;
+        DelegateDispatcher &operator=(const DelegateDispatcher &) = delete;
+
+        /**
+         * \brief Return the queue of the dispatcher, the thread is started with the first call
+         */
+        QueuePtr getQueue();
+
+    private:
+        std::once_flag m_started;
+        QueuePtr m_pQueue = std::make_shared<Queue>();
+        std::thread m_thread;
+    };
+} // namespace NS_OSBASE::data::impl
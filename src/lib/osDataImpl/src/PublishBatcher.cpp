@@ -0,0 +1,118 @@
+// \brief Implementation of the batching of the publications of a messaging
+
+#include "PublishBatcher.h"
+#include "osData/MessagingException.h"
+
+namespace NS_OSBASE::data::impl {
+
+    PublishBatcher::PublishBatcher(Send send) : m_send(std::move(send)) {
+    }
+
+    PublishBatcher::~PublishBatcher() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_bStop = true;
+        }
+        m_cv.notify_one();
+
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+    }
+
+    void PublishBatcher::setBatching(const IMessaging::PublishBatching &batching) {
+        {
+            std::lock_guard lock(m_mutex);
+            m_batching = batching;
+            if (m_batching.window.count() > 0 && !m_thread.joinable()) {
+                m_thread = std::thread([this]() { run(); });
+            }
+        }
+        flush();
+    }
+
+    void PublishBatcher::setBatched(const std::string &topic, const bool bBatched) {
+        {
+            std::lock_guard lock(m_mutex);
+            if (bBatched) {
+                m_batchedTopics.insert(topic);
+                return;
+            }
+            m_batchedTopics.erase(topic);
+        }
+        flush(); // the next publications of the topic are sent after the pending ones
+    }
+
+    bool PublishBatcher::publish(const std::string &topic, const std::string &payload, IMessaging::IErrorDelegatePtr pError) {
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_batching.window.count() <= 0 || m_batchedTopics.find(topic) == m_batchedTopics.cend()) {
+                return false;
+            }
+
+            auto &batch = m_batches[topic];
+            batch.payloads.push_back(payload);
+            if (pError != nullptr) {
+                batch.pErrors.push_back(pError);
+            }
+            m_nbBytes += payload.size();
+
+            if (m_batching.maxBytes == 0 || m_nbBytes < m_batching.maxBytes) {
+                if (!m_first.has_value()) {
+                    m_first = std::chrono::steady_clock::now();
+                    m_cv.notify_one();
+                }
+                return true;
+            }
+        }
+
+        flush(); // byte budget reached
+        return true;
+    }
+
+    void PublishBatcher::flush() {
+        std::lock_guard lockSend(m_mutSend);
+        Batches batches;
+        {
+            std::lock_guard lock(m_mutex);
+            batches.swap(m_batches);
+            m_nbBytes = 0;
+            m_first.reset();
+        }
+        send(std::move(batches));
+    }
+
+    void PublishBatcher::run() {
+        std::unique_lock lock(m_mutex);
+        while (!m_bStop) {
+            if (!m_first.has_value()) {
+                m_cv.wait(lock, [this]() { return m_bStop || m_first.has_value(); });
+                continue;
+            }
+
+            auto const deadline = m_first.value() + m_batching.window;
+            if (std::chrono::steady_clock::now() < deadline) {
+                m_cv.wait_until(lock, deadline);
+                continue;
+            }
+
+            lock.unlock();
+            flush();
+            lock.lock();
+        }
+    }
+
+    void PublishBatcher::send(Batches &&batches) const {
+        for (auto const &[topic, batch] : batches) {
+            try {
+                m_send(topic, batch.payloads, batch.pErrors);
+            } catch (const MessagingException &) {
+                for (auto const &pWErrorDelegate : batch.pErrors) {
+                    if (auto const pErrorDelegate = pWErrorDelegate.lock(); pErrorDelegate != nullptr) {
+                        pErrorDelegate->onError("Publishing failed for topic: " + topic);
+                    }
+                }
+            }
+        }
+    }
+} // namespace NS_OSBASE::data::impl
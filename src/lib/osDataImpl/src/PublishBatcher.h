@@ -0,0 +1,78 @@
+// \brief Declaration of the batching of the publications of a messaging
+#pragma once
+
+#include "osData/IMessaging.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace NS_OSBASE::data::impl {
+
+    /**
+     * \brief Batching of the publications of a messaging (see IMessaging::PublishBatching)
+     *
+     * Only the topics included by setBatched() are batched, the others are published at once.\n
+     * The publications are kept per topic, then each topic is sent in one message with all its pending payloads, in order. The batches
+     * are sent together, by a thread of the batcher when the oldest publication has waited the window, or by the publisher when the
+     * payloads reach the byte budget.\n
+     * The batches of a topic are sent one after the other: the order of the publications of a topic is kept, not across the topics.
+     */
+    class PublishBatcher {
+    public:
+        using ErrorDelegates = std::vector<IMessaging::IErrorDelegateWPtr>;
+        using Send = std::function<void(const std::string &topic, const std::vector<std::string> &payloads, const ErrorDelegates &pErrors)>;
+
+        explicit PublishBatcher(Send send);
+        ~PublishBatcher();
+
+        /**
+         * \brief Set the batching, the pending publications are sent
+         */
+        void setBatching(const IMessaging::PublishBatching &batching);
+
+        /**
+         * \brief Include a topic in the batching (excluded by default) or exclude it back, its pending publications are then sent
+         */
+        void setBatched(const std::string &topic, const bool bBatched);
+
+        /**
+         * \brief Keep a publication for the next batch
+         * \return false if the publication is not batched: to be sent by the caller
+         */
+        bool publish(const std::string &topic, const std::string &payload, IMessaging::IErrorDelegatePtr pError);
+
+        /**
+         * \brief Send the pending publications
+         */
+        void flush();
+
+    private:
+        struct Batch {
+            std::vector<std::string> payloads;
+            ErrorDelegates pErrors;
+        };
+        using Batches = std::unordered_map<std::string, Batch>;
+
+        void run(); // sends the publications older than the window
+        void send(Batches &&batches) const;
+
+        Send m_send;
+        std::mutex m_mutSend; // the batches are sent one after the other
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        IMessaging::PublishBatching m_batching;
+        std::unordered_set<std::string> m_batchedTopics;
+        Batches m_batches;
+        size_t m_nbBytes = 0;                                         // of the pending payloads
+        std::optional<std::chrono::steady_clock::time_point> m_first; // oldest pending publication
+        bool m_bStop = false;
+        std::thread m_thread; // started with the first batching
+    };
+} // namespace NS_OSBASE::data::impl
@@ -0,0 +1,61 @@
+// \brief Declaration of the read-mostly map of the WAMP session
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace NS_OSBASE::data::impl {
+
+    /**
+     * \brief Read-mostly map, read without lock
+     *
+     * The readers get an immutable snapshot of the map (atomic load of a shared pointer): a lookup never waits for a writer, nor for
+     * the other readers. A writer copies the map, modifies the copy and publishes it, the writers are serialized.\n
+     * Suited to the tables looked up for each message and modified on (un)registrations only.
+     */
+    template <typename TKey, typename TValue>
+    class SnapshotMap {
+    public:
+        using Map         = std::unordered_map<TKey, TValue>;
+        using SnapshotPtr = std::shared_ptr<const Map>;
+
+        SnapshotPtr load() const {
+            return std::atomic_load(&m_pSnapshot);
+        }
+
+        std::optional<TValue> find(const TKey &key) const {
+            auto const pSnapshot = load();
+            if (auto const it = pSnapshot->find(key); it != pSnapshot->cend()) {
+                return it->second;
+            }
+            return {};
+        }
+
+        void insert(const TKey &key, const TValue &value) {
+            update([&key, &value](Map &map) { map[key] = value; });
+        }
+
+        void erase(const TKey &key) {
+            update([&key](Map &map) { map.erase(key); });
+        }
+
+        void clear() {
+            std::lock_guard lock(m_mutWriters);
+            std::atomic_store(&m_pSnapshot, std::make_shared<const Map>());
+        }
+
+    private:
+        template <typename TUpdate>
+        void update(TUpdate &&updateMap) {
+            std::lock_guard lock(m_mutWriters);
+            auto pMap = std::make_shared<Map>(*m_pSnapshot);
+            updateMap(*pMap);
+            std::atomic_store(&m_pSnapshot, SnapshotPtr(std::move(pMap)));
+        }
+
+        std::mutex m_mutWriters;
+        SnapshotPtr m_pSnapshot = std::make_shared<const Map>();
+    };
+} // namespace NS_OSBASE::data::impl
@@ -0,0 +1,44 @@
+// \brief Implementation of the functions binding the threads of the messaging to CPUs
+
+#include "ThreadAffinity.h"
+#include "osData/Log.h"
+#include "osData/MessagingException.h"
+#include "wampcc/wampcc.h"
+#include <Windows.h>
+
+namespace NS_OSBASE::data::impl {
+
+    void setThreadAffinity(const CpuSet &cpus) {
+        if (cpus.empty()) {
+            return;
+        }
+
+        DWORD_PTR mask = 0;
+        for (auto const cpu : cpus) {
+            if (cpu >= sizeof(DWORD_PTR) * 8) {
+                throw MessagingException("CPU " + std::to_string(cpu) + " out of the processor group");
+            }
+            mask |= DWORD_PTR{ 1 } << cpu;
+        }
+
+        if (::SetThreadAffinityMask(::GetCurrentThread(), mask) == 0) {
+            throw MessagingException("Could not set the affinity of the thread, error " + std::to_string(::GetLastError()));
+        }
+    }
+
+    void setKernelAffinity(wampcc::kernel &kernel, const CpuSet &cpus) {
+        if (cpus.empty()) {
+            return;
+        }
+
+        auto const bind = [cpus]() {
+            try {
+                setThreadAffinity(cpus);
+            } catch (const MessagingException &e) {
+                oslog::error(OS_LOG_CHANNEL_DATA) << e.what() << oslog::end();
+            }
+        };
+        kernel.get_io()->push_fn(bind);
+        kernel.get_event_loop()->dispatch(bind);
+    }
+} // namespace NS_OSBASE::data::impl
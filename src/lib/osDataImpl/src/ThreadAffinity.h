@@ -0,0 +1,23 @@
+// \brief Declaration of the functions binding the threads of the messaging to CPUs
+
+#pragma once
+#include "osData/ThreadSettings.h"
+
+namespace wampcc {
+    class kernel;
+}
+
+namespace NS_OSBASE::data::impl {
+
+    /**
+     * \brief Bind the calling thread to the CPUs, nothing if none
+     * \throws MessagingException if a CPU doesn't exist
+     */
+    void setThreadAffinity(const CpuSet &cpus);
+
+    /**
+     * \brief Bind the IO thread and the event thread of a kernel to the CPUs, nothing if none
+     * \remark Applied asynchronously by each thread of the kernel
+     */
+    void setKernelAffinity(wampcc::kernel &kernel, const CpuSet &cpus);
+} // namespace NS_OSBASE::data::impl
@@ -1,4 +1,5 @@
 #include "WampccBroker.h"
+#include "ThreadAffinity.h"
 #include "osData/FactoryNames.h"
 #include "osCore/DesignPattern/AbstractFactory.h"
 #include "osCore/Misc/Scope.h"
@@ -7,7 +8,7 @@
 #include <wampcc/wampcc.h>
 
 namespace NS_OSBASE::data::impl {
-    OS_REGISTER_FACTORY_N(IBroker, WampccBroker, 0, WAMPCCBROCKER_FACTORY_NAME);
+    OS_REGISTER_FACTORY_N(IBroker, WampccBroker, 0, WAMPCCBROCKER_FACTORY_NAME, CpuSet);
 
     void WampccBroker::startWampcc(unsigned short port) {
         {
@@ -25,7 +26,8 @@ namespace NS_OSBASE::data::impl {
         m_cvStopped.wait(lock);
     }
 
-    WampccBroker::WampccBroker() {
+    WampccBroker::WampccBroker(const CpuSet &cpus) {
+        setKernelAffinity(m_kernel, cpus);
         m_pRouter = std::make_shared<wampcc::wamp_router>(&m_kernel);
     }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "osData/IBroker.h"
+#include "osData/ThreadSettings.h"
 
 #include <future>
 #include <mutex>
@@ -10,11 +11,11 @@
 namespace NS_OSBASE::data::impl {
     /**
      * Implementation of the Wampcc broker
+     * \remark The router runs on one kernel: an IO thread and an event thread, bound to the CPUs given at the creation.
      */
     class WampccBroker : public IBroker {
     public:
-        WampccBroker();
-        ;
+        explicit WampccBroker(const CpuSet &cpus);
         ~WampccBroker() override = default;
 
         unsigned short start(const unsigned short port) override;
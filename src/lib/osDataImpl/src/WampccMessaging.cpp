@@ -3,408 +3,244 @@
 #include "WampccMessaging.h"
 #include "osData/FactoryNames.h"
 #include "osCore/DesignPattern/AbstractFactory.h"
-#include "osCore/Exception/RuntimeException.h"
 #include "osData/MessagingException.h"
-#include "osData/Log.h"
-
-#include <chrono>
-#include <string>
-
-using namespace std::chrono_literals;
-using namespace wampcc;
-
-#define LOGIMPL(X, LEVEL)                                                                                                                  \
-    do {                                                                                                                                   \
-        if (__logger.wants_level && __logger.write && __logger.wants_level(LEVEL)) {                                                       \
-            std::ostringstream __xx_oss;                                                                                                   \
-            __xx_oss << X;                                                                                                                 \
-            __logger.write(LEVEL, __xx_oss.str(), __FILE__, __LINE__);                                                                     \
-        }                                                                                                                                  \
-    } while (false)
-
-#define LOG_INFO(X) LOGIMPL(X, wampcc::logger::eInfo)
 
 namespace NS_OSBASE::data::impl {
-    OS_REGISTER_FACTORY_N(IMessaging, WampccMessaging, 0, MESSAGINGWAMPCC_FACTORY_NAME, Uri, std::string);
-
     namespace {
-        wampcc::logger osLogger() {
-            logger logger_p;
-
-            const auto levelMask = logger::levels_upto(logger::eInfo);
-            logger_p.wants_level = [levelMask](logger::Level l) { return (l & levelMask) != 0; };
+        /*
+         * \class DispatchedSupplierDelegate
+         */
+        class DispatchedSupplierDelegate : public IMessaging::ISupplierDelegate {
+        public:
+            DispatchedSupplierDelegate(IMessaging::ISupplierDelegateWPtr pDelegate, DelegateDispatcher::QueuePtr pQueue)
+                : m_pDelegate(std::move(pDelegate)), m_pQueue(std::move(pQueue)) {
+            }
 
-            logger_p.write = [](logger::Level level, const std::string &msg, const char *, int) {
-                if ((TheLogger.getChannelMask() & OS_LOG_CHANNEL_DATA) == 0) {
-                    return;
+            std::string onCall(const IMessaging::JsonText &json) override {
+                auto const pDelegate = m_pDelegate.lock();
+                if (pDelegate == nullptr) {
+                    throw MessagingException("Error while calling procedure.");
                 }
+                return pDelegate->onCall(json);
+            }
 
-                if ((level & logger::eError) != 0) {
-                    ::oslog::error(OS_LOG_CHANNEL_DATA) << msg << ::oslog::end();
-                } else if ((level & logger::eWarn) != 0) {
-                    ::oslog::warning(OS_LOG_CHANNEL_DATA) << msg << ::oslog::end();
-                } else if ((level & logger::eInfo) != 0) {
-                    ::oslog::info(OS_LOG_CHANNEL_DATA) << msg << ::oslog::end();
-                }
-            };
+            void onCallAsync(const IMessaging::JsonText &json, IMessaging::ICallResultPtr pResult) override {
+                // a released task releases its result: the caller gets an error
+                m_pQueue->post([pWDelegate = m_pDelegate, json, pResult = std::move(pResult)]() {
+                    if (auto const pDelegate = pWDelegate.lock(); pDelegate != nullptr) {
+                        pDelegate->onCallAsync(json, pResult);
+                    }
+                });
+            }
 
-            return logger_p;
-        }
+        private:
+            IMessaging::ISupplierDelegateWPtr m_pDelegate;
+            DelegateDispatcher::QueuePtr m_pQueue;
+        };
+
+        /*
+         * \class DispatchedEventDelegate
+         */
+        class DispatchedEventDelegate : public IMessaging::IEventDelegate {
+        public:
+            DispatchedEventDelegate(IMessaging::IEventDelegateWPtr pDelegate, DelegateDispatcher::QueuePtr pQueue)
+                : m_pDelegate(std::move(pDelegate)), m_pQueue(std::move(pQueue)) {
+            }
+
+            void onEvent(const IMessaging::JsonText &json) override {
+                m_pQueue->post([pWDelegate = m_pDelegate, json]() {
+                    if (auto const pDelegate = pWDelegate.lock(); pDelegate != nullptr) {
+                        pDelegate->onEvent(json);
+                    }
+                });
+            }
+
+        private:
+            IMessaging::IEventDelegateWPtr m_pDelegate;
+            DelegateDispatcher::QueuePtr m_pQueue;
+        };
     } // namespace
 
-    static auto const __logger = osLogger();
+    OS_REGISTER_FACTORY_N(IMessaging, WampccMessaging, 0, MESSAGINGWAMPCC_FACTORY_NAME, Uri, std::string, ThreadSettings);
 
-    WampccMessaging::WampccMessaging(const Uri &uri, const std::string &realm)
-        : m_uri(uri), m_realm(realm.empty() ? DEFAULT_REALM : realm), m_kernel(m_wampccConf, __logger) {
+    WampccMessaging::WampccMessaging(const Uri &uri, const std::string &realm, const ThreadSettings &threads)
+        : m_uri(uri),
+          m_realm(realm.empty() ? DEFAULT_REALM : realm),
+          m_threads(threads),
+          m_batcher([this](const std::string &topic, const auto &payloads, const auto &pErrors) {
+              ensureSession()->publish(topic, payloads, pErrors);
+          }) {
     }
 
     WampccMessaging::~WampccMessaging() /*override*/ {
-        if (!m_bStopRetryConnection) {
-            std::lock_guard lock(m_mutConnection);
-            m_bStopRetryConnection = true;
-            m_cvConnection.notify_one();
-        }
-
-        if (m_futConnection.valid()) {
-            if (m_futConnection.wait_for(s_timeoutRetryConnection * 2) != std::future_status::ready) {
-                std::cerr << "MessagingWampcc::~MessagingWampcc: fail to stop the reconnection thread!" << std::endl;
-            }
-        }
-
-        doDisconnect();
+        disconnect();
     }
 
     void WampccMessaging::connect() {
-        static constexpr auto helloTimeout = 4s;
-
-        if (!m_uri.isValid() || !m_uri.authority.has_value() || !m_uri.authority.value().port.has_value()) {
-            throw MessagingException("uri invalid: " + type_cast<std::string>(m_uri));
-        }
-
-        m_session.reset();
-
-        auto sock                  = std::make_unique<wampcc::tcp_socket>(&m_kernel);
-        const auto connectionError = sock->connect(m_uri.authority.value().host, m_uri.authority->port.value()).get();
-        if (connectionError != 0) {
-            if (isStateConnected() || isStateIdle()) {
-                setStateDisconnected();
-                m_futConnection = std::async([this]() { retryConnection(); });
+        WampccSessionPtr pSession;
+        {
+            std::lock_guard<std::recursive_mutex> guard(m_mutex);
+            if (m_pSession == nullptr) {
+                m_pSession = WampccSession::getSession(m_uri, m_realm, m_threads);
+                m_pSession->attachAll(*this);
             }
-            throw MessagingException("Could not connect to socket " + std::string(connectionError.message()));
+            pSession = m_pSession;
         }
 
-        m_session = wamp_session::create<websocket_protocol>(&m_kernel, std::move(sock), [this](wamp_session &, bool is_open) {
-            if (!is_open && isStateConnected()) {
-                setStateDisconnected();
-                m_futConnection = std::async([this]() { retryConnection(); });
-            }
-        });
-
-        if (m_session->hello(m_realm).wait_for(helloTimeout) != std::future_status::ready) {
-            throw MessagingException("Realm logon failed");
-        }
-        if (!m_session->is_open()) {
-            throw MessagingException("Realm logon failed");
+        try {
+            pSession->connect();
+        } catch (const MessagingException &) {
+            setState(States::Disconnected); // the session notifies the reconnection
+            throw;
         }
 
-        setStateConnected();
+        setState(States::Connected);
     }
 
     void WampccMessaging::disconnect() {
-        doDisconnect();
-    }
-
-    void WampccMessaging::registerCall(const std::string &uri, ISupplierDelegatePtr pDelegate, IErrorDelegatePtr pError) /*override*/ {
-        std::lock_guard<std::recursive_mutex> guard(m_mutex);
-
-        if (m_registeredCalls.find(uri) != m_registeredCalls.end())
-            throw MessagingException("The uri " + uri + " has already been registered");
-        auto &session = ensureValidSession();
-        session.provide(
-            uri,
-            {},
-            [this, pDelegate, uri, pwErrorDelegate = IErrorDelegateWPtr(pError)](wamp_session &, const registered_info &info) {
-                std::lock_guard<std::recursive_mutex> guard(m_mutex);
-
-                if (info.was_error) {
-                    auto const pErrorDelegate = pwErrorDelegate.lock();
-                    if (pErrorDelegate != nullptr)
-                        pErrorDelegate->onError("Procedure registration failed, error " + info.error_uri);
-                    return;
+        m_batcher.flush();
+
+        WampccSessionPtr pSession;
+        std::unordered_map<std::string, ISupplierDelegatePtr> registeredCalls;
+        std::unordered_map<std::string, IEventDelegatePtr> subscribedTopics;
+        {
+            std::lock_guard<std::recursive_mutex> guard(m_mutex);
+            pSession.swap(m_pSession);
+            registeredCalls.swap(m_registeredCalls);
+            subscribedTopics.swap(m_subscribedTopics);
+        }
+
+        if (pSession != nullptr) {
+            pSession->detachAll(*this);
+
+            // the session is kept by the other messagings: release what is left by this one
+            for (auto const &[uri, pDelegate] : registeredCalls) {
+                try {
+                    pSession->unregisterCall(uri, nullptr);
+                } catch (const MessagingException &) {
                 }
+            }
 
-                LOG_INFO("Procedure registered with id: " << info.registration_id);
-                m_callDelegates[info.registration_id] = pDelegate;
-                m_registeredCalls[uri]                = info.registration_id;
-            },
-            [this](wamp_session &ws, invocation_info info) {
-                std::lock_guard<std::recursive_mutex> guard(m_mutex);
-
-                if (const auto itDelegates = m_callDelegates.find(info.registration_id); itDelegates != m_callDelegates.cend()) {
-                    const ISupplierDelegatePtr pDelegate = itDelegates->second.lock();
-                    if (pDelegate != nullptr) {
-                        if (info.args.args_list.size() <= 1) {
-                            try {
-                                m_state = States::ConnectedCalling;
-                                auto const result =
-                                    pDelegate->onCall(info.args.args_list.empty() ? "" : info.args.args_list[0].as_string());
-                                if (m_state == States::ConnectedCalling) {
-                                    ws.yield(info.request_id, { result });
-                                    m_state = States::Connected;
-                                }
-                            } catch (const core::RuntimeException &e) {
-                                ws.invocation_error(info.request_id, e.what());
-                                oslog::error(OS_LOG_CHANNEL_DATA) << e.what() << oslog::end();
-                            }
-                            return;
-                        }
-                    }
+            for (auto const &[topic, pDelegate] : subscribedTopics) {
+                try {
+                    pSession->unsubscribe(topic, pDelegate, nullptr);
+                } catch (const MessagingException &) {
                 }
-                ws.invocation_error(info.request_id, "Error while calling procedure.");
-            });
+            }
+        }
+
+        setState(States::Disconnected);
     }
 
-    void WampccMessaging::unregisterCall(const std::string &uri, IErrorDelegatePtr pError) {
-        std::lock_guard<std::recursive_mutex> guard(m_mutex);
+    void WampccMessaging::registerCall(const std::string &uri, ISupplierDelegatePtr pDelegate, IErrorDelegatePtr pError) /*override*/ {
+        auto const pSession            = ensureSession();
+        auto const pDispatchedDelegate = std::make_shared<DispatchedSupplierDelegate>(pDelegate, m_dispatcher.getQueue());
+        pSession->registerCall(uri, pDispatchedDelegate, pError);
 
-        auto &session = ensureValidSession();
-        if (m_registeredCalls.find(uri) == m_registeredCalls.end()) {
-            throw MessagingException("No procedure registered with name " + uri);
-        }
-        auto registration_id = m_registeredCalls[uri];
-        session.unprovide(registration_id,
-            [this, &registration_id, uri, pwErrorDelegate = IErrorDelegateWPtr(pError)](wamp_session &, unregistered_info info) {
-                std::lock_guard<std::recursive_mutex> guard(m_mutex);
-
-                if (info.was_error) {
-                    auto const pErrorDelegate = pwErrorDelegate.lock();
-                    if (pErrorDelegate != nullptr)
-                        pErrorDelegate->onError("Unregister error for " + uri);
-                    return;
-                }
-                auto const itCallDelegates = m_callDelegates.find(registration_id);
-                if (itCallDelegates != m_callDelegates.end()) {
-                    m_callDelegates.erase(itCallDelegates);
-                }
-                auto const itRegisteredCalls = m_registeredCalls.find(uri);
-                if (itRegisteredCalls != m_registeredCalls.end()) {
-                    m_registeredCalls.erase(itRegisteredCalls);
-                }
-            });
+        std::lock_guard<std::recursive_mutex> guard(m_mutex);
+        m_registeredCalls[uri] = pDispatchedDelegate;
     }
 
-    void WampccMessaging::invoke(
-        const std::string &uri, const std::string &argsSerialized, IClientDelegatePtr pDelegate, IErrorDelegatePtr pError) const {
-        auto &session = ensureValidSession();
-        wamp_args wampArgs;
-        wampArgs.args_list.push_back(argsSerialized);
-
-        session.call(uri,
-            {},
-            wampArgs,
-            [this, pWDelegate = IClientDelegateWPtr(pDelegate), pWErrorDelegate = IErrorDelegateWPtr(pError)](
-                wamp_session &, wampcc::result_info info) {
-                std::lock_guard<std::recursive_mutex> guard(m_mutex);
-
-                if ((info.was_error || info.args.args_list.empty())) {
-                    std::string strError;
-                    if (info.was_error) {
-                        strError = "There was an error when invoking: " + info.error_uri;
-                    } else if (info.args.args_list.empty()) {
-                        strError = "No result received from remote call.";
-                    }
+    void WampccMessaging::unregisterCall(const std::string &uri, IErrorDelegatePtr pError) /*override*/ {
+        auto const pSession = ensureSession();
+        {
+            std::lock_guard<std::recursive_mutex> guard(m_mutex);
+            if (m_registeredCalls.erase(uri) == 0) {
+                throw MessagingException("No procedure registered with name " + uri);
+            }
+        }
 
-                    if (auto const pErrorDelegate = pWErrorDelegate.lock(); pErrorDelegate != nullptr) {
-                        pErrorDelegate->onError(strError);
-                    }
-                    return;
-                }
+        pSession->unregisterCall(uri, pError);
+    }
 
-                auto const pClientDelegate = pWDelegate.lock();
-                if (pClientDelegate != nullptr) {
-                    pClientDelegate->onResult(info.args.args_list[0].as_string());
-                }
-            });
+    void WampccMessaging::invoke(const std::string &uri,
+        const std::string &argsSerialized,
+        IClientDelegatePtr pDelegate,
+        IErrorDelegatePtr pError) const /*override*/ {
+        ensureSession()->invoke(uri, argsSerialized, pDelegate, pError);
     }
 
     void WampccMessaging::subscribe(const std::string &topic, IEventDelegatePtr pDelegate, IErrorDelegatePtr pError) /*override*/ {
-        std::lock_guard<std::recursive_mutex> guard(m_mutex);
+        auto const pSession = ensureSession();
+        {
+            std::lock_guard<std::recursive_mutex> guard(m_mutex);
+            if (m_subscribedTopics.find(topic) != m_subscribedTopics.cend()) {
+                throw MessagingException(topic + " already subscribed");
+            }
+        }
 
-        auto &session = ensureValidSession();
-        if (m_subscribedTopics.find(topic) != m_subscribedTopics.end())
-            throw MessagingException(topic + " already subscribed");
-
-        session.subscribe(
-            topic,
-            {},
-            [topic, this, pWDelegate = IEventDelegateWPtr(pDelegate), pWErrorDelegate = IErrorDelegateWPtr(pError)](
-                wamp_session &, const subscribed_info &info) {
-                std::lock_guard<std::recursive_mutex> guard(m_mutex);
-
-                if (info.was_error) {
-                    auto const pErrorDelegate = pWErrorDelegate.lock();
-                    if (pErrorDelegate != nullptr)
-                        pErrorDelegate->onError("There was an issue subscribing the topic: " + topic);
-                }
-                m_eventDelegates[info.subscription_id] = pWDelegate;
-                m_subscribedTopics[topic]              = info.subscription_id;
-            },
-            [this](wamp_session &, event_info info) {
-                std::lock_guard<std::recursive_mutex> guard(m_mutex);
-
-                const IEventDelegatePtr pDelegate = m_eventDelegates[info.subscription_id].lock();
-                if (pDelegate != nullptr) {
-                    if (!info.args.args_list.empty()) {
-                        pDelegate->onEvent(info.args.args_list[0].as_string());
-                    }
-                }
-            });
-    }
+        auto const pDispatchedDelegate = std::make_shared<DispatchedEventDelegate>(pDelegate, m_dispatcher.getQueue());
+        pSession->subscribe(topic, pDispatchedDelegate, pError);
 
-    void WampccMessaging::unsubscribe(const std::string &topic, IErrorDelegatePtr pError) /*override*/ {
         std::lock_guard<std::recursive_mutex> guard(m_mutex);
-
-        auto &session       = ensureValidSession();
-        auto subscriptionId = m_subscribedTopics[topic];
-        session.unsubscribe(subscriptionId,
-            [this, subscriptionId, topic, pWErrorDelegate = IErrorDelegateWPtr(pError)](wamp_session &, const unsubscribed_info &info) {
-                std::lock_guard<std::recursive_mutex> guard(m_mutex);
-
-                if (info.was_error) {
-                    auto const pErrorDelegate = pWErrorDelegate.lock();
-                    if (pErrorDelegate != nullptr)
-                        pErrorDelegate->onError("Unsubscription failed to: " + topic);
-                    return;
-                }
-                auto const itEventDelegate = m_eventDelegates.find(subscriptionId);
-                if (itEventDelegate != m_eventDelegates.cend())
-                    m_eventDelegates.erase(itEventDelegate);
-                auto const itSubscribedTopics = m_subscribedTopics.find(topic);
-                if (itSubscribedTopics != m_subscribedTopics.cend())
-                    m_subscribedTopics.erase(itSubscribedTopics);
-            });
+        m_subscribedTopics[topic] = pDispatchedDelegate;
     }
 
-    void WampccMessaging::publish(const std::string &topic, const std::string &argsSerialized, IErrorDelegatePtr pError) const
-    /*override*/ {
-        auto &session = ensureValidSession();
-        wamp_args wampArgs;
-        wampArgs.args_list.push_back(argsSerialized);
-
-        session.publish(topic, {}, wampArgs, [topic, pWErrorDelegate = IErrorDelegateWPtr(pError)](wamp_session &, published_info &info) {
-            if (info.was_error) {
-                auto const pErrorDelegate = pWErrorDelegate.lock();
-                if (pErrorDelegate != nullptr)
-                    pErrorDelegate->onError("Publishing failed for topic: " + topic);
+    void WampccMessaging::unsubscribe(const std::string &topic, IErrorDelegatePtr pError) /*override*/ {
+        auto const pSession = ensureSession();
+        IEventDelegatePtr pDelegate;
+        {
+            std::lock_guard<std::recursive_mutex> guard(m_mutex);
+            auto const itSubscribedTopic = m_subscribedTopics.find(topic);
+            if (itSubscribedTopic == m_subscribedTopics.cend()) {
+                if (pError != nullptr) {
+                    pError->onError("Unsubscription failed to: " + topic);
+                }
+                return;
             }
-        });
-    }
 
-    wampcc::wamp_session &WampccMessaging::ensureValidSession() const {
-        if (m_session && m_session->is_open()) {
-            return *m_session;
+            pDelegate = itSubscribedTopic->second;
+            m_subscribedTopics.erase(itSubscribedTopic);
         }
-        throw MessagingException("You have to connect to use the client");
-    }
 
-    bool WampccMessaging::tryConnect() {
-        try {
-            connect();
-        } catch (const MessagingException &) {
-            return false;
-        }
-
-        return true;
+        pSession->unsubscribe(topic, pDelegate, pError);
     }
 
-    void WampccMessaging::doDisconnect() {
-        if (m_session != nullptr && m_session->is_open()) {
-            m_bStopRetryConnection = true;
-            m_session->close().wait();
-        }
-
-        if (!m_bStopRetryConnection) {
-            {
-                std::lock_guard lock(m_mutConnection);
-                m_bStopRetryConnection = true;
-                m_cvConnection.notify_one();
-            }
-            m_futConnection.wait();
+    void WampccMessaging::publish(const std::string &topic, const std::string &argsSerialized, IErrorDelegatePtr pError) const
+    /*override*/ {
+        auto const pSession = ensureSession();
+        if (!m_batcher.publish(topic, argsSerialized, pError)) {
+            pSession->publish(topic, argsSerialized, pError);
         }
-
-        setStateDisconnected();
     }
 
-    void WampccMessaging::retryConnection() {
-        auto const guard = core::make_scope_exit([this]() { m_bStopRetryConnection = false; });
-        while (!m_bStopRetryConnection) {
-            std::unique_lock lock(m_mutConnection);
-            if (!m_cvConnection.wait_for(lock, s_timeoutRetryConnection, [this]() { return m_bStopRetryConnection; })) {
-                m_bStopRetryConnection = tryConnect();
-            }
-        }
+    void WampccMessaging::setPublishBatching(const PublishBatching &batching) /*override*/ {
+        m_batcher.setBatching(batching);
     }
 
-    bool WampccMessaging::isStateConnected() const {
-        switch (m_state) {
-        case States::Idle:
-        case States::Disconnected:
-        case States::DisconnectedCalling:
-            return false;
-        case States::Connected:
-        case States::ConnectedCalling:
-        case States::ConnectedCallingAbort:
-            return true;
-        }
+    void WampccMessaging::setPublishBatched(const std::string &topic, const bool bBatched) /*override*/ {
+        m_batcher.setBatched(topic, bBatched);
+    }
 
-        return false;
+    void WampccMessaging::flush() const /*override*/ {
+        m_batcher.flush();
     }
 
-    void WampccMessaging::setStateConnected() {
-        switch (m_state) {
-        case States::Idle:
-        case States::Disconnected:
-            m_state = States::Connected;
-            break;
-        case States::DisconnectedCalling:
-            m_state = States::ConnectedCallingAbort;
-            break;
-        case States::Connected:
-        case States::ConnectedCalling:
-        case States::ConnectedCallingAbort:
-            break; // no state change
+    void WampccMessaging::update(const core::Observable &, const MessagingConnectionMsg &msg) /*override*/ {
+        if (!msg.isConnected()) {
+            // the registrations and the subscriptions are cleared by the session
+            std::lock_guard<std::recursive_mutex> guard(m_mutex);
+            m_registeredCalls.clear();
+            m_subscribedTopics.clear();
         }
-        notify(MessagingConnectionMsg{ true });
-    }
 
-    bool WampccMessaging::isStateDisconnected() const {
-        return !isStateConnected() && m_state != States::Idle;
+        setState(msg.isConnected() ? States::Connected : States::Disconnected);
     }
 
-    void WampccMessaging::setStateDisconnected() {
-        switch (m_state) {
-        case States::Disconnected:
-        case States::DisconnectedCalling:
-            break; // no state change
-        case States::Idle:
-        case States::Connected:
-            m_state = States::Disconnected;
-            break;
-        case States::ConnectedCalling:
-        case States::ConnectedCallingAbort:
-            m_state = States::DisconnectedCalling;
-            break;
+    WampccSessionPtr WampccMessaging::ensureSession() const {
+        std::lock_guard<std::recursive_mutex> guard(m_mutex);
+        if (m_pSession == nullptr) {
+            throw MessagingException("You have to connect to use the client");
         }
 
-        m_registeredCalls.clear();
-        m_callDelegates.clear();
-        m_subscribedTopics.clear();
-        m_eventDelegates.clear();
-        notify(MessagingConnectionMsg{ false });
+        return m_pSession;
     }
 
-    bool WampccMessaging::isStateIdle() const {
-        return m_state == States::Idle;
+    void WampccMessaging::setState(const States state) {
+        // the state of the session is notified once, either by the session or by connect() / disconnect()
+        if (m_state.exchange(state) != state) {
+            notify(MessagingConnectionMsg{ state == States::Connected });
+        }
     }
 
 } // namespace NS_OSBASE::data::impl
@@ -1,17 +1,27 @@
 // \brief Declaration of a WAMP client using wampcc SOUP
 #pragma once
 
+#include "DelegateDispatcher.h"
+#include "PublishBatcher.h"
+#include "WampccSession.h"
 #include "osData/IMessaging.h"
 #include "osData/Uri.h"
-#include "wampcc/wampcc.h"
 
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 
 namespace NS_OSBASE::data::impl {
-    class WampccMessaging : public IMessaging {
+    /**
+     * \brief Messaging of a service, multiplexed on the WAMP session of the process (see WampccSession)
+     * \remark The calls registered and the topics subscribed by the messaging are released by disconnect(), the pending publications
+     * are sent.
+     * \remark The invocations and the events are run by the thread of the messaging (see DelegateDispatcher), never by the event thread
+     * of the session: a registered call may invoke a call of another messaging and wait for its result.
+     */
+    class WampccMessaging : public IMessaging, public core::Observer<IMessaging::MessagingConnectionMsg> {
     public:
-        WampccMessaging(const Uri &uri, const std::string &realm);
+        WampccMessaging(const Uri &uri, const std::string &realm, const ThreadSettings &threads);
         ~WampccMessaging() override;
 
         void connect() override;
@@ -25,42 +35,27 @@ namespace NS_OSBASE::data::impl {
         void subscribe(const std::string &topic, IEventDelegatePtr pDelegate, IErrorDelegatePtr pError) override;
         void unsubscribe(const std::string &topic, IErrorDelegatePtr pError) override;
         void publish(const std::string &topic, const std::string &argsSerialized, IErrorDelegatePtr pError) const override;
+        void setPublishBatching(const PublishBatching &batching) override;
+        void setPublishBatched(const std::string &topic, const bool bBatched) override;
+        void flush() const override;
 
-    private:
-        enum class States { Idle, Disconnected, DisconnectedCalling, Connected, ConnectedCalling, ConnectedCallingAbort };
-
-        bool tryConnect();
-        void doDisconnect();
-        wampcc::wamp_session &ensureValidSession() const;
-
-        void retryConnection();
-
-        bool isStateConnected() const;
-        void setStateConnected();
+        void update(const core::Observable &observable, const MessagingConnectionMsg &msg) override;
 
-        bool isStateDisconnected() const;
-        void setStateDisconnected();
+    private:
+        enum class States { Idle, Disconnected, Connected };
 
-        bool isStateIdle() const;
+        WampccSessionPtr ensureSession() const;
+        void setState(const States state);
 
         Uri m_uri;
         std::string m_realm;
-        wampcc::config m_wampccConf;
-        wampcc::kernel m_kernel;
-        std::unique_ptr<wampcc::tcp_socket> m_sock;
-        std::shared_ptr<wampcc::wamp_session> m_session;
+        ThreadSettings m_threads;
+        WampccSessionPtr m_pSession;
         mutable std::recursive_mutex m_mutex;
-        std::unordered_map<wampcc::t_subscription_id, IEventDelegateWPtr> m_eventDelegates;
-        std::unordered_map<std::string, wampcc::t_subscription_id> m_subscribedTopics;
-        std::unordered_map<wampcc::t_registration_id, ISupplierDelegateWPtr> m_callDelegates;
-        std::unordered_map<std::string, wampcc::t_registration_id> m_registeredCalls;
-
-        std::future<void> m_futConnection;
-        std::mutex m_mutConnection;
-        std::condition_variable m_cvConnection;
-        bool m_bStopRetryConnection = false;
-        States m_state              = States::Idle;
-
-        static constexpr auto s_timeoutRetryConnection = std::chrono::seconds(1);
+        std::unordered_map<std::string, ISupplierDelegatePtr> m_registeredCalls; // delegates given to the session: posted to the thread
+        std::unordered_map<std::string, IEventDelegatePtr> m_subscribedTopics;     // idem
+        std::atomic<States> m_state = States::Idle;
+        DelegateDispatcher m_dispatcher;
+        mutable PublishBatcher m_batcher; // last: its thread is stopped before the other members are destroyed
     };
 } // namespace NS_OSBASE::data::impl
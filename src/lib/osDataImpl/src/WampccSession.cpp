@@ -0,0 +1,573 @@
+// \brief Implementation of the WAMP session shared by the messagings of a process
+
+#include "WampccSession.h"
+#include "ThreadAffinity.h"
+#include "osCore/Misc/Scope.h"
+#include "osData/MessagingException.h"
+#include "osData/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace std::chrono_literals;
+using namespace wampcc;
+
+#define LOGIMPL(X, LEVEL)                                                                                                                  \
+    do {                                                                                                                                   \
+        if (__logger.wants_level && __logger.write && __logger.wants_level(LEVEL)) {                                                       \
+            std::ostringstream __xx_oss;                                                                                                   \
+            __xx_oss << X;                                                                                                                 \
+            __logger.write(LEVEL, __xx_oss.str(), __FILE__, __LINE__);                                                                     \
+        }                                                                                                                                  \
+    } while (false)
+
+#define LOG_INFO(X) LOGIMPL(X, wampcc::logger::eInfo)
+
+namespace NS_OSBASE::data::impl {
+
+    namespace {
+        // kwarg of an event carrying a batch of publications (see IMessaging::PublishBatching): without it, one publication
+        constexpr char s_batchKwarg[] = "osbase.batch";
+
+        wampcc::logger osLogger() {
+            logger logger_p;
+
+            const auto levelMask = logger::levels_upto(logger::eInfo);
+            logger_p.wants_level = [levelMask](logger::Level l) { return (l & levelMask) != 0; };
+
+            logger_p.write = [](logger::Level level, const std::string &msg, const char *, int) {
+                if ((TheLogger.getChannelMask() & OS_LOG_CHANNEL_DATA) == 0) {
+                    return;
+                }
+
+                if ((level & logger::eError) != 0) {
+                    ::oslog::error(OS_LOG_CHANNEL_DATA) << msg << ::oslog::end();
+                } else if ((level & logger::eWarn) != 0) {
+                    ::oslog::warning(OS_LOG_CHANNEL_DATA) << msg << ::oslog::end();
+                } else if ((level & logger::eInfo) != 0) {
+                    ::oslog::info(OS_LOG_CHANNEL_DATA) << msg << ::oslog::end();
+                }
+            };
+
+            return logger_p;
+        }
+
+        /*
+         * \class CallResult
+         */
+        class CallResult : public IMessaging::ICallResult {
+        public:
+            CallResult(std::weak_ptr<wamp_session> pSession, const t_request_id requestId)
+                : m_pSession(std::move(pSession)), m_requestId(requestId) {
+            }
+
+            ~CallResult() override {
+                fail("Error while calling procedure.");
+            }
+
+            void yield(const IMessaging::JsonText &json) override {
+                if (auto const pSession = takeSession(); pSession != nullptr) {
+                    pSession->yield(m_requestId, { json });
+                }
+            }
+
+            void fail(const std::string &error) override {
+                if (auto const pSession = takeSession(); pSession != nullptr) {
+                    pSession->invocation_error(m_requestId, error);
+                    oslog::error(OS_LOG_CHANNEL_DATA) << error << oslog::end();
+                }
+            }
+
+        private:
+            std::shared_ptr<wamp_session> takeSession() {
+                // only the first answer is sent, and only by the session of the invocation (not after a reconnection)
+                if (m_bAnswered.exchange(true)) {
+                    return nullptr;
+                }
+
+                auto const pSession = m_pSession.lock();
+                return pSession != nullptr && pSession->is_open() ? pSession : nullptr;
+            }
+
+            std::weak_ptr<wamp_session> m_pSession;
+            const t_request_id m_requestId;
+            std::atomic_bool m_bAnswered = false;
+        };
+    } // namespace
+
+    static auto const __logger = osLogger();
+
+    WampccSession::WampccSession(const Uri &uri, const std::string &realm, const ThreadSettings &threads) : m_uri(uri), m_realm(realm) {
+        for (unsigned short index = 0; index < std::max<unsigned short>(threads.nbIoThreads, 1); ++index) {
+            m_kernels.push_back(std::make_unique<kernel>(m_wampccConf, __logger));
+            setKernelAffinity(*m_kernels.back(), threads.cpus);
+        }
+    }
+
+    WampccSession::~WampccSession() /*override*/ {
+        if (!m_bStopRetryConnection) {
+            std::lock_guard lock(m_mutConnection);
+            m_bStopRetryConnection = true;
+            m_cvConnection.notify_one();
+        }
+
+        if (m_futConnection.valid()) {
+            if (m_futConnection.wait_for(s_timeoutRetryConnection * 2) != std::future_status::ready) {
+                std::cerr << "WampccSession::~WampccSession: fail to stop the reconnection thread!" << std::endl;
+            }
+        }
+
+        doDisconnect();
+    }
+
+    WampccSessionPtr WampccSession::getSession(const Uri &uri, const std::string &realm, const ThreadSettings &threads) {
+        static std::mutex mutex;
+        static std::unordered_map<std::string, std::weak_ptr<WampccSession>> sessions;
+
+        std::lock_guard lock(mutex);
+        auto &pWSession = sessions[type_cast<std::string>(uri) + "/" + realm];
+        auto pSession   = pWSession.lock();
+        if (pSession == nullptr) {
+            pSession  = std::make_shared<WampccSession>(uri, realm, threads);
+            pWSession = pSession;
+        }
+
+        return pSession;
+    }
+
+    void WampccSession::connect() {
+        std::lock_guard lock(m_mutConnect);
+        if (isStateConnected()) {
+            return;
+        }
+
+        if (isStateDisconnected()) {
+            // connection lost or failed: the reconnection thread notifies when the session is opened again
+            throw MessagingException("Could not connect to " + type_cast<std::string>(m_uri) + ", reconnection in progress");
+        }
+
+        doConnect();
+    }
+
+    bool WampccSession::isConnected() const {
+        return isStateConnected();
+    }
+
+    void WampccSession::registerCall(
+        const std::string &uri, IMessaging::ISupplierDelegatePtr pDelegate, IMessaging::IErrorDelegatePtr pError) {
+        std::lock_guard<std::recursive_mutex> guard(m_mutex);
+
+        if (m_registeredCalls.find(uri) != m_registeredCalls.end())
+            throw MessagingException("The uri " + uri + " has already been registered");
+        auto const pSession = ensureValidSession(uri);
+        pSession->provide(
+            uri,
+            {},
+            [this, pDelegate, uri, pwErrorDelegate = IMessaging::IErrorDelegateWPtr(pError)](wamp_session &, const registered_info &info) {
+                std::lock_guard<std::recursive_mutex> guard(m_mutex);
+
+                if (info.was_error) {
+                    auto const pErrorDelegate = pwErrorDelegate.lock();
+                    if (pErrorDelegate != nullptr)
+                        pErrorDelegate->onError("Procedure registration failed, error " + info.error_uri);
+                    return;
+                }
+
+                LOG_INFO("Procedure registered with id: " << info.registration_id);
+                m_callDelegates.insert(info.registration_id, pDelegate);
+                m_registeredCalls[uri] = info.registration_id;
+            },
+            [this](wamp_session &ws, invocation_info info) {
+                // looked up without the lock: the invocations don't wait for the (un)registrations, nor for the events
+                IMessaging::ISupplierDelegatePtr pDelegate;
+                if (auto const pWDelegate = m_callDelegates.find(info.registration_id); pWDelegate.has_value()) {
+                    pDelegate = pWDelegate->lock();
+                }
+                std::weak_ptr<wamp_session> const pSession = findSession(ws);
+
+                if (pDelegate == nullptr || info.args.args_list.size() > 1) {
+                    ws.invocation_error(info.request_id, "Error while calling procedure.");
+                    return;
+                }
+
+                // called without the lock, posted to the thread of the messaging (see WampccMessaging): a call (or its result sent later
+                // by another thread) doesn't block the other messages
+                pDelegate->onCallAsync(info.args.args_list.empty() ? "" : info.args.args_list[0].as_string(),
+                    std::make_shared<CallResult>(pSession, info.request_id));
+            });
+    }
+
+    void WampccSession::unregisterCall(const std::string &uri, IMessaging::IErrorDelegatePtr pError) {
+        std::lock_guard<std::recursive_mutex> guard(m_mutex);
+
+        auto const pSession = ensureValidSession(uri);
+        if (m_registeredCalls.find(uri) == m_registeredCalls.end()) {
+            throw MessagingException("No procedure registered with name " + uri);
+        }
+        auto registration_id = m_registeredCalls[uri];
+        pSession->unprovide(registration_id,
+            [this, registration_id, uri, pwErrorDelegate = IMessaging::IErrorDelegateWPtr(pError)](wamp_session &, unregistered_info info) {
+                std::lock_guard<std::recursive_mutex> guard(m_mutex);
+
+                if (info.was_error) {
+                    auto const pErrorDelegate = pwErrorDelegate.lock();
+                    if (pErrorDelegate != nullptr)
+                        pErrorDelegate->onError("Unregister error for " + uri);
+                    return;
+                }
+                m_callDelegates.erase(registration_id);
+                auto const itRegisteredCalls = m_registeredCalls.find(uri);
+                if (itRegisteredCalls != m_registeredCalls.end()) {
+                    m_registeredCalls.erase(itRegisteredCalls);
+                }
+            });
+    }
+
+    void WampccSession::invoke(const std::string &uri,
+        const std::string &argsSerialized,
+        IMessaging::IClientDelegatePtr pDelegate,
+        IMessaging::IErrorDelegatePtr pError) const {
+        std::lock_guard<std::recursive_mutex> guard(m_mutex);
+
+        auto const pSession = ensureValidSession(uri);
+        wamp_args wampArgs;
+        wampArgs.args_list.push_back(argsSerialized);
+
+        pSession->call(uri,
+            {},
+            wampArgs,
+            [pWDelegate = IMessaging::IClientDelegateWPtr(pDelegate), pWErrorDelegate = IMessaging::IErrorDelegateWPtr(pError)](
+                wamp_session &, wampcc::result_info info) {
+                if ((info.was_error || info.args.args_list.empty())) {
+                    std::string strError;
+                    if (info.was_error) {
+                        strError = "There was an error when invoking: " + info.error_uri;
+                    } else if (info.args.args_list.empty()) {
+                        strError = "No result received from remote call.";
+                    }
+
+                    if (auto const pErrorDelegate = pWErrorDelegate.lock(); pErrorDelegate != nullptr) {
+                        pErrorDelegate->onError(strError);
+                    }
+                    return;
+                }
+
+                auto const pClientDelegate = pWDelegate.lock();
+                if (pClientDelegate != nullptr) {
+                    pClientDelegate->onResult(info.args.args_list[0].as_string());
+                }
+            });
+    }
+
+    void WampccSession::subscribe(const std::string &topic, IMessaging::IEventDelegatePtr pDelegate, IMessaging::IErrorDelegatePtr pError) {
+        std::lock_guard<std::recursive_mutex> guard(m_mutex);
+
+        auto const pSession = ensureValidSession(topic);
+        if (auto const itSubscribedTopic = m_subscribedTopics.find(topic); itSubscribedTopic != m_subscribedTopics.cend()) {
+            // already subscribed to the broker (or pending): only the delegate is added
+            auto const pSubscription = itSubscribedTopic->second;
+            auto subscribers         = *pSubscription->getSubscribers();
+            subscribers.push_back({ pDelegate, pError });
+            pSubscription->setSubscribers(std::move(subscribers));
+            return;
+        }
+
+        auto const pSubscription = std::make_shared<Subscription>();
+        pSubscription->setSubscribers({ { pDelegate, pError } });
+        m_subscribedTopics[topic] = pSubscription;
+
+        pSession->subscribe(
+            topic,
+            {},
+            [topic, this, pSubscription](wamp_session &ws, const subscribed_info &info) {
+                std::lock_guard<std::recursive_mutex> guard(m_mutex);
+
+                auto const itSubscribedTopic = m_subscribedTopics.find(topic);
+                auto const bCurrent          = itSubscribedTopic != m_subscribedTopics.cend() && itSubscribedTopic->second == pSubscription;
+                if (info.was_error) {
+                    if (bCurrent) {
+                        m_subscribedTopics.erase(itSubscribedTopic);
+                    }
+
+                    auto const pSubscribers = pSubscription->getSubscribers();
+                    for (auto const &subscriber : *pSubscribers) {
+                        if (auto const pErrorDelegate = subscriber.pErrorDelegate.lock(); pErrorDelegate != nullptr) {
+                            pErrorDelegate->onError("There was an issue subscribing the topic: " + topic);
+                        }
+                    }
+                    return;
+                }
+
+                if (!bCurrent || pSubscription->getSubscribers()->empty()) {
+                    // all the delegates unsubscribed meanwhile
+                    if (bCurrent) {
+                        m_subscribedTopics.erase(itSubscribedTopic);
+                    }
+                    ws.unsubscribe(info.subscription_id, [](wamp_session &, const unsubscribed_info &) {});
+                    return;
+                }
+
+                pSubscription->subscriptionId = info.subscription_id;
+                m_subscriptions.insert(info.subscription_id, pSubscription);
+            },
+            [this](wamp_session &, event_info info) {
+                if (info.args.args_list.empty()) {
+                    return;
+                }
+
+                // looked up in the snapshots, without lock: the events don't wait for the (un)subscriptions nor for the calls, and
+                // a delegate may (un)subscribe while dispatched
+                auto const pSubscription = m_subscriptions.find(info.subscription_id);
+                if (!pSubscription.has_value()) {
+                    return;
+                }
+
+                // a batch of publications is marked: its arguments are dispatched in order, otherwise the first one only (the event of
+                // another publisher may have more)
+                auto const itBatch      = info.args.args_dict.find(s_batchKwarg);
+                auto const bBatch       = itBatch != info.args.args_dict.cend() && itBatch->second.is_bool() && itBatch->second.as_bool();
+                auto const nbArgs       = bBatch ? info.args.args_list.size() : 1;
+                auto const pSubscribers = pSubscription.value()->getSubscribers();
+                for (size_t index = 0; index < nbArgs; ++index) {
+                    auto const json = info.args.args_list[index].as_string();
+                    for (auto const &subscriber : *pSubscribers) {
+                        if (auto const pDelegate = subscriber.pDelegate.lock(); pDelegate != nullptr) {
+                            pDelegate->onEvent(json);
+                        }
+                    }
+                }
+            });
+    }
+
+    void WampccSession::unsubscribe(
+        const std::string &topic, IMessaging::IEventDelegatePtr pDelegate, IMessaging::IErrorDelegatePtr pError) {
+        std::lock_guard<std::recursive_mutex> guard(m_mutex);
+
+        auto const pSession          = ensureValidSession(topic);
+        auto const itSubscribedTopic = m_subscribedTopics.find(topic);
+        if (itSubscribedTopic == m_subscribedTopics.cend()) {
+            if (pError != nullptr) {
+                pError->onError("Unsubscription failed to: " + topic);
+            }
+            return;
+        }
+
+        auto const pSubscription = itSubscribedTopic->second;
+        auto subscribers         = *pSubscription->getSubscribers();
+        subscribers.erase(std::remove_if(subscribers.begin(),
+                              subscribers.end(),
+                              [&pDelegate](const Subscriber &subscriber) {
+                                  auto const pSubscribedDelegate = subscriber.pDelegate.lock();
+                                  return pSubscribedDelegate == nullptr || pSubscribedDelegate == pDelegate;
+                              }),
+            subscribers.end());
+        auto const bEmpty = subscribers.empty();
+        pSubscription->setSubscribers(std::move(subscribers));
+
+        if (!bEmpty || !pSubscription->subscriptionId.has_value()) {
+            return; // still used by other delegates, or unsubscribed from the broker when the subscription is acknowledged
+        }
+
+        auto const subscriptionId = pSubscription->subscriptionId.value();
+        m_subscribedTopics.erase(itSubscribedTopic);
+        m_subscriptions.erase(subscriptionId);
+        pSession->unsubscribe(subscriptionId,
+            [topic, pWErrorDelegate = IMessaging::IErrorDelegateWPtr(pError)](wamp_session &, const unsubscribed_info &info) {
+                if (info.was_error) {
+                    auto const pErrorDelegate = pWErrorDelegate.lock();
+                    if (pErrorDelegate != nullptr)
+                        pErrorDelegate->onError("Unsubscription failed to: " + topic);
+                }
+            });
+    }
+
+    void WampccSession::publish(const std::string &topic, const std::string &argsSerialized, IMessaging::IErrorDelegatePtr pError) const {
+        publish(topic, std::vector<std::string>{ argsSerialized }, ErrorDelegates{ pError });
+    }
+
+    void WampccSession::publish(
+        const std::string &topic, const std::vector<std::string> &argsSerialized, const ErrorDelegates &pErrors) const {
+        std::lock_guard<std::recursive_mutex> guard(m_mutex);
+
+        auto const pSession = ensureValidSession(topic);
+        wamp_args wampArgs;
+        for (auto const &args : argsSerialized) {
+            wampArgs.args_list.push_back(args);
+        }
+        if (argsSerialized.size() > 1) {
+            wampArgs.args_dict[s_batchKwarg] = json_value::make_bool(true); // a single publication stays a plain event
+        }
+
+        // the subscribers of the process share the session of the publisher: it must not be excluded of the receivers
+        pSession->publish(topic,
+            { { "exclude_me", json_value::make_bool(false) } },
+            wampArgs,
+            [topic, pErrors](wamp_session &, published_info &info) {
+                if (info.was_error) {
+                    for (auto const &pWErrorDelegate : pErrors) {
+                        auto const pErrorDelegate = pWErrorDelegate.lock();
+                        if (pErrorDelegate != nullptr)
+                            pErrorDelegate->onError("Publishing failed for topic: " + topic);
+                    }
+                }
+            });
+    }
+
+    void WampccSession::doConnect() {
+        static constexpr auto helloTimeout = 4s;
+
+        if (!m_uri.isValid() || !m_uri.authority.has_value() || !m_uri.authority.value().port.has_value()) {
+            throw MessagingException("uri invalid: " + type_cast<std::string>(m_uri));
+        }
+        if (m_uri.scheme != Uri::schemeWebsocket() && m_uri.scheme != Uri::schemeRawSocket()) {
+            throw MessagingException("scheme not supported: " + type_cast<std::string>(m_uri));
+        }
+
+        closeSessions(); // the connections still opened when another one has been lost
+
+        WampSessions sessions;
+        for (auto const &pKernel : m_kernels) {
+            auto sock                  = std::make_unique<wampcc::tcp_socket>(pKernel.get());
+            const auto connectionError = sock->connect(m_uri.authority.value().host, m_uri.authority->port.value()).get();
+            if (connectionError != 0) {
+                for (auto const &pSession : sessions) {
+                    pSession->close().wait();
+                }
+                if (isStateConnected() || isStateIdle()) {
+                    setStateDisconnected();
+                    m_futConnection = std::async([this]() { retryConnection(); });
+                }
+                throw MessagingException("Could not connect to socket " + std::string(connectionError.message()));
+            }
+
+            auto const onStateChanged = [this](wamp_session &, bool is_open) {
+                // the loss of a connection disconnects the session, once for all its connections
+                auto state = States::Connected;
+                if (!is_open && m_state.compare_exchange_strong(state, States::Disconnected)) {
+                    setStateDisconnected();
+                    m_futConnection = std::async([this]() { retryConnection(); });
+                }
+            };
+            // RawSocket: no HTTP upgrade nor WebSocket framing, for the services (the browsers need WebSocket)
+            sessions.push_back(m_uri.scheme == Uri::schemeRawSocket()
+                                   ? wamp_session::create<rawsocket_protocol>(pKernel.get(), std::move(sock), onStateChanged)
+                                   : wamp_session::create<websocket_protocol>(pKernel.get(), std::move(sock), onStateChanged));
+        }
+
+        auto const pSessions = std::make_shared<const WampSessions>(std::move(sessions));
+        {
+            std::lock_guard<std::recursive_mutex> guard(m_mutex);
+            std::atomic_store(&m_pSessions, pSessions);
+        }
+
+        for (auto const &pSession : *pSessions) {
+            if (pSession->hello(m_realm).wait_for(helloTimeout) != std::future_status::ready) {
+                throw MessagingException("Realm logon failed");
+            }
+            if (!pSession->is_open()) {
+                throw MessagingException("Realm logon failed");
+            }
+        }
+
+        setStateConnected();
+    }
+
+    WampccSession::WampSessionPtr WampccSession::ensureValidSession(const std::string &uri) const {
+        auto const pSessions = std::atomic_load(&m_pSessions);
+        if (!pSessions->empty()) {
+            auto const &pSession = (*pSessions)[std::hash<std::string>{}(uri) % pSessions->size()];
+            if (pSession->is_open()) {
+                return pSession;
+            }
+        }
+        throw MessagingException("You have to connect to use the client");
+    }
+
+    WampccSession::WampSessionPtr WampccSession::findSession(const wampcc::wamp_session &session) const {
+        auto const pSessions = std::atomic_load(&m_pSessions);
+        auto const itSession = std::find_if(
+            pSessions->cbegin(), pSessions->cend(), [&session](const WampSessionPtr &pSession) { return pSession.get() == &session; });
+        return itSession != pSessions->cend() ? *itSession : nullptr;
+    }
+
+    void WampccSession::closeSessions() {
+        for (auto const &pSession : *std::atomic_load(&m_pSessions)) {
+            if (pSession->is_open()) {
+                pSession->close().wait();
+            }
+        }
+    }
+
+    bool WampccSession::tryConnect() {
+        try {
+            std::lock_guard lock(m_mutConnect);
+            doConnect();
+        } catch (const MessagingException &) {
+            return false;
+        }
+
+        return true;
+    }
+
+    void WampccSession::doDisconnect() {
+        auto const pSessions = std::atomic_load(&m_pSessions);
+        if (std::any_of(pSessions->cbegin(), pSessions->cend(), [](const WampSessionPtr &pSession) { return pSession->is_open(); })) {
+            m_bStopRetryConnection = true;
+            closeSessions();
+        }
+
+        if (!m_bStopRetryConnection) {
+            {
+                std::lock_guard lock(m_mutConnection);
+                m_bStopRetryConnection = true;
+                m_cvConnection.notify_one();
+            }
+            m_futConnection.wait();
+        }
+
+        setStateDisconnected();
+    }
+
+    void WampccSession::retryConnection() {
+        auto const guard = core::make_scope_exit([this]() { m_bStopRetryConnection = false; });
+        while (!m_bStopRetryConnection) {
+            std::unique_lock lock(m_mutConnection);
+            if (!m_cvConnection.wait_for(lock, s_timeoutRetryConnection, [this]() { return m_bStopRetryConnection; })) {
+                m_bStopRetryConnection = tryConnect();
+            }
+        }
+    }
+
+    bool WampccSession::isStateConnected() const {
+        return m_state == States::Connected;
+    }
+
+    void WampccSession::setStateConnected() {
+        m_state = States::Connected;
+        notify(IMessaging::MessagingConnectionMsg{ true });
+    }
+
+    bool WampccSession::isStateDisconnected() const {
+        return !isStateConnected() && m_state != States::Idle;
+    }
+
+    void WampccSession::setStateDisconnected() {
+        m_state = States::Disconnected;
+
+        {
+            std::lock_guard<std::recursive_mutex> guard(m_mutex);
+            m_registeredCalls.clear();
+            m_callDelegates.clear();
+            m_subscribedTopics.clear();
+            m_subscriptions.clear();
+        }
+        notify(IMessaging::MessagingConnectionMsg{ false });
+    }
+
+    bool WampccSession::isStateIdle() const {
+        return m_state == States::Idle;
+    }
+
+} // namespace NS_OSBASE::data::impl
@@ -0,0 +1,135 @@
+// \brief Declaration of the WAMP session shared by the messagings of a process
+#pragma once
+
+#include "osData/IMessaging.h"
+#include "osData/ThreadSettings.h"
+#include "osData/Uri.h"
+#include "SnapshotMap.h"
+#include "wampcc/wampcc.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace NS_OSBASE::data::impl {
+    class WampccSession;
+    using WampccSessionPtr = std::shared_ptr<WampccSession>;
+
+    /**
+     * \brief WAMP session (kernel, socket, reconnection) shared by all the messagings of the process connected to the same broker and
+     * realm
+     *
+     * The registrations and the subscriptions of the messagings are managed here: a topic is subscribed once to the broker and its
+     * events are dispatched to all the subscribed delegates. The session is closed when the last messaging releases it.\n
+     * The delegates of the invocations and of the events are looked up in snapshots, without lock: the dispatch is not serialized
+     * behind the (un)registrations, nor behind the other calls and events. The delegates of the messagings only post the invocations and
+     * the events to the thread of their messaging (see DelegateDispatcher): no user code runs on the event thread of a kernel, which
+     * receives the results the delegates may wait for.\n
+     * The session opens a connection per IO thread (see ThreadSettings): a call uri or a topic is bound to one of them.\n
+     * The changes of the connection state are notified by the message IMessaging::MessagingConnectionMsg.
+     */
+    class WampccSession : public core::Observable {
+    public:
+        WampccSession(const Uri &uri, const std::string &realm, const ThreadSettings &threads);
+        ~WampccSession() override;
+
+        /**
+         * \brief Return the session of the process connected to the broker and the realm, created with the threads if none
+         */
+        static WampccSessionPtr getSession(const Uri &uri, const std::string &realm, const ThreadSettings &threads);
+
+        /**
+         * \brief Open the session if not already opened
+         * \throws MessagingException if the connection failed: the connection is then retried in background
+         */
+        void connect();
+        bool isConnected() const;
+
+        void registerCall(const std::string &uri, IMessaging::ISupplierDelegatePtr pDelegate, IMessaging::IErrorDelegatePtr pError);
+        void unregisterCall(const std::string &uri, IMessaging::IErrorDelegatePtr pError);
+        void invoke(const std::string &uri,
+            const std::string &argsSerialized,
+            IMessaging::IClientDelegatePtr pDelegate,
+            IMessaging::IErrorDelegatePtr pError) const;
+        void subscribe(const std::string &topic, IMessaging::IEventDelegatePtr pDelegate, IMessaging::IErrorDelegatePtr pError);
+        void unsubscribe(const std::string &topic, IMessaging::IEventDelegatePtr pDelegate, IMessaging::IErrorDelegatePtr pError);
+        void publish(const std::string &topic, const std::string &argsSerialized, IMessaging::IErrorDelegatePtr pError) const;
+
+        using ErrorDelegates = std::vector<IMessaging::IErrorDelegateWPtr>;
+
+        /**
+         * \brief Publish a batch of publications of a topic in one message (marked as a batch beyond one), received in order
+         * \remark A failure is reported to all the error delegates of the batch.
+         */
+        void publish(const std::string &topic, const std::vector<std::string> &argsSerialized, const ErrorDelegates &pErrors) const;
+
+    private:
+        enum class States { Idle, Disconnected, Connected };
+
+        struct Subscriber {
+            IMessaging::IEventDelegateWPtr pDelegate;
+            IMessaging::IErrorDelegateWPtr pErrorDelegate;
+        };
+
+        using Subscribers    = std::vector<Subscriber>;
+        using SubscribersPtr = std::shared_ptr<const Subscribers>;
+
+        struct Subscription {
+            SubscribersPtr getSubscribers() const {
+                return std::atomic_load(&pSubscribers);
+            }
+
+            void setSubscribers(Subscribers subscribers) { // under the lock of the session
+                std::atomic_store(&pSubscribers, SubscribersPtr(std::make_shared<const Subscribers>(std::move(subscribers))));
+            }
+
+            SubscribersPtr pSubscribers = std::make_shared<const Subscribers>(); // snapshot read by the events
+            std::optional<wampcc::t_subscription_id> subscriptionId;             // set when acknowledged by the broker
+        };
+        using SubscriptionPtr = std::shared_ptr<Subscription>;
+
+        using WampSessionPtr = std::shared_ptr<wampcc::wamp_session>;
+        using WampSessions   = std::vector<WampSessionPtr>;
+
+        void doConnect();
+        bool tryConnect();
+        void doDisconnect();
+        WampSessionPtr ensureValidSession(const std::string &uri) const; // connection of a call uri or of a topic
+        WampSessionPtr findSession(const wampcc::wamp_session &session) const;
+        void closeSessions();
+
+        void retryConnection();
+
+        bool isStateConnected() const;
+        void setStateConnected();
+
+        bool isStateDisconnected() const;
+        void setStateDisconnected();
+
+        bool isStateIdle() const;
+
+        Uri m_uri;
+        std::string m_realm;
+        wampcc::config m_wampccConf;
+        std::vector<std::unique_ptr<wampcc::kernel>> m_kernels;                                   // one per IO thread
+        std::shared_ptr<const WampSessions> m_pSessions = std::make_shared<const WampSessions>(); // one per kernel, once connected
+        mutable std::recursive_mutex m_mutex; // (un)registrations and (un)subscriptions
+        std::unordered_map<std::string, SubscriptionPtr> m_subscribedTopics;
+        std::unordered_map<std::string, wampcc::t_registration_id> m_registeredCalls;
+        SnapshotMap<wampcc::t_subscription_id, SubscriptionPtr> m_subscriptions;                   // read by the events
+        SnapshotMap<wampcc::t_registration_id, IMessaging::ISupplierDelegateWPtr> m_callDelegates; // read by the invocations
+
+        std::mutex m_mutConnect;
+        std::future<void> m_futConnection;
+        std::mutex m_mutConnection;
+        std::condition_variable m_cvConnection;
+        bool m_bStopRetryConnection = false;
+        std::atomic<States> m_state = States::Idle;
+
+        static constexpr auto s_timeoutRetryConnection = std::chrono::seconds(1);
+    };
+} // namespace NS_OSBASE::data::impl
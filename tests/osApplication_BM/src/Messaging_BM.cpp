@@ -0,0 +1,327 @@
+#include "Server.h"
+#include "osCore/Misc/Scope.h"
+#include "osData/IMessaging.h"
+#include "benchmark/benchmark.h"
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace NS_OSBASE::application::bm {
+
+    /*
+     * \class Messaging_Contention_BM
+     * Dispatch of the events of many topics while calls are answered by the same session: range(0) topics, range(1) caller threads
+     */
+    class Messaging_Contention_BM : public benchmark::Fixture {
+    public:
+        void SetUp(const benchmark::State &state) override {
+            m_pCounter     = std::make_shared<Counter>();
+            m_pCallCounter = std::make_shared<Counter>();
+            m_pMessaging   = data::makeWampMessaging(getUri(), "");
+            m_pMessaging->connect();
+            m_pMessaging->registerCall(s_echoUri, m_pEcho, nullptr);
+
+            for (size_t index = 0; index < static_cast<size_t>(state.range(0)); ++index) {
+                m_pMessaging->subscribe(getTopic(index), m_pCounter, nullptr);
+            }
+            std::this_thread::sleep_for(100ms); // subscriptions acknowledged
+
+            m_bStop = false;
+            for (size_t index = 0; index < static_cast<size_t>(state.range(1)); ++index) {
+                m_callers.emplace_back([this]() {
+                    while (!m_bStop) {
+                        m_pMessaging->invoke(s_echoUri, "args", m_pCallCounter, nullptr);
+                        std::this_thread::yield();
+                    }
+                });
+            }
+        }
+
+        void TearDown(const benchmark::State &state) override {
+            m_bStop = true;
+            for (auto &caller : m_callers) {
+                caller.join();
+            }
+            m_callers.clear();
+
+            for (size_t index = 0; index < static_cast<size_t>(state.range(0)); ++index) {
+                m_pMessaging->unsubscribe(getTopic(index), nullptr);
+            }
+            m_pMessaging->unregisterCall(s_echoUri, nullptr);
+            m_pMessaging->disconnect();
+        }
+
+        void publishAll(const benchmark::State &state) {
+            for (size_t index = 0; index < static_cast<size_t>(state.range(0)); ++index) {
+                m_pMessaging->publish(getTopic(index), "args", nullptr);
+            }
+        }
+
+        bool waitForEvents(const size_t nbEvents, const std::chrono::milliseconds &timeout = 1000ms) {
+            return m_pCounter->wait(nbEvents, timeout);
+        }
+
+        size_t getNbCalls() const {
+            return m_pCallCounter->getNbMessages();
+        }
+
+    private:
+        class Counter : public data::IMessaging::IEventDelegate, public data::IMessaging::IClientDelegate {
+        public:
+            void onEvent(const data::IMessaging::JsonText &) override {
+                count();
+            }
+
+            void onResult(const data::IMessaging::JsonText &) override {
+                count();
+            }
+
+            bool wait(const size_t nbMessages, const std::chrono::milliseconds &timeout) {
+                std::unique_lock lock(m_mut);
+                auto const guard = core::make_scope_exit([this]() { m_nbMessages = 0; });
+                return m_cv.wait_for(lock, timeout, [this, nbMessages]() { return m_nbMessages >= nbMessages; });
+            }
+
+            size_t getNbMessages() const {
+                std::lock_guard lock(m_mut);
+                return m_nbMessages;
+            }
+
+        private:
+            void count() {
+                std::lock_guard lock(m_mut);
+                ++m_nbMessages;
+                m_cv.notify_one();
+            }
+
+            mutable std::mutex m_mut;
+            std::condition_variable m_cv;
+            size_t m_nbMessages = 0;
+        };
+        using CounterPtr = std::shared_ptr<Counter>;
+
+        class Echo : public data::IMessaging::ISupplierDelegate {
+        public:
+            std::string onCall(const data::IMessaging::JsonText &json) override {
+                return json;
+            }
+        };
+
+        static data::Uri getUri() {
+            return std::string{ "ws://" + TheServer.getBrokerUrl() + ":" + std::to_string(TheServer.getBrokerPort()) };
+        }
+
+        static std::string getTopic(const size_t index) {
+            return "Messaging_Contention_BM.topic" + std::to_string(index);
+        }
+
+        inline static const std::string s_echoUri = "Messaging_Contention_BM.echo";
+
+        data::IMessagingPtr m_pMessaging;
+        CounterPtr m_pCounter;
+        CounterPtr m_pCallCounter;
+        data::IMessaging::ISupplierDelegatePtr m_pEcho = std::make_shared<Echo>();
+        std::atomic_bool m_bStop = false;
+        std::vector<std::thread> m_callers;
+    };
+
+    BENCHMARK_DEFINE_F(Messaging_Contention_BM, eventsDuringCalls)(benchmark::State &state) {
+        for (auto _ : state) {
+            publishAll(state);
+            if (!waitForEvents(static_cast<size_t>(state.range(0)))) {
+                state.SkipWithError("events not received");
+                break;
+            }
+        }
+
+        auto const nbEvents      = static_cast<double>(state.iterations() * state.range(0));
+        state.counters["events"] = benchmark::Counter(nbEvents, benchmark::Counter::kIsRate);
+        state.counters["calls"]  = benchmark::Counter(static_cast<double>(getNbCalls()), benchmark::Counter::kIsRate);
+    }
+    BENCHMARK_REGISTER_F(Messaging_Contention_BM, eventsDuringCalls)
+        ->ArgsProduct({ { 1, 10, 100 }, { 0, 1, 4 } })
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+
+    /*
+     * \class Messaging_Scaling_BM
+     * Calls of concurrent clients through a session spread over range(0) IO threads, range(1) client threads.
+     * The broker keeps one IO thread: each IO thread of the session is one more session on it (see ThreadSettings).
+     */
+    class Messaging_Scaling_BM : public benchmark::Fixture {
+    public:
+        void SetUp(const benchmark::State &state) override {
+            // a realm per configuration: the threads are set by the first messaging of a session
+            auto const nbIoThreads = static_cast<unsigned short>(state.range(0));
+            auto const realm       = "bm_scaling_" + std::to_string(nbIoThreads);
+            m_pMessaging           = data::makeWampMessaging(getUri(), realm, data::ThreadSettings{ nbIoThreads, {} });
+            m_pMessaging->connect();
+            for (size_t index = 0; index < s_nbUris; ++index) {
+                m_pMessaging->registerCall(getCallUri(index), m_pEcho, nullptr);
+            }
+            std::this_thread::sleep_for(100ms); // registrations acknowledged
+        }
+
+        void TearDown(const benchmark::State &) override {
+            m_pMessaging->disconnect();
+        }
+
+        bool callAll(const size_t nbClients) {
+            std::vector<std::future<bool>> futClients;
+            for (size_t client = 0; client < nbClients; ++client) {
+                futClients.push_back(std::async(std::launch::async, [this, client]() {
+                    auto const pResults = std::make_shared<Results>();
+                    for (size_t call = 0; call < s_nbCallsPerClient; ++call) {
+                        m_pMessaging->invoke(getCallUri((client + call) % s_nbUris), "args", pResults, nullptr);
+                    }
+                    return pResults->wait(s_nbCallsPerClient, 5s);
+                }));
+            }
+
+            auto bReceived = true;
+            for (auto &futClient : futClients) {
+                bReceived = futClient.get() && bReceived;
+            }
+            return bReceived;
+        }
+
+        static constexpr size_t s_nbCallsPerClient = 100;
+
+    private:
+        class Results : public data::IMessaging::IClientDelegate {
+        public:
+            void onResult(const data::IMessaging::JsonText &) override {
+                std::lock_guard lock(m_mut);
+                ++m_nbResults;
+                m_cv.notify_one();
+            }
+
+            bool wait(const size_t nbResults, const std::chrono::milliseconds &timeout) {
+                std::unique_lock lock(m_mut);
+                return m_cv.wait_for(lock, timeout, [this, nbResults]() { return m_nbResults >= nbResults; });
+            }
+
+        private:
+            std::mutex m_mut;
+            std::condition_variable m_cv;
+            size_t m_nbResults = 0;
+        };
+
+        class Echo : public data::IMessaging::ISupplierDelegate {
+        public:
+            std::string onCall(const data::IMessaging::JsonText &json) override {
+                return json;
+            }
+        };
+
+        static data::Uri getUri() {
+            return std::string{ "ws://" + TheServer.getBrokerUrl() + ":" + std::to_string(TheServer.getBrokerPort()) };
+        }
+
+        static std::string getCallUri(const size_t index) {
+            return "Messaging_Scaling_BM.echo" + std::to_string(index);
+        }
+
+        static constexpr size_t s_nbUris = 16; // spread over the connections of the session
+
+        data::IMessagingPtr m_pMessaging;
+        data::IMessaging::ISupplierDelegatePtr m_pEcho = std::make_shared<Echo>();
+    };
+
+    BENCHMARK_DEFINE_F(Messaging_Scaling_BM, concurrentClients)(benchmark::State &state) {
+        auto const nbClients = static_cast<size_t>(state.range(1));
+        for (auto _ : state) {
+            if (!callAll(nbClients)) {
+                state.SkipWithError("results not received");
+                break;
+            }
+        }
+
+        auto const nbCalls      = static_cast<double>(state.iterations() * nbClients * s_nbCallsPerClient);
+        state.counters["calls"] = benchmark::Counter(nbCalls, benchmark::Counter::kIsRate);
+    }
+    BENCHMARK_REGISTER_F(Messaging_Scaling_BM, concurrentClients)
+        ->ArgsProduct({ { 1, 2, 4, 8 }, { 1, 4, 16, 32 } })
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+    /*
+     * \class Messaging_Batching_BM
+     * Burst of range(1) publications of a topic, batched within a window of range(0) ms (0: not batched)
+     */
+    class Messaging_Batching_BM : public benchmark::Fixture {
+    public:
+        void SetUp(const benchmark::State &state) override {
+            m_pMessaging = data::makeWampMessaging(getUri(), "");
+            m_pMessaging->connect();
+            m_pMessaging->setPublishBatching(data::IMessaging::PublishBatching{ std::chrono::milliseconds(state.range(0)), 0 });
+            m_pMessaging->setPublishBatched(s_topic, true);
+            m_pMessaging->subscribe(s_topic, m_pCounter, nullptr);
+            std::this_thread::sleep_for(100ms); // subscription acknowledged
+        }
+
+        void TearDown(const benchmark::State &) override {
+            m_pMessaging->unsubscribe(s_topic, nullptr);
+            m_pMessaging->disconnect();
+        }
+
+        bool publishAll(const size_t nbEvents) {
+            for (size_t index = 0; index < nbEvents; ++index) {
+                m_pMessaging->publish(s_topic, "args", nullptr);
+            }
+            m_pMessaging->flush();
+            return m_pCounter->wait(nbEvents, 5s);
+        }
+
+    private:
+        class Counter : public data::IMessaging::IEventDelegate {
+        public:
+            void onEvent(const data::IMessaging::JsonText &) override {
+                std::lock_guard lock(m_mut);
+                ++m_nbEvents;
+                m_cv.notify_one();
+            }
+
+            bool wait(const size_t nbEvents, const std::chrono::milliseconds &timeout) {
+                std::unique_lock lock(m_mut);
+                auto const guard = core::make_scope_exit([this]() { m_nbEvents = 0; });
+                return m_cv.wait_for(lock, timeout, [this, nbEvents]() { return m_nbEvents >= nbEvents; });
+            }
+
+        private:
+            std::mutex m_mut;
+            std::condition_variable m_cv;
+            size_t m_nbEvents = 0;
+        };
+
+        static data::Uri getUri() {
+            return std::string{ "ws://" + TheServer.getBrokerUrl() + ":" + std::to_string(TheServer.getBrokerPort()) };
+        }
+
+        inline static const std::string s_topic = "Messaging_Batching_BM.topic";
+
+        data::IMessagingPtr m_pMessaging;
+        std::shared_ptr<Counter> m_pCounter = std::make_shared<Counter>();
+    };
+
+    BENCHMARK_DEFINE_F(Messaging_Batching_BM, burst)(benchmark::State &state) {
+        auto const nbEvents = static_cast<size_t>(state.range(1));
+        for (auto _ : state) {
+            if (!publishAll(nbEvents)) {
+                state.SkipWithError("events not received");
+                break;
+            }
+        }
+
+        auto const nbPublished   = static_cast<double>(state.iterations() * nbEvents);
+        state.counters["events"] = benchmark::Counter(nbPublished, benchmark::Counter::kIsRate);
+    }
+    BENCHMARK_REGISTER_F(Messaging_Batching_BM, burst)
+        ->ArgsProduct({ { 0, 1 }, { 10, 100, 1000 } })
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+
+} // namespace NS_OSBASE::application::bm
@@ -1,8 +1,11 @@
 #include "Service_BM.h"
 #include "Server.h"
 #include "Service_BMImpl.h"
+#include "osApplication/ServiceEncoding.h"
 #include "osData/IBroker.h"
+#include "osData/IMessaging.h"
 #include "benchmark/benchmark.h"
+#include <atomic>
 
 using namespace std::chrono_literals;
 
@@ -52,6 +55,52 @@ namespace NS_OSBASE::application::bm {
         std::vector<unsigned char> m_buffer;
     };
 
+    class Service_Alive_BM : public Service_RPC_BM {
+    public:
+        void SetUp(const benchmark::State &state) override {
+            Service_RPC_BM::SetUp(state);
+            m_pAliveCounter = std::make_shared<AliveCounter>();
+            m_pMessaging    = data::makeWampMessaging(
+                std::string{ "ws://" + TheServer.getBrokerUrl() + ":" + std::to_string(TheServer.getBrokerPort()) }, "");
+            m_pMessaging->connect();
+            m_pMessaging->subscribe(s_aliveTopic, m_pAliveCounter, m_pAliveCounter);
+        }
+
+        void TearDown(const benchmark::State &state) override {
+            m_pMessaging->unsubscribe(s_aliveTopic, m_pAliveCounter);
+            m_pMessaging->disconnect();
+            Service_RPC_BM::TearDown(state);
+        }
+
+        size_t getNbAliveMessages() const {
+            return m_pAliveCounter->getNbMessages();
+        }
+
+    private:
+        class AliveCounter : public data::IMessaging::IEventDelegate, public data::IMessaging::IErrorDelegate {
+        public:
+            void onEvent(const data::IMessaging::JsonText &) override {
+                ++m_nbMessages;
+            }
+
+            void onError(const std::string &) override {
+            }
+
+            size_t getNbMessages() const {
+                return m_nbMessages;
+            }
+
+        private:
+            std::atomic_size_t m_nbMessages = 0;
+        };
+        using AliveCounterPtr = std::shared_ptr<AliveCounter>;
+
+        inline static const std::string s_aliveTopic = "IService_BMService.notify.alive";
+
+        data::IMessagingPtr m_pMessaging;
+        AliveCounterPtr m_pAliveCounter;
+    };
+
     class Service_PubSub_BM : public benchmark::Fixture {
     public:
         void SetUp(const benchmark::State &state) override {
@@ -261,6 +310,25 @@ namespace NS_OSBASE::application::bm {
     }
     BENCHMARK_REGISTER_F(Service_RPC_BM, noRetSyncStruct)->RangeMultiplier(10)->Range(200, 20000)->Unit(benchmark::kMicrosecond);
 
+    BENCHMARK_DEFINE_F(Service_RPC_BM, encodePayload)(benchmark::State &state) {
+        auto const encoding = state.range(0) == 0 ? ServiceEncoding::json : ServiceEncoding::msgpack;
+        ComplexStruct complexStruct{ std::vector<int>(state.range(1), 123456), {}, "tutu" };
+        complexStruct.f2.resize(state.range(1) / 4, { "titi", 52.3 });
+
+        std::string payload;
+        for (auto _ : state) {
+            payload = serializePayload(encoding, complexStruct);
+            benchmark::DoNotOptimize(deserializePayload(payload, ComplexStruct{}));
+        }
+
+        // size sent on the messaging, and size of the MessagePack buffer before its base64 text conversion
+        auto const pKeyStream = makeServiceStream(encoding);
+        pKeyStream->setValue(complexStruct);
+        state.counters["bytes"]        = static_cast<double>(payload.size());
+        state.counters["binary bytes"] = static_cast<double>(encoding == ServiceEncoding::msgpack ? pKeyStream->getBuffer().size() : 0);
+    }
+    BENCHMARK_REGISTER_F(Service_RPC_BM, encodePayload)->ArgsProduct({ { 0, 1 }, { 16, 1024, 65536 } })->Unit(benchmark::kMicrosecond);
+
     BENCHMARK_DEFINE_F(Service_RPC_Async_BM, noRetAsyncArg)(benchmark::State &state) {
         for (auto _ : state) {
             TheServer.getAsyncBuffer().set(getBuffer());
@@ -294,6 +362,17 @@ namespace NS_OSBASE::application::bm {
     }
     BENCHMARK_REGISTER_F(Service_RPC_Async_BM, noRetAsyncVolume)->Arg(512)->Unit(benchmark::kMicrosecond);
 
+    BENCHMARK_DEFINE_F(Service_Alive_BM, aliveTraffic)(benchmark::State &state) {
+        for (auto _ : state) {
+            getStub()->noRetNoArg();
+        }
+
+        // before: one alive message per call (announcing the call), now: one per alive period whatever the rate of the calls
+        state.counters["alive/call"] = static_cast<double>(getNbAliveMessages()) / static_cast<double>(state.iterations());
+        state.counters["calls"]      = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    }
+    BENCHMARK_REGISTER_F(Service_Alive_BM, aliveTraffic)->Arg(0)->Unit(benchmark::kMicrosecond);
+
     BENCHMARK_DEFINE_F(Service_PubSub_BM, checkEvent)(benchmark::State &state) {
         for (auto _ : state) {
             TheService_BMImpl.invokeEvent(state.range(1) == 0   ? DataType::noData
@@ -1,5 +1,13 @@
 #include "benchmark/benchmark.h"
+#include "osApplication/InlineTask.h"
 #include "osApplication/Task.h"
+#include "osApplication/TaskLoop.h"
+#include "osApplication/TaskLoopPool.h"
+#include "osApplication/TaskQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
 
 using namespace NS_OSBASE::application;
 
@@ -34,6 +42,13 @@ static void BM_makeTypedFunction(benchmark::State &state) {
 }
 BENCHMARK(BM_makeTypedFunction);
 
+static void BM_makeInlineFunction(benchmark::State &state) {
+    for (auto _ : state) {
+        auto const task = makeInlineTask(&doVoid, 2, "toto");
+    }
+}
+BENCHMARK(BM_makeInlineFunction);
+
 static void BM_executeFunction(benchmark::State &state) {
     auto const pFnTask = makeTask(&doVoid, 2, "toto");
 
@@ -51,3 +66,196 @@ static void BM_executeFunctionWithoutTask(benchmark::State &state) {
     }
 }
 BENCHMARK(BM_executeFunctionWithoutTask);
+
+namespace {
+    std::vector<std::chrono::milliseconds> makeDelays(const size_t count) {
+        // spread over 1s .. 1h: alive timers, retries and timeouts
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<long long> delayDistribution(1000, 3600 * 1000);
+        std::vector<std::chrono::milliseconds> delays(count);
+        std::generate(delays.begin(), delays.end(), [&]() { return std::chrono::milliseconds(delayDistribution(generator)); });
+        return delays;
+    }
+
+    void fillTaskQueue(TaskQueue &taskQueue, const std::vector<std::chrono::milliseconds> &delays) {
+        taskQueue.clearTasks();
+        for (auto const &delay : delays) {
+            taskQueue.pushSingleShotTask(delay, &doVoid, 2, "toto");
+        }
+    }
+} // namespace
+
+static void BM_TaskQueue_pushSingleShot(benchmark::State &state) {
+    auto const depth  = static_cast<size_t>(state.range(0));
+    auto const delays = makeDelays(depth);
+    TaskQueue taskQueue;
+    fillTaskQueue(taskQueue, delays);
+
+    size_t index = 0;
+    for (auto _ : state) {
+        taskQueue.pushSingleShotTask(delays[index], &doVoid, 2, "toto");
+
+        // keep the depth of the queue around the expected one
+        if (++index == depth) {
+            state.PauseTiming();
+            fillTaskQueue(taskQueue, delays);
+            index = 0;
+            state.ResumeTiming();
+        }
+    }
+}
+BENCHMARK(BM_TaskQueue_pushSingleShot)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TaskQueue_pushPull(benchmark::State &state) {
+    TaskQueue taskQueue;
+    fillTaskQueue(taskQueue, makeDelays(static_cast<size_t>(state.range(0))));
+
+    for (auto _ : state) {
+        taskQueue.pushTask(&doVoid, 2, "toto");
+        taskQueue.pullTask()->execute();
+    }
+}
+BENCHMARK(BM_TaskQueue_pushPull)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TaskQueue_pushPullShared(benchmark::State &state) {
+    TaskQueue taskQueue;
+    int value = 0;
+
+    for (auto _ : state) {
+        taskQueue.pushTask([&value](int val) { value += val; }, 1);
+        taskQueue.pullNextTask().execute();
+    }
+    benchmark::DoNotOptimize(value);
+}
+BENCHMARK(BM_TaskQueue_pushPullShared);
+
+static void BM_TaskQueue_postPullInline(benchmark::State &state) {
+    TaskQueue taskQueue;
+    int value = 0;
+
+    for (auto _ : state) {
+        taskQueue.postTask([&value](int val) { value += val; }, 1);
+        taskQueue.pullNextTask().execute();
+    }
+    benchmark::DoNotOptimize(value);
+}
+BENCHMARK(BM_TaskQueue_postPullInline);
+
+static void BM_TaskLoop_burst(benchmark::State &state) {
+    // bursts of 10k ready tasks executed by batches of state.range(0) tasks
+    constexpr int nbTasks = 10000;
+    TaskLoop loop;
+    loop.setBatchSize(static_cast<size_t>(state.range(0)));
+    int value = 0;
+
+    for (auto _ : state) {
+        for (int i = 0; i < nbTasks; ++i) {
+            loop.post([&value](int val) { value += val; }, 1);
+        }
+        loop.post([&loop]() { loop.stop(); });
+        loop.run();
+    }
+
+    benchmark::DoNotOptimize(value);
+    state.SetItemsProcessed(state.iterations() * nbTasks);
+}
+BENCHMARK(BM_TaskLoop_burst)->RangeMultiplier(4)->Range(1, 1024);
+
+static void BM_TaskLoop_instrumentation(benchmark::State &state) {
+    // bursts of 10k ready tasks: 0 = no instrumentation, 1 = statistics, 2 = statistics and watchdog
+    class StallDelegate : public TaskLoop::IStallDelegate {
+    public:
+        void onStall(const std::string &, const std::chrono::milliseconds &) override {
+        }
+    };
+
+    constexpr int nbTasks = 10000;
+    TaskLoop loop;
+    auto const pStallDelegate = std::make_shared<StallDelegate>();
+    loop.setStatisticsEnabled(state.range(0) >= 1);
+    if (state.range(0) >= 2) {
+        loop.setWatchdog(std::chrono::milliseconds(100), pStallDelegate);
+    }
+    int value = 0;
+
+    for (auto _ : state) {
+        for (int i = 0; i < nbTasks; ++i) {
+            loop.post([&value](int val) { value += val; }, 1);
+        }
+        loop.post([&loop]() { loop.stop(); });
+        loop.run();
+    }
+
+    benchmark::DoNotOptimize(value);
+    state.SetItemsProcessed(state.iterations() * nbTasks);
+}
+BENCHMARK(BM_TaskLoop_instrumentation)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_TaskLoop_contendedPush(benchmark::State &state) {
+    // pushes from a foreign thread while state.range(0) other threads push in the same running loop
+    TaskLoop loop;
+    loop.runAsync();
+
+    std::atomic_int nbPendingTasks = 0;
+    std::atomic_bool bEnd          = false;
+    std::vector<std::thread> producers;
+    for (int nProducer = 0; nProducer < state.range(0); ++nProducer) {
+        producers.emplace_back([&]() {
+            while (!bEnd) {
+                if (nbPendingTasks < 10000) {
+                    ++nbPendingTasks;
+                    loop.push([&nbPendingTasks]() { --nbPendingTasks; });
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto _ : state) {
+        ++nbPendingTasks;
+        loop.push([&nbPendingTasks]() { --nbPendingTasks; });
+    }
+
+    bEnd = true;
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    loop.stop();
+}
+BENCHMARK(BM_TaskLoop_contendedPush)->Arg(0)->Arg(1)->Arg(3)->UseRealTime();
+
+static void BM_TaskLoopPool_contendedPush(benchmark::State &state) {
+    // same as BM_TaskLoop_contendedPush with a strand: the pushes of ready tasks schedule it without the lock of its queue
+    auto const pPool   = TaskLoopPool::create(2);
+    auto const pStrand = pPool->makeStrand();
+    pStrand->runAsync();
+
+    std::atomic_int nbPendingTasks = 0;
+    std::atomic_bool bEnd          = false;
+    std::vector<std::thread> producers;
+    for (int nProducer = 0; nProducer < state.range(0); ++nProducer) {
+        producers.emplace_back([&]() {
+            while (!bEnd) {
+                if (nbPendingTasks < 10000) {
+                    ++nbPendingTasks;
+                    pStrand->push([&nbPendingTasks]() { --nbPendingTasks; });
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto _ : state) {
+        ++nbPendingTasks;
+        pStrand->push([&nbPendingTasks]() { --nbPendingTasks; });
+    }
+
+    bEnd = true;
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    pStrand->stop();
+}
+BENCHMARK(BM_TaskLoopPool_contendedPush)->Arg(0)->Arg(1)->Arg(3)->UseRealTime();
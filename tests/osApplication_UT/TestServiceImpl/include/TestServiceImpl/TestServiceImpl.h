@@ -26,6 +26,11 @@ namespace testservice::impl {
         NS_OSBASE::data::AsyncPagedData<std::vector<bool>> setPositionsAsync(NS_OSBASE::data::AsyncData<api::Positions> buffer) override;
 
         void wait(unsigned long long timeoutMs) override;
+        void waitSerialized(unsigned long long timeoutMs) override;
+
+        using ITestServiceSkeleton::getPositionChunks;
+        void getPositionChunks(
+            NS_OSBASE::application::IServiceStreamWriterPtr<api::Position> pWriter, unsigned int nbChunks) const override;
 
         void resetWait();
         void waitForStartWait();
@@ -38,6 +38,7 @@ namespace testservice::impl {
     }
 
     bool TestServiceImpl::setText(std::string text, int, double) {
+        invalidateGetText();
         publishTextUpdatedMsg();
         return true;
     }
@@ -83,6 +84,19 @@ namespace testservice::impl {
         std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
     }
 
+    void TestServiceImpl::waitSerialized(unsigned long long timeoutMs) {
+        wait(timeoutMs);
+    }
+
+    void TestServiceImpl::getPositionChunks(
+        NS_OSBASE::application::IServiceStreamWriterPtr<api::Position> pWriter, unsigned int nbChunks) const {
+        for (unsigned int index = 0; index < nbChunks; ++index) {
+            if (!pWriter->write({ static_cast<double>(index), 0., 0. })) {
+                return;
+            }
+        }
+    }
+
     void TestServiceImpl::resetWait() {
         m_bWaitStarted = false;
     }
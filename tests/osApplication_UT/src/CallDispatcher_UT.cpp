@@ -0,0 +1,100 @@
+// osBase package
+#include "osApplication/CallDispatcher.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <condition_variable>
+
+using namespace NS_OSBASE::application;
+
+namespace NS_OSBASE::application::ut {
+
+    class CallDispatcher_UT : public testing::Test {
+    protected:
+        static constexpr std::chrono::milliseconds getTimeout(unsigned int timeout) {
+            return std::chrono::milliseconds(timeout * TIMEOUT_FACTOR);
+        }
+    };
+
+    TEST_F(CallDispatcher_UT, serialized) {
+        auto const pPool = TaskLoopPool::create(4);
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<int> values;
+
+        {
+            CallDispatcher dispatcher(pPool, 1);
+            for (int i = 0; i < 100; ++i) {
+                dispatcher.dispatch(makeInlineTask([&mutex, &cv, &values, i]() {
+                    const std::lock_guard locker(mutex);
+                    values.push_back(i);
+                    cv.notify_one();
+                }));
+            }
+
+            std::unique_lock locker(mutex);
+            ASSERT_TRUE(cv.wait_for(locker, getTimeout(5000), [&values]() { return values.size() == 100; }));
+        }
+
+        // executed one at a time, in the order of arrival
+        for (int i = 0; i < 100; ++i) {
+            ASSERT_EQ(i, values[i]);
+        }
+    }
+
+    TEST_F(CallDispatcher_UT, concurrency) {
+        auto const pPool = TaskLoopPool::create(4);
+        std::mutex mutex;
+        std::condition_variable cv;
+        int nbRunningCalls    = 0;
+        int nbMaxRunningCalls = 0;
+        int nbEndedCalls      = 0;
+
+        {
+            CallDispatcher dispatcher(pPool, 2);
+            ASSERT_EQ(2, dispatcher.getConcurrency());
+
+            for (int i = 0; i < 6; ++i) {
+                dispatcher.dispatch(makeInlineTask([&]() {
+                    {
+                        const std::lock_guard locker(mutex);
+                        nbMaxRunningCalls = std::max(nbMaxRunningCalls, ++nbRunningCalls);
+                    }
+                    std::this_thread::sleep_for(getTimeout(20));
+                    const std::lock_guard locker(mutex);
+                    --nbRunningCalls;
+                    ++nbEndedCalls;
+                    cv.notify_one();
+                }));
+            }
+            ASSERT_GT(dispatcher.getNbPendingCalls(), 0);
+
+            std::unique_lock locker(mutex);
+            ASSERT_TRUE(cv.wait_for(locker, getTimeout(5000), [&nbEndedCalls]() { return nbEndedCalls == 6; }));
+        }
+
+        ASSERT_EQ(2, nbMaxRunningCalls);
+    }
+
+    TEST_F(CallDispatcher_UT, destroyedByAStrand) {
+        auto const pPool   = TaskLoopPool::create(1);
+        auto const pStrand = pPool->makeStrand();
+        pStrand->runAsync();
+
+        // the dispatcher waits for its running call on the only worker of the pool
+        std::promise<bool> destroyed;
+        pStrand->push([&]() {
+            std::atomic_bool bCalled = false;
+            {
+                CallDispatcher dispatcher(pPool, 1);
+                dispatcher.dispatch(makeInlineTask([&bCalled]() { bCalled = true; }));
+            }
+            destroyed.set_value(bCalled);
+        });
+
+        auto futDestroyed = destroyed.get_future();
+        ASSERT_EQ(std::future_status::ready, futDestroyed.wait_for(getTimeout(1000)));
+        ASSERT_TRUE(futDestroyed.get());
+
+        pStrand->stop();
+    }
+} // namespace NS_OSBASE::application::ut
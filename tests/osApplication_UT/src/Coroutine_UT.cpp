@@ -0,0 +1,197 @@
+// osBase package
+#include "BaseService_UT.h"
+#include "testservice.h"
+#include "TestServiceImpl/TestServiceImpl.h"
+#include "osApplication/Coroutine.h"
+#include "gtest/gtest.h"
+
+#ifdef __cpp_impl_coroutine
+using namespace NS_OSBASE::application;
+
+namespace NS_OSBASE::application::ut {
+
+    class Coroutine_UT : public testing::Test {
+    protected:
+        static constexpr std::chrono::milliseconds getTimeout(unsigned int timeout) {
+            return std::chrono::milliseconds(timeout * TIMEOUT_FACTOR);
+        }
+    };
+
+    class CoroutineService_UT : public TService_UT<testservice::api::ITestService, testservice::impl::TestServiceImpl> {
+    protected:
+        CoroutineService_UT()
+            : TService_UT([]() {
+                  return testservice::api::makeStub(std::string{ "ws://" + getBrokerUrl() + ":" + std::to_string(getBrokerPort()) }, "");
+              }) {
+        }
+    };
+
+    namespace {
+        CoTask<> record(TaskLoop &loop, std::vector<int> &values) {
+            values.push_back(0);
+            co_await loop.schedule();
+            values.push_back(2);
+            loop.stop();
+        }
+
+        CoTask<> sleepFor(TaskLoop &loop, const std::chrono::milliseconds delay, std::chrono::milliseconds &elapsed) {
+            auto const start = TaskLoop::clock::now();
+            co_await loop.sleep(delay);
+            elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(TaskLoop::clock::now() - start);
+            loop.stop();
+        }
+
+        CoTask<int> add(TaskLoop &loop, const int lhs, const int rhs) {
+            co_await loop.schedule();
+            co_return lhs + rhs;
+        }
+
+        CoTask<> sum(TaskLoop &loop, int &result) {
+            result = co_await add(loop, 1, 2);
+            result += co_await add(loop, 3, 4);
+            loop.stop();
+        }
+
+        CoTask<> throwError(TaskLoop &loop) {
+            co_await loop.schedule();
+            throw std::runtime_error("error");
+        }
+
+        CoTask<> catchError(TaskLoop &loop, bool &bCaught) {
+            try {
+                co_await throwError(loop);
+            } catch (const std::runtime_error &) {
+                bCaught = true;
+            }
+            loop.stop();
+        }
+
+        CoTask<> count(TaskLoop &loop, const std::chrono::milliseconds delay, const int nbCoroutines, int &nbEnded) {
+            co_await loop.sleep(delay);
+            if (++nbEnded == nbCoroutines) {
+                loop.stop();
+            }
+        }
+
+        CoTask<> switchLoop(TaskLoop &loop, TaskLoop &otherLoop, std::thread::id &threadId) {
+            co_await otherLoop.schedule();
+            co_await otherLoop.sleep(std::chrono::milliseconds(1));
+            threadId = std::this_thread::get_id();
+            loop.stop();
+        }
+
+        CoTask<> receive(TaskLoop &loop, data::AsyncData<int> &asyncData, int &value) {
+            value = co_await coGet(asyncData);
+            loop.stop();
+        }
+
+        CoTask<> callService(TaskLoop &loop, testservice::api::ITestServicePtr pStub, bool &bSet, testservice::api::Positions &positions) {
+            bSet = co_await pStub->coSetText("coText", 1, 1.);
+            co_await pStub->coSetPosition({ 1., 2., 3. }, testservice::api::EPosition::Absolute);
+            positions = co_await pStub->coGetPositions();
+            loop.stop();
+        }
+    } // namespace
+
+    TEST_F(Coroutine_UT, spawn) {
+        TaskLoop loop;
+        std::vector<int> values;
+
+        loop.spawn(record(loop, values));
+        loop.push([&values]() { values.push_back(1); });
+        loop.run();
+
+        // the coroutine is resumed after the pending tasks
+        ASSERT_EQ(std::vector<int>({ 0, 1, 2 }), values);
+    }
+
+    TEST_F(Coroutine_UT, sleep) {
+        TaskLoop loop;
+        auto constexpr delay = getTimeout(50);
+        auto elapsed         = std::chrono::milliseconds::zero();
+
+        loop.spawn(sleepFor(loop, delay, elapsed));
+        loop.run();
+
+        ASSERT_GE(elapsed, delay);
+    }
+
+    TEST_F(Coroutine_UT, await) {
+        TaskLoop loop;
+        int result = 0;
+
+        loop.spawn(sum(loop, result));
+        loop.run();
+
+        ASSERT_EQ(10, result);
+    }
+
+    TEST_F(Coroutine_UT, await_exception) {
+        TaskLoop loop;
+        bool bCaught = false;
+
+        loop.spawn(catchError(loop, bCaught));
+        loop.run();
+
+        ASSERT_TRUE(bCaught);
+    }
+
+    TEST_F(Coroutine_UT, thousands) {
+        TaskLoop loop;
+        auto constexpr nbCoroutines = 10000;
+        int nbEnded                 = 0;
+
+        // all the coroutines are suspended at the same time on the thread of the loop
+        for (int i = 0; i < nbCoroutines; ++i) {
+            loop.spawn(count(loop, getTimeout(10), nbCoroutines, nbEnded));
+        }
+        loop.run();
+
+        ASSERT_EQ(nbCoroutines, nbEnded);
+    }
+
+    TEST_F(Coroutine_UT, schedule_otherLoop) {
+        TaskLoop loop;
+        auto pOtherLoop = std::make_shared<TaskLoop>();
+        auto const fut  = pOtherLoop->runAsync();
+        std::thread::id threadId;
+
+        loop.spawn(switchLoop(loop, *pOtherLoop, threadId));
+        loop.run();
+        pOtherLoop->stop();
+        fut.wait();
+
+        // resumed on the loop awaited, then kept on it
+        ASSERT_NE(std::this_thread::get_id(), threadId);
+    }
+
+    TEST_F(Coroutine_UT, coGet) {
+        TaskLoop loop;
+        auto creator  = data::makeAsyncData<int>();
+        auto endpoint = data::makeAsyncData<int>(creator.getUriOfCreator());
+        int value     = 0;
+
+        loop.spawn(receive(loop, endpoint, value));
+        loop.push([&creator]() { creator.set(42); });
+        loop.pushSingleShot(getTimeout(5000), [&loop]() { loop.stop(); });
+        loop.run();
+
+        ASSERT_EQ(42, value);
+    }
+
+    TEST_F(CoroutineService_UT, coInvoke) {
+        TaskLoop loop;
+        auto bSet = false;
+        testservice::api::Positions positions;
+
+        // default call timeout of the stub (none): the coroutine is resumed by the results only
+        loop.spawn(callService(loop, getStub(), bSet, positions));
+        loop.pushSingleShot(getTimeout(5000), [&loop]() { loop.stop(); });
+        loop.run();
+
+        ASSERT_TRUE(bSet);
+        ASSERT_FALSE(positions.empty());
+        ASSERT_DOUBLE_EQ(3., positions.back().z);
+    }
+} // namespace NS_OSBASE::application::ut
+#endif
@@ -0,0 +1,140 @@
+// osBase package
+#include "osApplication/EventDispatcher.h"
+#include "gtest/gtest.h"
+#include <thread>
+#include <vector>
+
+namespace NS_OSBASE::application::ut {
+
+    class EventDispatcher_UT : public testing::Test {
+    protected:
+        struct Message {
+            std::string text;
+        };
+
+        static Message decodeMessage(const std::string &payload) {
+            ++s_nbDecodes;
+            return { payload };
+        }
+
+        void SetUp() override {
+            s_nbDecodes = 0;
+        }
+
+        inline static std::atomic_int s_nbDecodes = 0;
+    };
+
+    TEST_F(EventDispatcher_UT, singleSubscriber) {
+        const std::string topic = "ut/realm/single";
+        TheEventDispatcher.subscribe(topic);
+
+        // nothing kept: decoded for each event
+        auto const pMessage1 = TheEventDispatcher.decode<Message>(topic, "text", decodeMessage);
+        auto const pMessage2 = TheEventDispatcher.decode<Message>(topic, "text", decodeMessage);
+        ASSERT_EQ("text", pMessage1->text);
+        ASSERT_NE(pMessage1, pMessage2);
+        ASSERT_EQ(2, s_nbDecodes);
+
+        TheEventDispatcher.unsubscribe(topic);
+    }
+
+    TEST_F(EventDispatcher_UT, decodeOnce) {
+        const std::string topic = "ut/realm/decode";
+        constexpr size_t nbSubscribers = 4;
+        for (size_t index = 0; index < nbSubscribers; ++index) {
+            TheEventDispatcher.subscribe(topic);
+        }
+
+        auto const counters = TheEventDispatcher.getCounters();
+        std::vector<std::shared_ptr<const Message>> pMessages;
+        for (size_t index = 0; index < nbSubscribers; ++index) {
+            pMessages.push_back(TheEventDispatcher.decode<Message>(topic, "first", decodeMessage));
+        }
+        for (auto const &pMessage : pMessages) {
+            ASSERT_EQ(pMessages.front(), pMessage);
+        }
+        ASSERT_EQ(1, s_nbDecodes);
+        ASSERT_EQ(counters.nbDecodes + 1, TheEventDispatcher.getCounters().nbDecodes);
+        ASSERT_EQ(counters.nbShares + nbSubscribers - 1, TheEventDispatcher.getCounters().nbShares);
+
+        // next event
+        auto const pNext = TheEventDispatcher.decode<Message>(topic, "second", decodeMessage);
+        ASSERT_EQ("second", pNext->text);
+        ASSERT_EQ(2, s_nbDecodes);
+        ASSERT_EQ("first", pMessages.front()->text); // immutable, kept by its owners
+
+        // other topic
+        TheEventDispatcher.decode<Message>("ut/realm/other", "second", decodeMessage);
+        ASSERT_EQ(3, s_nbDecodes);
+
+        for (size_t index = 0; index < nbSubscribers; ++index) {
+            TheEventDispatcher.unsubscribe(topic);
+        }
+    }
+
+    TEST_F(EventDispatcher_UT, convertOnce) {
+        const std::string topic = "ut/realm/convert";
+        TheEventDispatcher.subscribe(topic);
+        TheEventDispatcher.subscribe(topic);
+
+        auto const convert = [](const std::string &text) {
+            ++s_nbDecodes;
+            return Message{ text };
+        };
+        auto const pSource   = std::make_shared<const std::string>("local");
+        auto const pMessage1 = TheEventDispatcher.convert<Message>(topic, pSource, convert);
+        auto const pMessage2 = TheEventDispatcher.convert<Message>(topic, pSource, convert);
+        ASSERT_EQ(pMessage1, pMessage2);
+        ASSERT_EQ("local", pMessage1->text);
+
+        // another object, even equal, is converted
+        TheEventDispatcher.convert<Message>(topic, std::make_shared<const std::string>("local"), convert);
+        ASSERT_EQ(2, s_nbDecodes);
+
+        TheEventDispatcher.unsubscribe(topic);
+        TheEventDispatcher.unsubscribe(topic);
+    }
+
+    TEST_F(EventDispatcher_UT, concurrentSubscribers) {
+        const std::string topic = "ut/realm/concurrent";
+        constexpr size_t nbSubscribers = 8;
+        for (size_t index = 0; index < nbSubscribers; ++index) {
+            TheEventDispatcher.subscribe(topic);
+        }
+
+        std::vector<std::shared_ptr<const Message>> pMessages(nbSubscribers);
+        std::vector<std::thread> subscribers;
+        for (size_t index = 0; index < nbSubscribers; ++index) {
+            subscribers.emplace_back([&pMessages, &topic, index]() {
+                pMessages[index] = TheEventDispatcher.decode<Message>(topic, "event", decodeMessage);
+            });
+        }
+        for (auto &subscriber : subscribers) {
+            subscriber.join();
+        }
+
+        ASSERT_EQ(1, s_nbDecodes);
+        for (auto const &pMessage : pMessages) {
+            ASSERT_EQ(pMessages.front(), pMessage);
+        }
+
+        for (size_t index = 0; index < nbSubscribers; ++index) {
+            TheEventDispatcher.unsubscribe(topic);
+        }
+    }
+
+    TEST_F(EventDispatcher_UT, failedDecoding) {
+        const std::string topic = "ut/realm/failed";
+        TheEventDispatcher.subscribe(topic);
+        TheEventDispatcher.subscribe(topic);
+
+        auto const throwingDecode = [](const std::string &) -> Message { throw std::runtime_error("bad payload"); };
+        ASSERT_THROW(TheEventDispatcher.decode<Message>(topic, "bad", throwingDecode), std::runtime_error);
+        ASSERT_EQ("bad", TheEventDispatcher.decode<Message>(topic, "bad", decodeMessage)->text);
+        ASSERT_EQ(1, s_nbDecodes);
+
+        TheEventDispatcher.unsubscribe(topic);
+        TheEventDispatcher.unsubscribe(topic);
+    }
+
+} // namespace NS_OSBASE::application::ut
@@ -0,0 +1,113 @@
+// osBase package
+#include "osApplication/InlineTask.h"
+#include "gtest/gtest.h"
+#include <array>
+
+using namespace NS_OSBASE::application;
+
+namespace NS_OSBASE::application::ut {
+
+    class InlineTask_UT : public testing::Test {};
+
+    namespace {
+        struct S {
+            void setInt(const int val) {
+                m_ret = val;
+            }
+
+            int m_ret = 0;
+        };
+
+        static int s_myI = 0;
+        static std::string s_myStr;
+
+        void doVoid(int i, const std::string str) {
+            s_myI   = i;
+            s_myStr = str;
+        };
+    } // namespace
+
+    TEST_F(InlineTask_UT, makerFunction) {
+        InlineTask task;
+        ASSERT_TRUE(task.empty());
+
+        task = makeInlineTask(&doVoid, 2, "toto");
+        ASSERT_FALSE(task.empty());
+        ASSERT_TRUE(task.isInline());
+
+        task.execute();
+        ASSERT_EQ(2, s_myI);
+        ASSERT_EQ("toto", s_myStr);
+    }
+
+    TEST_F(InlineTask_UT, makerLambda) {
+        int i     = 0;
+        auto task = makeInlineTask([&i](int val) { i = val; }, 3);
+        ASSERT_TRUE(task.isInline());
+
+        task.execute();
+        ASSERT_EQ(3, i);
+    }
+
+    TEST_F(InlineTask_UT, largeCallback) {
+        std::array<int, 32> values{};
+        int sum   = 0;
+        auto task = makeInlineTask([values, &sum]() {
+            for (auto const value : values) {
+                sum += value + 1;
+            }
+        });
+        ASSERT_FALSE(task.isInline());
+
+        task.execute();
+        ASSERT_EQ(32, sum);
+    }
+
+    TEST_F(InlineTask_UT, move) {
+        auto pValue = std::make_shared<int>(0);
+        auto task1  = makeInlineTask([pValue]() { ++*pValue; });
+        ASSERT_EQ(2, pValue.use_count());
+
+        auto task2 = std::move(task1);
+        ASSERT_TRUE(task1.empty());
+        ASSERT_FALSE(task2.empty());
+        ASSERT_EQ(2, pValue.use_count());
+
+        task2.execute();
+        ASSERT_EQ(1, *pValue);
+
+        task2 = InlineTask();
+        ASSERT_EQ(1, pValue.use_count());
+    }
+
+    TEST_F(InlineTask_UT, makerMethod) {
+        auto pS   = std::make_shared<S>();
+        auto task = makeInlineMethodTask(pS, &S::setInt, 2);
+        ASSERT_TRUE(task.isInline());
+
+        task.execute();
+        ASSERT_EQ(2, pS->m_ret);
+
+        // Check pS is not more called (reset)
+        auto const pWS = std::weak_ptr<S>(pS);
+        task           = makeInlineMethodTask(pS, &S::setInt, 3);
+        pS.reset();
+        ASSERT_TRUE(pWS.expired());
+        task.execute();
+    }
+
+    TEST_F(InlineTask_UT, getType) {
+        auto const callback = [](int) {};
+        ASSERT_EQ(typeid(void), InlineTask().getType());
+        ASSERT_EQ(typeid(callback), makeInlineTask(callback, 1).getType());
+        ASSERT_EQ(typeid(&doVoid), makeInlineTask(&doVoid, 2, "toto").getType());
+
+        // shared task: dynamic type of the task
+        int i            = 0;
+        auto const pTask = makeTask([&i]() { ++i; });
+        auto task        = makeInlineTask(pTask);
+        ASSERT_EQ(typeid(*pTask), task.getType());
+        task.execute();
+        ASSERT_EQ(1, i);
+    }
+} // namespace NS_OSBASE::application::ut
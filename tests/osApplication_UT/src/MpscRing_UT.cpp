@@ -0,0 +1,82 @@
+// osBase package
+#include "osApplication/MpscRing.h"
+#include "gtest/gtest.h"
+#include <thread>
+#include <vector>
+
+using namespace NS_OSBASE::application;
+
+namespace NS_OSBASE::application::ut {
+
+    class MpscRing_UT : public testing::Test {};
+
+    TEST_F(MpscRing_UT, push_pop) {
+        MpscRing<int, 4> ring;
+        int value = 0;
+
+        ASSERT_TRUE(ring.empty());
+        ASSERT_FALSE(ring.tryPop(value));
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(ring.tryPush(int(i)));
+        }
+        ASSERT_FALSE(ring.empty());
+        ASSERT_FALSE(ring.tryPush(4)); // full
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(ring.tryPop(value));
+            ASSERT_EQ(i, value);
+        }
+        ASSERT_TRUE(ring.empty());
+
+        // the cells are reused
+        ASSERT_TRUE(ring.tryPush(5));
+        ASSERT_TRUE(ring.tryPop(value));
+        ASSERT_EQ(5, value);
+    }
+
+    TEST_F(MpscRing_UT, moveOnly) {
+        MpscRing<std::unique_ptr<int>, 2> ring;
+        auto pValue = std::make_unique<int>(3);
+
+        ASSERT_TRUE(ring.tryPush(std::move(pValue)));
+        ASSERT_EQ(nullptr, pValue);
+
+        ASSERT_TRUE(ring.tryPop(pValue));
+        ASSERT_EQ(3, *pValue);
+    }
+
+    TEST_F(MpscRing_UT, multipleProducers) {
+        constexpr int nbProducers = 4;
+        constexpr int nbValues    = 10000;
+        MpscRing<std::pair<int, int>, 64> ring;
+
+        std::vector<std::thread> producers;
+        for (int nProducer = 0; nProducer < nbProducers; ++nProducer) {
+            producers.emplace_back([&ring, nProducer]() {
+                for (int i = 0; i < nbValues; ++i) {
+                    while (!ring.tryPush({ nProducer, i })) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        // each producer's values are popped in order
+        std::vector<int> nextValues(nbProducers, 0);
+        std::pair<int, int> value;
+        for (int nbPopped = 0; nbPopped < nbProducers * nbValues;) {
+            if (ring.tryPop(value)) {
+                ASSERT_EQ(nextValues[value.first]++, value.second);
+                ++nbPopped;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        for (auto &producer : producers) {
+            producer.join();
+        }
+        ASSERT_TRUE(ring.empty());
+    }
+} // namespace NS_OSBASE::application::ut
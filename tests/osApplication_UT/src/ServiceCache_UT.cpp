@@ -0,0 +1,65 @@
+// osBase package
+#include "osApplication/ServiceCache.h"
+#include "gtest/gtest.h"
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace NS_OSBASE::application::ut {
+
+    class ServiceCache_UT : public testing::Test {};
+
+    TEST_F(ServiceCache_UT, findInsert) {
+        ServiceCache cache({});
+        ASSERT_FALSE(cache.find("[1]").has_value());
+
+        cache.insert("[1]", std::string("one"), cache.getGeneration());
+        auto const value = cache.find("[1]");
+        ASSERT_TRUE(value.has_value());
+        ASSERT_EQ("one", std::any_cast<std::string>(*value));
+        ASSERT_FALSE(cache.find("[2]").has_value());
+
+        auto const counters = cache.getCounters();
+        ASSERT_EQ(1, counters.nbHits);
+        ASSERT_EQ(2, counters.nbMisses);
+        ASSERT_EQ(0, counters.nbEvictions);
+    }
+
+    TEST_F(ServiceCache_UT, capacity) {
+        ServiceCache cache({ 0ms, 2 });
+        cache.insert("[1]", 1, cache.getGeneration());
+        cache.insert("[2]", 2, cache.getGeneration());
+        ASSERT_TRUE(cache.find("[1]").has_value()); // [2] becomes the least recently used
+
+        cache.insert("[3]", 3, cache.getGeneration());
+        ASSERT_EQ(2, cache.getSize());
+        ASSERT_TRUE(cache.find("[1]").has_value());
+        ASSERT_FALSE(cache.find("[2]").has_value());
+        ASSERT_TRUE(cache.find("[3]").has_value());
+        ASSERT_EQ(1, cache.getCounters().nbEvictions);
+    }
+
+    TEST_F(ServiceCache_UT, ttl) {
+        ServiceCache cache({ 20ms, 0 });
+        cache.insert("[]", 1, cache.getGeneration());
+        ASSERT_TRUE(cache.find("[]").has_value());
+
+        std::this_thread::sleep_for(40ms);
+        ASSERT_FALSE(cache.find("[]").has_value());
+        ASSERT_EQ(0, cache.getSize());
+        ASSERT_EQ(1, cache.getCounters().nbEvictions);
+    }
+
+    TEST_F(ServiceCache_UT, clear) {
+        ServiceCache cache({});
+        cache.insert("[]", 1, cache.getGeneration());
+
+        auto const generation = cache.getGeneration(); // call started before the invalidation
+        cache.clear();
+        ASSERT_FALSE(cache.find("[]").has_value());
+
+        cache.insert("[]", 2, generation);
+        ASSERT_FALSE(cache.find("[]").has_value());
+        ASSERT_EQ(1, cache.getCounters().nbInvalidations);
+    }
+} // namespace NS_OSBASE::application::ut
@@ -3,6 +3,7 @@
 #include "BaseService_UT.h"
 #include "testservice.h"
 #include "TestServiceImpl/TestServiceImpl.h"
+#include "osApplication/ServiceStub.h"
 #include <queue>
 
 using namespace std::chrono_literals;
@@ -100,10 +101,20 @@ namespace NS_OSBASE::application::ut {
                 }
             }
 
+            explicit TestServiceClient(const ServiceEncoding encoding)
+                : m_pStub(testservice::api::makeStub(std::string{ "ws://" + getBrokerUrl() + ":" + std::to_string(getBrokerPort()) }, "")) {
+                getStub()->setEncoding(encoding);
+                m_pStub->connect();
+            }
+
             testservice::api::ITestServicePtr operator->() const {
                 return m_pStub;
             }
 
+            std::shared_ptr<ServiceStub<testservice::api::ITestService>> getStub() const {
+                return std::dynamic_pointer_cast<ServiceStub<testservice::api::ITestService>>(m_pStub);
+            }
+
         private:
             testservice::api::ITestServicePtr m_pStub;
         };
@@ -232,6 +243,171 @@ namespace NS_OSBASE::application::ut {
         ASSERT_FALSE(connect1.has_value());
     }
 
+    TEST_F(ServiceSynchro_UT, service_concurrentRPC) {
+        const TestServiceClient client1, client2;
+        TestServiceObserver o1;
+        auto const guard = core::make_scope_exit([&]() {
+            stopService();
+            client1->detachAll(o1);
+        });
+        client1->attachAll(o1);
+        startService();
+        auto const alivePeriod = std::chrono::milliseconds(testservice::impl::TheTestServiceImpl.getAlivePeriod());
+
+        auto const connect1 = o1.waitConnectionMsg(2 * alivePeriod);
+        ASSERT_TRUE(connect1.has_value() && connect1.value());
+
+        // "wait" is registered with a concurrency: the running call doesn't block the other ones
+        testservice::impl::TheTestServiceImpl.resetWait();
+        std::thread th([&]() { client1->wait((alivePeriod * 3).count()); });
+        testservice::impl::TheTestServiceImpl.waitForStartWait();
+
+        auto const start = std::chrono::steady_clock::now();
+        client2->getText();
+        ASSERT_LT(std::chrono::steady_clock::now() - start, alivePeriod * 3);
+
+        th.join();
+    }
+
+    TEST_F(ServiceSynchro_UT, service_longCallInTheLaneOfTheCalls) {
+        const TestServiceClient client1, client2;
+        TestServiceObserver o1, o2;
+        auto const guard = core::make_scope_exit([&]() {
+            stopService();
+            testservice::impl::TheTestServiceImpl.setCallPriority({});
+            TheLocalMessaging.setEnabled(true);
+            client1->detachAll(o1);
+            client2->detachAll(o2);
+        });
+        client1->attachAll(o1);
+        client2->attachAll(o2);
+        // the call goes through the broker: it's awaited by the messaging of the service, not posted by the local transport
+        TheLocalMessaging.setEnabled(false);
+        testservice::impl::TheTestServiceImpl.setCallPriority(TaskPriority::critical);
+        startService();
+        auto const alivePeriod = std::chrono::milliseconds(testservice::impl::TheTestServiceImpl.getAlivePeriod());
+
+        auto connect1 = o1.waitConnectionMsg(2 * alivePeriod);
+        ASSERT_TRUE(connect1.has_value() && connect1.value());
+        auto connect2 = o2.waitConnectionMsg(2 * alivePeriod);
+        ASSERT_TRUE(connect2.has_value() && connect2.value());
+
+        // the call holds the loop of the service longer than the timeout of the stubs: its alive task can't run
+        testservice::impl::TheTestServiceImpl.resetWait();
+        std::thread th([&]() { client1->waitSerialized((alivePeriod * 3).count()); });
+        testservice::impl::TheTestServiceImpl.waitForStartWait();
+        th.join();
+
+        // no deconnection of the stubs, during the call or after
+        connect1 = o1.waitConnectionMsg(2 * alivePeriod);
+        ASSERT_FALSE(connect1.has_value());
+        connect2 = o2.waitConnectionMsg();
+        ASSERT_FALSE(connect2.has_value());
+        ASSERT_TRUE(client1->isConnected());
+        ASSERT_TRUE(client2->isConnected());
+    }
+
+    TEST_F(ServiceSynchro_UT, service_callRejectedByTheFullLoop) {
+        const TestServiceClient client1, client2;
+        TestServiceObserver o;
+        auto const pTaskLoop = testservice::impl::TheTestServiceImpl.getTaskLoop();
+        auto const guard     = core::make_scope_exit([&]() {
+            pTaskLoop->setCapacity(0, TaskQueue::OverflowPolicy::block);
+            testservice::impl::TheTestServiceImpl.setCallPriority({});
+            TheLocalMessaging.setEnabled(true);
+            client2->detachAll(o);
+        });
+        client2->attachAll(o);
+        testservice::impl::TheTestServiceImpl.setCallPriority(TaskPriority::critical);
+        auto const alivePeriod = std::chrono::milliseconds(testservice::impl::TheTestServiceImpl.getAlivePeriod());
+
+        // through the local transport, then through the broker
+        for (auto const bLocal : { true, false }) {
+            TheLocalMessaging.setEnabled(bLocal);
+            startService();
+            auto const connect = o.waitConnectionMsg(2 * alivePeriod);
+            ASSERT_TRUE(connect.has_value() && connect.value());
+
+            // the call holds the loop and the alive task is pending: the loop is full
+            testservice::impl::TheTestServiceImpl.resetWait();
+            std::thread th([&]() { client1->waitSerialized(alivePeriod.count()); });
+            testservice::impl::TheTestServiceImpl.waitForStartWait();
+            pTaskLoop->setCapacity(1, TaskQueue::OverflowPolicy::dropNewest);
+
+            // the rejected call fails at once instead of staying unanswered
+            auto const start = std::chrono::steady_clock::now();
+            EXPECT_THROW(client2->getPosition(), ServiceException);
+            EXPECT_LT(std::chrono::steady_clock::now() - start, alivePeriod);
+
+            pTaskLoop->setCapacity(0, TaskQueue::OverflowPolicy::block);
+            th.join();
+            stopService();
+            o.waitConnectionMsg(2 * alivePeriod);
+        }
+    }
+
+    TEST_F(ServiceSynchro_UT, service_negotiateEncoding) {
+        const TestServiceClient client;
+        TestServiceObserver o;
+        auto const guard = core::make_scope_exit([&]() {
+            stopService();
+            client->detachAll(o);
+        });
+        client->attachAll(o);
+        startService();
+        auto const alivePeriod = std::chrono::milliseconds(testservice::impl::TheTestServiceImpl.getAlivePeriod());
+
+        auto const connect = o.waitConnectionMsg(2 * alivePeriod);
+        ASSERT_TRUE(connect.has_value() && connect.value());
+
+        // the test service is generated without encoding: json
+        ASSERT_EQ(ServiceEncoding::json, testservice::impl::TheTestServiceImpl.getWireEncoding());
+        ASSERT_EQ(ServiceEncoding::json, client.getStub()->getWireEncoding());
+        ASSERT_EQ(testservice::impl::TheTestServiceImpl.getText(), client->getText());
+    }
+
+    TEST_F(ServiceSynchro_UT, service_msgpackEncoding) {
+        testservice::impl::TheTestServiceImpl.setEncoding(ServiceEncoding::msgpack);
+        TheLocalMessaging.setEnabled(false); // the payloads go through the broker
+
+        const TestServiceClient client(ServiceEncoding::msgpack), jsonClient;
+        TestServiceObserver o;
+        auto const guard = core::make_scope_exit([&]() {
+            stopService();
+            testservice::impl::TheTestServiceImpl.setEncoding(ServiceEncoding::json);
+            TheLocalMessaging.setEnabled(true);
+            client->detachAll(o);
+        });
+        client->attachAll(o);
+        startService();
+        auto const alivePeriod = std::chrono::milliseconds(testservice::impl::TheTestServiceImpl.getAlivePeriod());
+
+        auto const connect = o.waitConnectionMsg(2 * alivePeriod);
+        ASSERT_TRUE(connect.has_value() && connect.value());
+
+        // the negotiation follows the connection on the loop of the stub
+        auto const deadline = std::chrono::steady_clock::now() + 2 * alivePeriod;
+        while (client.getStub()->getWireEncoding() != ServiceEncoding::msgpack && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(10ms);
+        }
+        ASSERT_EQ(ServiceEncoding::msgpack, testservice::impl::TheTestServiceImpl.getWireEncoding());
+        ASSERT_EQ(ServiceEncoding::msgpack, client.getStub()->getWireEncoding());
+
+        ASSERT_EQ("test", client->getText());
+        testservice::api::Position position;
+        position.x     = 1.5;
+        position.label = "msgpack";
+        client->setPositions({ position, position }, testservice::api::EPosition::Absolute);
+        auto const positions = client->getPositions();
+        ASSERT_EQ(2, positions.size());
+        ASSERT_EQ(1.5, positions.back().x);
+        ASSERT_EQ("msgpack", positions.back().label);
+
+        // a json stub of the msgpack impl: its requests and the replies stay in json
+        ASSERT_EQ(ServiceEncoding::json, jsonClient.getStub()->getWireEncoding());
+        ASSERT_EQ("msgpack", jsonClient->getPosition().label);
+    }
+
     TEST_F(ServiceSynchro_UT, service_publishEvent) {
         startService();
 
@@ -2,6 +2,7 @@
 #include "BaseService_UT.h"
 #include "testservice.h"
 #include "TestServiceImpl/TestServiceImpl.h"
+#include "osApplication/ServiceStub.h"
 
 using namespace std::chrono_literals;
 
@@ -122,4 +123,103 @@ namespace NS_OSBASE::application::ut {
         ASSERT_TRUE(runtimeError.has_value());
     }
 
+    TEST_F(Service_UT, checkLocalMessaging) {
+        // the impl and the stub live in the same process: calls and events don't go through the broker
+        ASSERT_TRUE(TheLocalMessaging.isEnabled());
+
+        TestServiceObserver o;
+        getStub()->attachAll(o);
+
+        ASSERT_EQ("test", getStub()->getText());
+        ASSERT_TRUE(getStub()->setText("localText", 1, 1.));
+        ASSERT_TRUE(o.waitTextUpdatedMsg().has_value());
+        ASSERT_THROW(getStub()->invokeCrash(testservice::api::sub2::enum1::e1), ServiceException);
+        ASSERT_TRUE(o.waitRuntimeErrorData().has_value());
+        getStub()->detachAll(o);
+    }
+
+    TEST_F(Service_UT, checkCache) {
+        auto const pStub = std::dynamic_pointer_cast<ServiceStub<testservice::api::ITestService>>(getStub());
+        ASSERT_NE(nullptr, pStub);
+        auto const counters = pStub->getCacheCounters();
+
+        // getText is const and cached: one call, then the cache
+        ASSERT_EQ("test", getStub()->getText());
+        ASSERT_EQ("test", getStub()->getText());
+        ASSERT_EQ(counters.nbMisses + 1, pStub->getCacheCounters().nbMisses);
+        ASSERT_EQ(counters.nbHits + 1, pStub->getCacheCounters().nbHits);
+
+        // setText invalidates getText
+        ASSERT_TRUE(getStub()->setText("cachedText", 1, 1.));
+        auto const deadline = std::chrono::steady_clock::now() + getTimeout(1000);
+        while (pStub->getCacheCounters().nbInvalidations == counters.nbInvalidations && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(1ms);
+        }
+        ASSERT_LT(counters.nbInvalidations, pStub->getCacheCounters().nbInvalidations);
+
+        ASSERT_EQ("test", getStub()->getText());
+        ASSERT_EQ(counters.nbMisses + 2, pStub->getCacheCounters().nbMisses);
+    }
+
+    TEST_F(Service_UT, checkBatch) {
+        auto const pBatch = testservice::api::makeBatch(getStub());
+        auto futText      = pBatch->getText();
+        auto futSetText   = pBatch->setText("batchText", 1, 1.);
+        auto futCrash     = pBatch->invokeCrash(testservice::api::sub2::enum1::e1);
+        auto futWait      = pBatch->wait(1); // executed by the dispatcher of the method, waited by the batch
+        auto futLastText  = pBatch->getText();
+
+        // without window: sent by flush() only
+        ASSERT_EQ(std::future_status::timeout, futText.wait_for(getTimeout(100)));
+        pBatch->flush();
+
+        ASSERT_EQ(std::future_status::ready, futLastText.wait_for(getTimeout(1000)));
+        ASSERT_EQ("test", futText.get());
+        ASSERT_TRUE(futSetText.get());
+        ASSERT_THROW(futCrash.get(), ServiceException);
+        ASSERT_NO_THROW(futWait.get());
+        ASSERT_EQ("test", futLastText.get()); // the next calls are executed despite the error
+
+        // with window: sent once the window has elapsed
+        pBatch->setWindow(10ms);
+        auto futWindowText = pBatch->getText();
+        ASSERT_EQ(std::future_status::ready, futWindowText.wait_for(getTimeout(1000)));
+        ASSERT_EQ("test", futWindowText.get());
+    }
+
+    TEST_F(Service_UT, checkBatchTimeout) {
+        auto const guard = nscore::make_scope_exit([this]() { getStub()->setCallTimeout(std::chrono::milliseconds::max()); });
+        getStub()->setCallTimeout(getTimeout(50));
+
+        // the results not received within the call timeout of the stub are failed
+        auto const pBatch = testservice::api::makeBatch(getStub());
+        auto futWait      = pBatch->wait(getTimeout(500).count());
+        auto futText      = pBatch->getText();
+        pBatch->flush();
+
+        ASSERT_EQ(std::future_status::ready, futText.wait_for(getTimeout(250)));
+        ASSERT_THROW(futWait.get(), ServiceException);
+        ASSERT_THROW(futText.get(), ServiceException);
+    }
+
+    TEST_F(Service_UT, checkStream) {
+        constexpr unsigned int nbChunks = 100;
+
+        // the chunks are received in order, the window bounds the chunks written ahead
+        double expectedX  = 0.;
+        auto const stream = getStub()->getPositionChunks(nbChunks);
+        for (auto const &position : *stream) {
+            ASSERT_EQ(expectedX, position.x);
+            expectedX += 1.;
+        }
+        ASSERT_EQ(static_cast<double>(nbChunks), expectedX);
+        ASSERT_FALSE(stream->next().has_value());
+
+        // cancelled by the reader
+        auto const cancelledStream = getStub()->getPositionChunks(nbChunks);
+        ASSERT_EQ(0., cancelledStream->next()->x);
+        cancelledStream->cancel();
+        ASSERT_FALSE(cancelledStream->next().has_value());
+    }
+
 } // namespace NS_OSBASE::application::ut
@@ -0,0 +1,241 @@
+// osBase package
+#include "osApplication/TaskLoopPool.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <set>
+
+using namespace NS_OSBASE::application;
+
+namespace NS_OSBASE::application::ut {
+
+    class TaskLoopPool_UT : public testing::Test {
+    protected:
+        static constexpr std::chrono::milliseconds getTimeout(unsigned int timeout) {
+            return std::chrono::milliseconds(timeout * TIMEOUT_FACTOR);
+        }
+    };
+
+    TEST_F(TaskLoopPool_UT, makeStrand) {
+        auto const pPool   = TaskLoopPool::create(2);
+        auto const pStrand = pPool->makeStrand();
+
+        ASSERT_EQ(2, pPool->getWorkerCount());
+        ASSERT_TRUE(pStrand->isStrand());
+        ASSERT_FALSE(pStrand->isRunning());
+        ASSERT_FALSE(TaskLoop().isStrand());
+    }
+
+    TEST_F(TaskLoopPool_UT, getShared) {
+        auto pPool1 = TaskLoopPool::getShared();
+        auto pPool2 = TaskLoopPool::getShared();
+
+        // one pool while it is used
+        ASSERT_NE(nullptr, pPool1);
+        ASSERT_EQ(pPool1, pPool2);
+        ASSERT_EQ(std::max<size_t>(std::thread::hardware_concurrency(), 1), pPool1->getWorkerCount());
+
+        pPool1.reset();
+        pPool2.reset();
+        ASSERT_NE(nullptr, TaskLoopPool::getShared());
+    }
+
+    TEST_F(TaskLoopPool_UT, run_stop) {
+        auto const pPool   = TaskLoopPool::create(2);
+        auto const pStrand = pPool->makeStrand();
+
+        int i = 0;
+        pStrand->push([&i]() { i = 1; });
+        pStrand->push([pStrand]() { pStrand->stop(); });
+        pStrand->run();
+
+        ASSERT_EQ(1, i);
+        ASSERT_FALSE(pStrand->isRunning());
+    }
+
+    TEST_F(TaskLoopPool_UT, runAsync_stop) {
+        auto const pPool   = TaskLoopPool::create(2);
+        auto const pStrand = pPool->makeStrand();
+
+        auto const ret = pStrand->runAsync();
+        ASSERT_TRUE(pStrand->isRunning());
+        ASSERT_THROW(pStrand->runAsync(), TaskLoopException);
+
+        pStrand->stop();
+        ret.get();
+        ASSERT_FALSE(pStrand->isRunning());
+    }
+
+    TEST_F(TaskLoopPool_UT, ordering) {
+        auto const pPool = TaskLoopPool::create(4);
+        std::vector<TaskLoopPtr> pStrands;
+        std::vector<std::vector<int>> values(8);
+
+        for (size_t nStrand = 0; nStrand < values.size(); ++nStrand) {
+            pStrands.push_back(pPool->makeStrand());
+            pStrands.back()->runAsync();
+        }
+
+        // push from several threads: each strand must execute its tasks in order, one at a time
+        std::vector<std::thread> producers;
+        for (size_t nStrand = 0; nStrand < values.size(); ++nStrand) {
+            producers.emplace_back([&, nStrand]() {
+                for (int i = 0; i < 1000; ++i) {
+                    pStrands[nStrand]->push([&values, nStrand, i]() { values[nStrand].push_back(i); });
+                }
+            });
+        }
+
+        for (auto &producer : producers) {
+            producer.join();
+        }
+
+        for (auto const &pStrand : pStrands) {
+            pStrand->stop();
+        }
+
+        for (auto const &strandValues : values) {
+            ASSERT_EQ(1000, strandValues.size());
+            for (int i = 0; i < 1000; ++i) {
+                ASSERT_EQ(i, strandValues[i]);
+            }
+        }
+    }
+
+    TEST_F(TaskLoopPool_UT, parallel) {
+        auto const pPool    = TaskLoopPool::create(2);
+        auto const pStrand1 = pPool->makeStrand();
+        auto const pStrand2 = pPool->makeStrand();
+        pStrand1->runAsync();
+        pStrand2->runAsync();
+
+        // the strand 1 is blocked until the strand 2 executes its task
+        std::promise<void> strand2Executed;
+        auto fut1 = std::async([&]() {
+            std::promise<void> strand1Executed;
+            pStrand1->push([&]() {
+                strand2Executed.get_future().wait();
+                strand1Executed.set_value();
+            });
+            pStrand2->push([&]() { strand2Executed.set_value(); });
+            return strand1Executed.get_future().wait_for(getTimeout(1000));
+        });
+
+        ASSERT_EQ(std::future_status::ready, fut1.get());
+
+        pStrand1->stop();
+        pStrand2->stop();
+    }
+
+    TEST_F(TaskLoopPool_UT, stop_byAnotherStrand) {
+        auto const pPool    = TaskLoopPool::create(1);
+        auto const pStrand1 = pPool->makeStrand();
+        auto const pStrand2 = pPool->makeStrand();
+        pStrand1->runAsync();
+        auto const end2 = pStrand2->runAsync();
+
+        // the only worker waits for the end of the strand 2: it executes the strand 2 meanwhile
+        int i = 0;
+        std::promise<void> stopped;
+        pStrand2->push([&i]() { i = 1; });
+        pStrand1->push([&]() {
+            pStrand2->stop();
+            stopped.set_value();
+        });
+
+        ASSERT_EQ(std::future_status::ready, stopped.get_future().wait_for(getTimeout(1000)));
+        ASSERT_EQ(std::future_status::ready, end2.wait_for(std::chrono::milliseconds::zero()));
+        ASSERT_EQ(1, i);
+        ASSERT_FALSE(pStrand2->isRunning());
+        ASSERT_TRUE(pStrand1->isRunning());
+
+        pStrand1->stop();
+    }
+
+    TEST_F(TaskLoopPool_UT, pushSingleShot) {
+        auto const pPool   = TaskLoopPool::create(2);
+        auto const pStrand = pPool->makeStrand();
+
+        int i            = 0;
+        auto const start = TaskLoop::clock::now();
+        pStrand->pushSingleShot(getTimeout(200), [pStrand] { pStrand->stop(); });
+        pStrand->pushSingleShot(
+            getTimeout(10), [&i](int val) { i = val; }, 3);
+        pStrand->pushSingleShot(
+            getTimeout(500), [&i](int val) { i = val; }, 4);
+        pStrand->run();
+
+        ASSERT_EQ(3, i);
+        ASSERT_GE(TaskLoop::clock::now() - start, getTimeout(200));
+    }
+
+    TEST_F(TaskLoopPool_UT, pushRepeated) {
+        auto const pPool   = TaskLoopPool::create(2);
+        auto const pStrand = pPool->makeStrand();
+
+        int i                    = 0;
+        auto constexpr delayRep  = getTimeout(70);
+        auto constexpr delayStop = getTimeout(1000);
+        pStrand->pushRepeated(delayRep, [&i]() { ++i; });
+        pStrand->pushSingleShot(delayStop, [pStrand] { pStrand->stop(); });
+        pStrand->run();
+
+        ASSERT_EQ(delayStop / delayRep, i);
+    }
+
+    TEST_F(TaskLoopPool_UT, multipleProducers) {
+        auto const pPool   = TaskLoopPool::create(2);
+        auto const pStrand = pPool->makeStrand();
+        pStrand->runAsync();
+
+        // bursts through the lock-free intake, the strand drains and goes idle meanwhile: no wake-up lost
+        constexpr int nbProducers = 4;
+        constexpr int nbTasks     = 10000;
+        std::vector<std::vector<int>> values(nbProducers);
+        std::atomic_int nbExecuted = 0;
+        std::vector<std::thread> producers;
+        for (int nProducer = 0; nProducer < nbProducers; ++nProducer) {
+            producers.emplace_back([&, nProducer]() {
+                for (int i = 0; i < nbTasks; ++i) {
+                    auto const task = [&values, &nbExecuted, nProducer, i]() {
+                        values[nProducer].push_back(i);
+                        ++nbExecuted;
+                    };
+                    if (i % 2 == 0) {
+                        pStrand->post(task);
+                    } else {
+                        pStrand->push(task);
+                    }
+                    if (i % 1000 == 0) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+            });
+        }
+
+        for (auto &producer : producers) {
+            producer.join();
+        }
+
+        auto const start = TaskLoop::clock::now();
+        while (nbExecuted < nbProducers * nbTasks && TaskLoop::clock::now() - start < getTimeout(5000)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        pStrand->stop();
+
+        for (auto const &producerValues : values) {
+            ASSERT_EQ(nbTasks, producerValues.size());
+            for (int i = 0; i < nbTasks; ++i) {
+                ASSERT_EQ(i, producerValues[i]);
+            }
+        }
+    }
+
+    TEST_F(TaskLoopPool_UT, run_RuntimeError_without_delegate) {
+        auto const pPool   = TaskLoopPool::create(1);
+        auto const pStrand = pPool->makeStrand();
+
+        pStrand->push([]() { throw core::RuntimeException("error"); });
+        ASSERT_THROW(pStrand->run(), core::RuntimeException);
+        ASSERT_FALSE(pStrand->isRunning());
+    }
+} // namespace NS_OSBASE::application::ut
@@ -0,0 +1,62 @@
+// osBase package
+#include "osApplication/TaskLoopStatistics.h"
+#include "gtest/gtest.h"
+
+using namespace NS_OSBASE::application;
+
+namespace NS_OSBASE::application::ut {
+
+    class TaskLoopStatistics_UT : public testing::Test {};
+
+    TEST_F(TaskLoopStatistics_UT, buckets) {
+        ASSERT_EQ(0, Histogram::getBucketIndex(0));
+        ASSERT_EQ(1, Histogram::getBucketIndex(1));
+        ASSERT_EQ(2, Histogram::getBucketIndex(2));
+        ASSERT_EQ(2, Histogram::getBucketIndex(3));
+        ASSERT_EQ(11, Histogram::getBucketIndex(1024));
+        ASSERT_EQ(Histogram::s_nbBuckets - 1, Histogram::getBucketIndex(UINT64_MAX));
+
+        ASSERT_EQ(0, Histogram::getBucketUpperBound(0));
+        ASSERT_EQ(3, Histogram::getBucketUpperBound(2));
+        ASSERT_EQ(UINT64_MAX, Histogram::getBucketUpperBound(Histogram::s_nbBuckets - 1));
+    }
+
+    TEST_F(TaskLoopStatistics_UT, record) {
+        Histogram histogram;
+        ASSERT_EQ(0, histogram.getCount());
+        ASSERT_EQ(0., histogram.getMean());
+        ASSERT_EQ(0, histogram.getPercentile(50.));
+
+        for (std::uint64_t value = 1; value <= 100; ++value) {
+            histogram.record(value);
+        }
+
+        ASSERT_EQ(100, histogram.getCount());
+        ASSERT_EQ(5050, histogram.getSum());
+        ASSERT_EQ(100, histogram.getMax());
+        ASSERT_DOUBLE_EQ(50.5, histogram.getMean());
+        ASSERT_EQ(63, histogram.getPercentile(50.)); // bucket [32, 63]
+        ASSERT_EQ(100, histogram.getPercentile(99.));
+        ASSERT_EQ(1, histogram.getPercentile(0.));
+        ASSERT_EQ(32, histogram.getBucketCount(6));
+
+        const Histogram copy = histogram;
+        histogram.reset();
+        ASSERT_EQ(0, histogram.getCount());
+        ASSERT_EQ(0, histogram.getMax());
+        ASSERT_EQ(100, copy.getCount());
+    }
+
+    TEST_F(TaskLoopStatistics_UT, tasksPerSecond) {
+        TaskLoopStatistics statistics;
+        ASSERT_EQ(0., statistics.getTasksPerSecond());
+
+        for (int i = 0; i < 50; ++i) {
+            statistics.executionTime.record(1);
+        }
+        statistics.duration = std::chrono::milliseconds(500);
+
+        ASSERT_EQ(50, statistics.getNbTasks());
+        ASSERT_DOUBLE_EQ(100., statistics.getTasksPerSecond());
+    }
+} // namespace NS_OSBASE::application::ut
@@ -242,6 +242,33 @@ namespace NS_OSBASE::application::ut {
         ASSERT_EQ(delayStop / delayRep, i);
     }
 
+    TEST_F(TaskLoop_UT, pushRepeated_dropOldest) {
+        TaskLoop loop;
+        std::vector<int> values;
+        int nbRepetitions = 0;
+
+        loop.setCapacity(2, TaskQueue::OverflowPolicy::dropOldest);
+        loop.pushRepeated(getTimeout(10), [&loop, &nbRepetitions]() {
+            if (++nbRepetitions == 3) {
+                loop.stop();
+            }
+        });
+
+        // the repeated task is the earliest pending one: the full loop drops the other ones
+        std::this_thread::sleep_for(getTimeout(20));
+        for (int i = 1; i < 4; ++i) {
+            loop.push([&values, i]() { values.push_back(i); });
+        }
+        ASSERT_EQ(2, loop.getOverflowCounters().nbDroppedTasks);
+
+        loop.setCapacity(0, TaskQueue::OverflowPolicy::dropOldest);
+        loop.pushSingleShot(getTimeout(1000), [&loop]() { loop.stop(); });
+        loop.run();
+
+        ASSERT_EQ(std::vector<int>({ 3 }), values);
+        ASSERT_EQ(3, nbRepetitions);
+    }
+
     TEST_F(TaskLoop_UT, pushMethod) {
         TaskLoop loop;
         auto const pS = std::make_shared<S>();
@@ -256,6 +283,146 @@ namespace NS_OSBASE::application::ut {
         ASSERT_EQ(2., S::m_retDouble);
     }
 
+    TEST_F(TaskLoop_UT, post) {
+        TaskLoop loop;
+        auto const pS = std::make_shared<S>();
+
+        int i = 0;
+        loop.post([&i](int val) { i = val; }, 1);
+        loop.postMethod(pS, &S::setInt, 2);
+        loop.push([&i]() { ++i; });
+        loop.post([&loop] { loop.stop(); });
+        loop.run();
+
+        // Check no infinite loop
+        ASSERT_EQ(2, i);
+        ASSERT_EQ(2, S::m_retInt);
+    }
+
+    TEST_F(TaskLoop_UT, batch) {
+        TaskLoop loop;
+        loop.setBatchSize(16);
+        ASSERT_EQ(16, loop.getBatchSize());
+
+        std::vector<int> values;
+        for (int i = 0; i < 100; ++i) {
+            loop.post([&values](int val) { values.push_back(val); }, i);
+        }
+        loop.push([&loop]() { loop.pushImmediate([&loop]() { loop.stop(); }); });
+        loop.post([&values]() { values.push_back(-1); });
+        loop.run();
+
+        // the immediate task interrupts the batch: the last task is not executed
+        ASSERT_EQ(100, values.size());
+        for (int i = 0; i < 100; ++i) {
+            ASSERT_EQ(i, values[i]);
+        }
+    }
+
+    TEST_F(TaskLoop_UT, priority) {
+        TaskLoop loop;
+        auto pS = std::make_shared<S>();
+        std::vector<int> values;
+
+        const TaskAttributes background{ TaskPriority::background };
+        loop.post(background, [&values]() { values.push_back(2); });
+        loop.push(background, [&loop]() { loop.stop(); });
+        loop.postMethod({ TaskPriority::critical }, pS, &S::setInt, 1);
+        loop.push([&values]() { values.push_back(S::m_retInt); });
+        loop.push({ TaskPriority::critical }, [&values]() { values.push_back(0); });
+        loop.run();
+
+        ASSERT_EQ(std::vector<int>({ 0, 1, 2 }), values);
+    }
+
+    TEST_F(TaskLoop_UT, pushCoalesced) {
+        TaskLoop loop;
+        std::vector<int> values;
+
+        for (int i = 0; i < 3; ++i) {
+            loop.pushCoalesced("a", [&values, i]() { values.push_back(i); });
+        }
+        loop.pushCoalescedSingleShot("stop", getTimeout(1000), [&values]() { values.push_back(-1); });
+        loop.pushCoalescedSingleShot("stop", getTimeout(10), [&loop]() { loop.stop(); });
+        loop.run();
+
+        ASSERT_EQ(std::vector<int>({ 2 }), values);
+    }
+
+    TEST_F(TaskLoop_UT, statistics) {
+        TaskLoop disabledLoop;
+        ASSERT_FALSE(disabledLoop.isStatisticsEnabled());
+        disabledLoop.post([]() {});
+        disabledLoop.push([&disabledLoop]() { disabledLoop.stop(); });
+        disabledLoop.run();
+        ASSERT_EQ(0, disabledLoop.getStatistics().getNbTasks());
+
+        TaskLoop loop;
+        loop.setStatisticsEnabled(true);
+        ASSERT_TRUE(loop.isStatisticsEnabled());
+        for (int i = 0; i < 10; ++i) {
+            loop.post([]() {});
+        }
+        loop.pushSingleShot(getTimeout(20), [&loop]() { loop.stop(); });
+        loop.run();
+
+        auto const statistics = loop.getStatistics();
+        ASSERT_EQ(11, statistics.getNbTasks());
+        ASSERT_EQ(11, statistics.schedulingDelay.getCount());
+        ASSERT_EQ(11, statistics.queueDepth.getCount());
+        ASSERT_EQ(10, statistics.queueDepth.getMax()); // the 10 other tasks are pending when the first one starts
+        ASSERT_GT(statistics.duration, std::chrono::milliseconds::zero());
+        ASSERT_GT(statistics.getTasksPerSecond(), 0.);
+
+        loop.resetStatistics();
+        ASSERT_EQ(0, loop.getStatistics().getNbTasks());
+    }
+
+    TEST_F(TaskLoop_UT, watchdog) {
+        class StallDelegate : public TaskLoop::IStallDelegate {
+        public:
+            void onStall(const std::string &taskType, const std::chrono::milliseconds &duration) override {
+                const std::lock_guard locker(m_mutex);
+                m_stalls.emplace_back(taskType, duration);
+            }
+
+            std::vector<std::pair<std::string, std::chrono::milliseconds>> getStalls() {
+                const std::lock_guard locker(m_mutex);
+                return m_stalls;
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::vector<std::pair<std::string, std::chrono::milliseconds>> m_stalls;
+        };
+
+        TaskLoop loop;
+        auto const pStallDelegate = std::make_shared<StallDelegate>();
+        auto const threshold      = getTimeout(20);
+        loop.setWatchdog(threshold, pStallDelegate);
+
+        auto const stalledTask = [threshold]() { std::this_thread::sleep_for(threshold * 5); };
+        loop.post([]() {});
+        loop.post(stalledTask);
+        loop.push([&loop]() { loop.stop(); });
+        loop.run();
+
+        // reported once, with the type of the callable
+        auto const stalls = pStallDelegate->getStalls();
+        ASSERT_EQ(1, stalls.size());
+        ASSERT_EQ(typeid(stalledTask).name(), stalls.front().first);
+        ASSERT_GE(stalls.front().second, threshold);
+
+
+        TaskLoop otherLoop;
+        otherLoop.setWatchdog(threshold, pStallDelegate);
+        otherLoop.setWatchdog(threshold, nullptr); // stopped
+        otherLoop.post(stalledTask);
+        otherLoop.push([&otherLoop]() { otherLoop.stop(); });
+        otherLoop.run();
+        ASSERT_EQ(1, pStallDelegate->getStalls().size());
+    }
+
     TEST_F(TaskLoop_UT, pushSingleShotMethod) {
         using namespace std::chrono_literals;
         TaskLoop loop;
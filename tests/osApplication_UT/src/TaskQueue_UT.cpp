@@ -2,6 +2,7 @@
 #include "osApplication/TaskQueue.h"
 #include "osData/Log.h"
 #include "gtest/gtest.h"
+#include <thread>
 
 using namespace NS_OSBASE::application;
 
@@ -203,6 +204,462 @@ namespace NS_OSBASE::application::ut {
         ASSERT_EQ(nullptr, pTask);
     }
 
+    TEST_F(TaskQueue_UT, postTask_pullNextTask) {
+        TaskQueue tq;
+        auto pS   = std::make_shared<S>();
+        int value = 0;
+
+        tq.postTask([&value](int val) { value = val; }, 1);
+        tq.pushTask([&value]() { value = 2; });
+        tq.postMethodTask(pS, &S::setInt, 3);
+        ASSERT_TRUE(tq.isRemainingTasks());
+
+        // same ordering than the pushed tasks
+        auto task = tq.pullNextTask();
+        ASSERT_FALSE(task.empty());
+        task.execute();
+        ASSERT_EQ(1, value);
+
+        task = tq.pullNextTask();
+        ASSERT_FALSE(task.empty());
+        task.execute();
+        ASSERT_EQ(2, value);
+
+        // the posted tasks can also be pulled as ITaskPtr
+        auto const pTask = tq.pullTask();
+        ASSERT_NE(nullptr, pTask);
+        pTask->execute();
+        ASSERT_EQ(3, S::m_ret);
+
+        ASSERT_TRUE(tq.pullNextTask().empty());
+        ASSERT_FALSE(tq.isRemainingTasks());
+    }
+
+    TEST_F(TaskQueue_UT, pullNextTasks) {
+        TaskQueue tq;
+        TaskQueue::Batch batch;
+        std::vector<int> values;
+
+        for (int i = 0; i < 10; ++i) {
+            tq.postTask([&values](int val) { values.push_back(val); }, i);
+        }
+        tq.pushSingleShotTask(getTimeout(1000), []() {});
+
+        // the ready tasks only, up to the max count
+        tq.pullNextTasks(batch, 4);
+        ASSERT_FALSE(batch.empty());
+        while (!batch.empty()) {
+            batch.pop().execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 0, 1, 2, 3 }), values);
+
+        tq.pullNextTasks(batch, 100);
+        while (!batch.empty()) {
+            batch.pop().execute();
+        }
+        ASSERT_EQ(10, values.size());
+        ASSERT_TRUE(tq.isRemainingTasks());
+
+        tq.pullNextTasks(batch, 100);
+        ASSERT_TRUE(batch.empty());
+    }
+
+    TEST_F(TaskQueue_UT, pullNextTasks_pushImmediate) {
+        TaskQueue tq;
+        TaskQueue::Batch batch;
+        std::vector<int> values;
+
+        for (int i = 0; i < 4; ++i) {
+            tq.pushTask([&values, i]() { values.push_back(i); });
+        }
+
+        tq.pullNextTasks(batch, 10);
+        batch.pop().execute();
+
+        // the batch is interrupted: the immediate tasks are executed before its remaining tasks
+        tq.pushImmediateTask([&values](int val) { values.push_back(val); }, 10);
+        tq.pushImmediateTask([&values](int val) { values.push_back(val); }, 11);
+        tq.pushTask([&values](int val) { values.push_back(val); }, 4);
+        ASSERT_TRUE(batch.pop().empty());
+        ASSERT_TRUE(batch.empty());
+
+        while (true) {
+            tq.pullNextTasks(batch, 10);
+            if (batch.empty()) {
+                break;
+            }
+            for (auto task = batch.pop(); !task.empty(); task = batch.pop()) {
+                task.execute();
+            }
+        }
+        ASSERT_EQ(std::vector<int>({ 0, 11, 10, 1, 2, 3, 4 }), values);
+    }
+
+    TEST_F(TaskQueue_UT, pullNextTasks_giveBack) {
+        TaskQueue tq;
+        std::vector<int> values;
+
+        for (int i = 0; i < 4; ++i) {
+            tq.pushTask([&values, i]() { values.push_back(i); });
+        }
+
+        {
+            TaskQueue::Batch batch;
+            tq.pullNextTasks(batch, 10);
+            batch.pop().execute();
+        }
+
+        // the remaining tasks are given back in the same order
+        for (auto pTask = tq.pullTask(); pTask != nullptr; pTask = tq.pullTask()) {
+            pTask->execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 0, 1, 2, 3 }), values);
+    }
+
+    TEST_F(TaskQueue_UT, postTask_fullIntake) {
+        TaskQueue tq;
+        std::vector<int> values;
+
+        // more than the capacity of the lock-free intake: the order is kept
+        for (int i = 0; i < 1000; ++i) {
+            if (i % 3 == 0) {
+                tq.pushTask([&values, i]() { values.push_back(i); });
+            } else {
+                tq.postTask([&values](int val) { values.push_back(val); }, i);
+            }
+        }
+
+        for (auto task = tq.pullNextTask(); !task.empty(); task = tq.pullNextTask()) {
+            task.execute();
+        }
+
+        ASSERT_EQ(1000, values.size());
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQ(i, values[i]);
+        }
+    }
+
+    TEST_F(TaskQueue_UT, postTask_wakeUp) {
+        TaskQueue tq;
+        int value = 0;
+
+        // the waiting consumer is woken up by a push from another thread
+        auto const start = TaskQueue::clock::now();
+        std::thread producer([&tq, &value]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            tq.postTask([&value]() { value = 1; });
+        });
+
+        auto task = tq.waitForNextTask(getTimeout(5000));
+        producer.join();
+
+        ASSERT_FALSE(task.empty());
+        task.execute();
+        ASSERT_EQ(1, value);
+        ASSERT_LT(TaskQueue::clock::now() - start, getTimeout(5000));
+    }
+
+    TEST_F(TaskQueue_UT, priority) {
+        TaskQueue tq;
+        std::vector<int> values;
+
+        tq.pushTask({ TaskPriority::background }, [&values]() { values.push_back(3); });
+        tq.postTask([&values]() { values.push_back(2); });
+        tq.pushTask({ TaskPriority::critical }, [&values]() { values.push_back(1); });
+        tq.pushImmediateTask([&values]() { values.push_back(0); });
+
+        for (auto task = tq.pullNextTask(); !task.empty(); task = tq.pullNextTask()) {
+            task.execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 0, 1, 2, 3 }), values);
+    }
+
+    TEST_F(TaskQueue_UT, priority_starvation) {
+        TaskQueue tq;
+        std::vector<int> values;
+
+        auto const nbCriticals = static_cast<int>(2 * TaskQueue::s_starvationLimit);
+        for (int i = 0; i < nbCriticals; ++i) {
+            tq.postTask({ TaskPriority::critical }, [&values, i]() { values.push_back(i); });
+        }
+        tq.postTask({ TaskPriority::background }, [&values]() { values.push_back(-1); });
+
+        for (auto task = tq.pullNextTask(); !task.empty(); task = tq.pullNextTask()) {
+            task.execute();
+        }
+
+        // the background task is executed after s_starvationLimit critical tasks, not after all of them
+        ASSERT_EQ(nbCriticals + 1, values.size());
+        ASSERT_EQ(-1, values[TaskQueue::s_starvationLimit]);
+    }
+
+    TEST_F(TaskQueue_UT, deadline) {
+        using namespace std::chrono_literals;
+        TaskQueue tq;
+        TaskQueue::Batch batch;
+        std::vector<int> values;
+
+        tq.postTask([&values]() { values.push_back(3); });
+        tq.postTask({ TaskPriority::normal, 500ms }, [&values]() { values.push_back(2); });
+        tq.postTask({ TaskPriority::normal, 100ms }, [&values]() { values.push_back(0); });
+        tq.pushTask({ TaskPriority::normal, 100ms }, [&values]() { values.push_back(1); });
+
+        // earliest deadline first, then the tasks without deadline
+        tq.pullNextTasks(batch, 10);
+        while (!batch.empty()) {
+            batch.pop().execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 0, 1, 2, 3 }), values);
+    }
+
+    TEST_F(TaskQueue_UT, deadline_singleShot) {
+        TaskQueue tq;
+        std::vector<int> values;
+
+        auto constexpr delay = getTimeout(50);
+        tq.pushSingleShotTask({ TaskPriority::normal, std::chrono::milliseconds::zero() }, delay, [&values]() { values.push_back(1); });
+        tq.pushTask([&values]() { values.push_back(0); });
+
+        // a task with a deadline is not executed before its timestamp
+        for (auto task = tq.pullNextTask(); !task.empty(); task = tq.pullNextTask()) {
+            task.execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 0 }), values);
+        ASSERT_TRUE(tq.isRemainingTasks());
+        ASSERT_LE(tq.getNextTimeStamp(), TaskQueue::clock::now() + delay);
+
+        auto task = tq.waitForNextTask(getTimeout(5000));
+        ASSERT_FALSE(task.empty());
+        task.execute();
+        ASSERT_EQ(std::vector<int>({ 0, 1 }), values);
+    }
+
+    TEST_F(TaskQueue_UT, pullNextTasks_pushCritical) {
+        TaskQueue tq;
+        TaskQueue::Batch batch;
+        std::vector<int> values;
+
+        for (int i = 0; i < 4; ++i) {
+            tq.postTask([&values, i]() { values.push_back(i); });
+        }
+
+        tq.pullNextTasks(batch, 10);
+        batch.pop().execute();
+
+        // the batch is interrupted by a critical task
+        tq.postTask({ TaskPriority::critical }, [&values]() { values.push_back(10); });
+        ASSERT_TRUE(batch.pop().empty());
+
+        for (auto task = tq.pullNextTask(); !task.empty(); task = tq.pullNextTask()) {
+            task.execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 0, 10, 1, 2, 3 }), values);
+    }
+
+    TEST_F(TaskQueue_UT, capacity_dropNewest) {
+        TaskQueue tq;
+        std::vector<int> values;
+
+        tq.setCapacity(2, TaskQueue::OverflowPolicy::dropNewest);
+        ASSERT_EQ(2, tq.getCapacity());
+        ASSERT_EQ(TaskQueue::OverflowPolicy::dropNewest, tq.getOverflowPolicy());
+
+        tq.postTask([&values]() { values.push_back(0); });
+        ASSERT_NE(nullptr, tq.pushTask([&values]() { values.push_back(1); }));
+        ASSERT_EQ(nullptr, tq.pushTask([&values]() { values.push_back(2); }));
+        tq.postTask([&values]() { values.push_back(3); });
+        ASSERT_EQ(2, tq.getNbTasks());
+
+        for (auto task = tq.pullNextTask(); !task.empty(); task = tq.pullNextTask()) {
+            task.execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 0, 1 }), values);
+        ASSERT_EQ(0, tq.getNbTasks());
+        ASSERT_EQ(2, tq.getOverflowCounters().nbRejectedTasks);
+        ASSERT_EQ(0, tq.getOverflowCounters().nbDroppedTasks);
+    }
+
+    TEST_F(TaskQueue_UT, capacity_dropOldest) {
+        TaskQueue tq;
+        std::vector<int> values;
+
+        tq.setCapacity(3, TaskQueue::OverflowPolicy::dropOldest);
+        tq.postTask({ TaskPriority::critical }, [&values]() { values.push_back(0); });
+        for (int i = 1; i < 5; ++i) {
+            tq.postTask([&values, i]() { values.push_back(i); });
+        }
+
+        // a background task can't drop the tasks of the upper lanes
+        tq.postTask({ TaskPriority::background }, [&values]() { values.push_back(5); });
+
+        for (auto task = tq.pullNextTask(); !task.empty(); task = tq.pullNextTask()) {
+            task.execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 0, 3, 4 }), values);
+        ASSERT_EQ(1, tq.getOverflowCounters().nbRejectedTasks);
+        ASSERT_EQ(2, tq.getOverflowCounters().nbDroppedTasks);
+    }
+
+    TEST_F(TaskQueue_UT, capacity_dropOldest_insertionOrder) {
+        TaskQueue tq;
+        std::vector<int> values;
+
+        tq.setCapacity(3, TaskQueue::OverflowPolicy::dropOldest);
+        tq.pushSingleShotTask(std::chrono::hours(1), [&values]() { values.push_back(0); });
+        tq.pushTask([&values]() { values.push_back(1); });
+        tq.pushTask([&values]() { values.push_back(2); });
+
+        // the first pushed ready tasks are dropped: not the delayed task, nor the immediate task ahead of the others
+        ASSERT_NE(nullptr, tq.pushImmediateTask([&values]() { values.push_back(3); }));
+        ASSERT_NE(nullptr, tq.pushTask([&values]() { values.push_back(4); }));
+
+        for (auto task = tq.pullNextTask(); !task.empty(); task = tq.pullNextTask()) {
+            task.execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 3, 4 }), values);
+        ASSERT_EQ(1, tq.getNbTasks());
+        ASSERT_EQ(2, tq.getOverflowCounters().nbDroppedTasks);
+    }
+
+    TEST_F(TaskQueue_UT, capacity_coalesce) {
+        TaskQueue tq;
+        std::vector<int> values;
+
+        tq.setCapacity(2, TaskQueue::OverflowPolicy::coalesce);
+        auto const push = [&tq, &values](const std::string &key, const int value) {
+            return tq.pushTask(
+                { TaskPriority::normal, std::chrono::milliseconds::max(), key }, [&values, value]() { values.push_back(value); });
+        };
+
+        ASSERT_NE(nullptr, push("a", 0));
+        ASSERT_NE(nullptr, push("b", 1));
+        ASSERT_NE(nullptr, push("a", 2));
+        ASSERT_EQ(nullptr, push("c", 3));
+        ASSERT_NE(nullptr, push("b", 4));
+
+        // the last task of each key, at the place of the first one
+        for (auto pTask = tq.pullTask(); pTask != nullptr; pTask = tq.pullTask()) {
+            pTask->execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 2, 4 }), values);
+        ASSERT_EQ(1, tq.getOverflowCounters().nbRejectedTasks);
+        ASSERT_EQ(2, tq.getOverflowCounters().nbDroppedTasks);
+    }
+
+    TEST_F(TaskQueue_UT, capacity_block) {
+        TaskQueue tq;
+        std::atomic_int nbPushed = 0;
+
+        tq.setCapacity(2, TaskQueue::OverflowPolicy::block);
+        for (int i = 0; i < 4; ++i) {
+            tq.postTask([]() {}); // the creator of the queue is never blocked
+        }
+
+        std::thread producer([&tq, &nbPushed]() {
+            tq.postTask([]() {});
+            ++nbPushed;
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ASSERT_EQ(0, nbPushed);
+
+        // the producer waits until the queue is not full anymore
+        for (int i = 0; i < 3; ++i) {
+            tq.pullNextTask().execute();
+        }
+        producer.join();
+        ASSERT_EQ(1, nbPushed);
+        ASSERT_EQ(2, tq.getNbTasks());
+        ASSERT_EQ(1, tq.getOverflowCounters().nbBlockedPushes);
+    }
+
+    TEST_F(TaskQueue_UT, pushCoalescedTask) {
+        TaskQueue tq;
+        std::vector<int> values;
+        auto const push = [&tq, &values](const std::string &key, const int value) {
+            return tq.pushCoalescedTask(key, [&values, value]() { values.push_back(value); });
+        };
+
+        auto const pTaskA = push("a", 0);
+        push("b", 1);
+        ASSERT_EQ(pTaskA, push("a", 2));
+        push("", 3); // no key: not coalesced
+        ASSERT_EQ(3, tq.getNbTasks());
+
+        // the last task of the key, at the place of the first one
+        auto pTask = tq.pullTask();
+        ASSERT_NE(nullptr, pTask);
+        ASSERT_NE(pTaskA, push("a", 4)); // the pulled task is not modified anymore
+        pTask->execute();
+
+        for (pTask = tq.pullTask(); pTask != nullptr; pTask = tq.pullTask()) {
+            pTask->execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 2, 1, 3, 4 }), values);
+    }
+
+    TEST_F(TaskQueue_UT, pushCoalescedSingleShotTask) {
+        TaskQueue tq;
+        std::vector<int> values;
+        auto constexpr delay = getTimeout(50);
+
+        tq.pushCoalescedSingleShotTask("a", delay, [&values]() { values.push_back(0); });
+        std::this_thread::sleep_for(delay / 2);
+        auto const start = TaskQueue::clock::now();
+        tq.pushCoalescedSingleShotTask("a", delay, [&values]() { values.push_back(1); });
+
+        // debounce: executed once, after the delay since the last push
+        while (values.empty()) {
+            auto const pTask = tq.waitForTask(getTimeout(1000));
+            ASSERT_NE(nullptr, pTask);
+            pTask->execute();
+        }
+        ASSERT_GE(TaskQueue::clock::now() - start, delay);
+        ASSERT_EQ(std::vector<int>({ 1 }), values);
+        ASSERT_EQ(nullptr, tq.pullTask());
+    }
+
+    TEST_F(TaskQueue_UT, pushCoalescedRepeatedTask) {
+        TaskQueue tq;
+        std::vector<int> values;
+        auto constexpr delay = getTimeout(20);
+
+        auto const pTask = tq.pushCoalescedRepeatedTask("a", delay, [&values]() { values.push_back(0); });
+        for (int i = 1; i < 4; ++i) {
+            // throttle: the repeated task executes the last pushed callback
+            ASSERT_EQ(pTask, tq.pushCoalescedRepeatedTask("a", delay, [&values, i]() { values.push_back(i); }));
+        }
+        ASSERT_EQ(1, tq.getNbTasks());
+
+        tq.waitForNextTask(getTimeout(1000)).execute();
+        tq.pushCoalescedRepeatedTask("a", delay, [&values]() { values.push_back(4); });
+        tq.waitForNextTask(getTimeout(1000)).execute();
+        ASSERT_EQ(std::vector<int>({ 3, 4 }), values);
+
+        // the cancellation of the task releases the key
+        pTask->setEnabled(false);
+        ASSERT_NE(pTask, tq.pushCoalescedRepeatedTask("a", delay, []() {}));
+    }
+
+    TEST_F(TaskQueue_UT, pushCoalescedTask_capacity) {
+        TaskQueue tq;
+        std::vector<int> values;
+
+        tq.setCapacity(1, TaskQueue::OverflowPolicy::dropNewest);
+        tq.pushCoalescedTask("a", [&values]() { values.push_back(0); });
+        ASSERT_EQ(nullptr, tq.pushTask([&values]() { values.push_back(1); }));
+
+        // a replacement doesn't take any place
+        ASSERT_NE(nullptr, tq.pushCoalescedTask("a", [&values]() { values.push_back(2); }));
+        ASSERT_EQ(nullptr, tq.pushCoalescedTask("b", [&values]() { values.push_back(3); }));
+
+        for (auto pTask = tq.pullTask(); pTask != nullptr; pTask = tq.pullTask()) {
+            pTask->execute();
+        }
+        ASSERT_EQ(std::vector<int>({ 2 }), values);
+        ASSERT_EQ(0, tq.getNbTasks());
+    }
+
     TEST_F(TaskQueue_UT, pushImmediatMethodTask) {
         TaskQueue tq;
         auto pS = std::make_shared<S>();
@@ -0,0 +1,154 @@
+// osBase package
+#include "osApplication/TimingWheel.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+
+using namespace NS_OSBASE::application;
+
+namespace NS_OSBASE::application::ut {
+
+    class TimingWheel_UT : public testing::Test {
+    protected:
+        static TimingWheel::Entry makeEntry(const TimingWheel::time_point &timestamp, const int id) {
+            return TimingWheel::Entry{ timestamp, makeTask([](int) {}, id), std::chrono::milliseconds::min() };
+        }
+    };
+
+    TEST_F(TimingWheel_UT, push_pop) {
+        using namespace std::chrono_literals;
+        TimingWheel wheel;
+        auto const now = TimingWheel::clock::now();
+
+        ASSERT_TRUE(wheel.empty());
+
+        auto const pTask1 = makeTask([]() {});
+        auto const pTask2 = makeTask([]() {});
+        auto const pTask3 = makeTask([]() {});
+        wheel.push({ now + 10s, pTask1, 0ms });
+        wheel.push({ now, pTask2, 0ms });
+        wheel.push({ now + 1h, pTask3, 0ms });
+        ASSERT_EQ(3, wheel.size());
+
+        ASSERT_EQ(pTask2, wheel.top().pTask);
+        ASSERT_EQ(pTask2, wheel.pop().pTask);
+        ASSERT_EQ(pTask1, wheel.pop().pTask);
+        ASSERT_EQ(pTask3, wheel.pop().pTask);
+        ASSERT_TRUE(wheel.empty());
+    }
+
+    TEST_F(TimingWheel_UT, sameTimestamp) {
+        using namespace std::chrono_literals;
+        TimingWheel wheel;
+        auto const timestamp = TimingWheel::clock::now() + 5s;
+
+        std::vector<ITaskPtr> pTasks;
+        for (int i = 0; i < 100; ++i) {
+            pTasks.push_back(makeTask([]() {}));
+            wheel.push({ timestamp, pTasks.back(), 0ms });
+        }
+
+        for (auto const &pTask : pTasks) {
+            ASSERT_EQ(pTask, wheel.pop().pTask);
+        }
+        ASSERT_TRUE(wheel.empty());
+    }
+
+    TEST_F(TimingWheel_UT, randomOrder) {
+        using namespace std::chrono_literals;
+        TimingWheel wheel;
+        auto const now = TimingWheel::clock::now();
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<long long> delayDistribution(-1000, 24 * 3600 * 1000);
+
+        std::vector<TimingWheel::time_point> timestamps;
+        for (int i = 0; i < 10000; ++i) {
+            timestamps.push_back(now + std::chrono::milliseconds(delayDistribution(generator)));
+            wheel.push(makeEntry(timestamps.back(), i));
+
+            // interleave some removals
+            if (i % 10 == 0) {
+                std::sort(timestamps.begin(), timestamps.end());
+                ASSERT_EQ(timestamps.front(), wheel.pop().timestamp);
+                timestamps.erase(timestamps.begin());
+            }
+        }
+
+        std::sort(timestamps.begin(), timestamps.end());
+        ASSERT_EQ(timestamps.size(), wheel.size());
+        for (auto const &timestamp : timestamps) {
+            ASSERT_EQ(timestamp, wheel.top().timestamp);
+            ASSERT_EQ(timestamp, wheel.pop().timestamp);
+        }
+        ASSERT_TRUE(wheel.empty());
+    }
+
+    TEST_F(TimingWheel_UT, findIf) {
+        using namespace std::chrono_literals;
+        TimingWheel wheel;
+        auto const now = TimingWheel::clock::now();
+
+        auto const pTask1 = makeTask([]() {});
+        auto const pTask2 = makeTask([]() {});
+        wheel.push({ now, pTask1, 0ms });
+        wheel.push({ now + 10h, pTask2, 0ms });
+
+        // in the heap and in the wheel
+        auto const isTask = [](const ITaskPtr &pTask) { return [pTask](const TimingWheel::Entry &entry) { return entry.pTask == pTask; }; };
+        ASSERT_NE(nullptr, wheel.findIf(isTask(pTask1)));
+        ASSERT_NE(nullptr, wheel.findIf(isTask(pTask2)));
+        ASSERT_EQ(nullptr, wheel.findIf(isTask(nullptr)));
+
+        wheel.findIf(isTask(pTask2))->pTask = pTask1;
+        wheel.pop();
+        ASSERT_EQ(pTask1, wheel.pop().pTask);
+    }
+
+    TEST_F(TimingWheel_UT, findFirstIf_extract) {
+        using namespace std::chrono_literals;
+        TimingWheel wheel;
+        auto const now = TimingWheel::clock::now();
+
+        // in the heap, in the wheel and beyond the last level
+        auto const pTask1 = makeTask([]() {});
+        auto const pTask2 = makeTask([]() {});
+        auto const pTask3 = makeTask([]() {});
+        auto const pTask4 = makeTask([]() {});
+        wheel.push({ now, pTask1, 0ms });
+        wheel.push({ now + 10h, pTask2, 0ms });
+        wheel.push({ now + 24h * 365, pTask3, 0ms });
+        wheel.push({ now + 1s, pTask4, 0ms });
+
+        auto const isNotTask = [](const ITaskPtr &pTask) {
+            return [pTask](const TimingWheel::Entry &entry) { return entry.pTask != pTask; };
+        };
+        ASSERT_EQ(pTask1, wheel.findFirstIf(isNotTask(nullptr))->pTask);
+        ASSERT_EQ(pTask2, wheel.findFirstIf(isNotTask(pTask1))->pTask);
+        ASSERT_EQ(nullptr, wheel.findFirstIf([](const TimingWheel::Entry &) { return false; }));
+
+        ASSERT_EQ(pTask2, wheel.extract(wheel.findFirstIf(isNotTask(pTask1))).pTask);
+        ASSERT_EQ(pTask4, wheel.extract(wheel.findIf([&pTask4](const TimingWheel::Entry &entry) { return entry.pTask == pTask4; })).pTask);
+        ASSERT_EQ(pTask1, wheel.extract(wheel.findFirstIf(isNotTask(nullptr))).pTask);
+        ASSERT_EQ(1, wheel.size());
+        ASSERT_EQ(pTask3, wheel.pop().pTask);
+        ASSERT_TRUE(wheel.empty());
+    }
+
+    TEST_F(TimingWheel_UT, clear) {
+        using namespace std::chrono_literals;
+        TimingWheel wheel;
+        auto const now = TimingWheel::clock::now();
+
+        wheel.push(makeEntry(now, 1));
+        wheel.push(makeEntry(now + 1min, 2));
+        wheel.push(makeEntry(now + 24h * 365, 3));
+        ASSERT_EQ(3, wheel.size());
+
+        wheel.clear();
+        ASSERT_TRUE(wheel.empty());
+
+        wheel.push(makeEntry(now + 1s, 4));
+        ASSERT_EQ(now + 1s, wheel.pop().timestamp);
+        ASSERT_TRUE(wheel.empty());
+    }
+} // namespace NS_OSBASE::application::ut
@@ -0,0 +1,101 @@
+// \brief Declaration of the unit tests for MessagePack stream
+#include "osCore/Serialization/KeyStream.h"
+#include "osCoreImpl_UT/KeyTypes.h"
+#include "osCore_UT/ConstantValue.h"
+#include "gtest/gtest.h"
+#include <sstream>
+
+namespace NS_OSBASE::core::impl::ut {
+
+    class MsgPack_UT : public testing::Test {
+    protected:
+        static KeyStreamPtr<std::string> reload(const KeyStream<std::string> &keyStream) {
+            auto const buffer = keyStream.getBuffer();
+            return makeMsgPackStream(std::istringstream(std::string(buffer.cbegin(), buffer.cend())));
+        }
+    };
+    template <typename T>
+    class MsgPackTyped_UT : public MsgPack_UT {};
+
+    using value_types = testing::Types<bool, int, double, std::wstring>;
+    TYPED_TEST_SUITE(MsgPackTyped_UT, value_types);
+
+    TEST_F(MsgPack_UT, create) {
+        ASSERT_NE(nullptr, makeMsgPackStream());
+        ASSERT_NE(nullptr, makeMsgPackStream(std::istringstream("")));
+    }
+
+    TYPED_TEST(MsgPackTyped_UT, value) {
+        auto const pStream           = makeMsgPackStream();
+        const TypeParam defaultValue = core::ut::ConstantValue<TypeParam, 0>::getValue();
+
+        pStream->createKey("values");
+        ASSERT_TRUE(pStream->setKeyValue(KeyType<TypeParam>::getKey(), KeyType<TypeParam>::getValue()));
+
+        auto const pLoadedStream = MsgPack_UT::reload(*pStream);
+        ASSERT_FALSE(pLoadedStream->openKey("values").isNull());
+        ASSERT_EQ(KeyType<TypeParam>::getValue(), pLoadedStream->getKeyValue(KeyType<TypeParam>::getKey(), defaultValue));
+    }
+
+    TYPED_TEST(MsgPackTyped_UT, values) {
+        using TypeParams              = std::vector<TypeParam>;
+        auto const pStream            = makeMsgPackStream();
+        const TypeParams defaultValue = core::ut::ConstantValue<TypeParam[], 0>::getValue();
+
+        pStream->createKey("values");
+        ASSERT_TRUE(pStream->setKeyValue(KeyType<TypeParam>::getKeys(), KeyType<TypeParam>::getValues()));
+
+        auto const pLoadedStream = MsgPack_UT::reload(*pStream);
+        ASSERT_FALSE(pLoadedStream->openKey("values").isNull());
+        ASSERT_EQ(KeyType<TypeParam>::getValues(), pLoadedStream->getKeyValue(KeyType<TypeParam>::getKeys(), defaultValue));
+    }
+
+    TEST_F(MsgPack_UT, numbers) {
+        const std::vector<int> ints       = { 0, 1, -1, -32, -33, 127, 128, 255, 256, 65535, 65536, -65536, 2147483647, -2147483647 - 1 };
+        const std::vector<double> doubles = { 0., -0.5, 1e-300, 1e300, 3. };
+        auto const pStream                = makeMsgPackStream();
+
+        pStream->setKeyValue("ints", ints);
+        pStream->setKeyValue("doubles", doubles);
+
+        auto const pLoadedStream = reload(*pStream);
+        ASSERT_EQ(ints, pLoadedStream->getKeyValue("ints", std::vector<int>{}));
+        ASSERT_EQ(doubles, pLoadedStream->getKeyValue("doubles", std::vector<double>{}));
+    }
+
+    TEST_F(MsgPack_UT, compact) {
+        const std::vector<double> doubles(64, 0.123456789012345);
+        auto const pJsonStream    = makeJsonStream();
+        auto const pMsgPackStream = makeMsgPackStream();
+
+        pJsonStream->setKeyValue("doubles", doubles);
+        pMsgPackStream->setKeyValue("doubles", doubles);
+
+        // 9 bytes per double instead of the text representation
+        ASSERT_LT(pMsgPackStream->getBuffer().size(), pJsonStream->getBuffer().size() / 2);
+    }
+
+    TEST_F(MsgPack_UT, whitespaceFirstByte) {
+        auto const pStream = makeMsgPackStream();
+        pStream->setValue(9); // encoded as the single byte 0x09 ('\t')
+
+        ASSERT_EQ(9, reload(*pStream)->getValue(0));
+    }
+
+    TEST_F(MsgPack_UT, invalidBuffer) {
+        auto const pStream = makeMsgPackStream(std::istringstream(std::string("\x92\x01", 2))); // truncated array
+
+        ASSERT_TRUE(pStream->openKey("values").isNull());
+        ASSERT_EQ(0, pStream->size());
+    }
+
+    TEST_F(MsgPack_UT, emptyVector) {
+        const std::string key = "array";
+        auto const pStream    = makeMsgPackStream();
+
+        pStream->setKeyValue(key, std::vector<int>{});
+        auto const out = reload(*pStream)->getKeyValue(key, std::vector<int>{});
+
+        ASSERT_TRUE(out.empty());
+    }
+} // namespace NS_OSBASE::core::impl::ut
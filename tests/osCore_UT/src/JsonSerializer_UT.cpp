@@ -0,0 +1,138 @@
+// \brief Unit test of the direct json serializers
+
+#include "osCore/Serialization/JsonSerializer.h"
+#include "gtest/gtest.h"
+
+using namespace NS_OSBASE;
+
+namespace NS_OSBASE::core::ut {
+    enum class JsonEnum { value0, value1 = 5 };
+
+    struct JsonSubStruct {
+        std::string label = "default";
+        std::vector<int> values;
+
+        bool operator==(const JsonSubStruct &other) const {
+            return label == other.label && values == other.values;
+        }
+    };
+
+    struct JsonStruct {
+        int intField            = 0;
+        double doubleField      = 0.;
+        bool boolField          = false;
+        unsigned char byteField = 0;
+        JsonEnum enumField      = JsonEnum::value0;
+        std::optional<std::string> optionalField;
+        std::vector<JsonSubStruct> subFields;
+
+        bool operator==(const JsonStruct &other) const {
+            return intField == other.intField && doubleField == other.doubleField && boolField == other.boolField &&
+                   byteField == other.byteField && enumField == other.enumField && optionalField == other.optionalField &&
+                   subFields == other.subFields;
+        }
+    };
+
+    struct JsonNotSerializable {
+        int field = 0;
+    };
+
+    struct JsonStructNotSerializable {
+        int intField = 0;
+        JsonNotSerializable notSerializableField;
+    };
+} // namespace NS_OSBASE::core::ut
+
+OS_JSON_SERIALIZE_STRUCT(NS_OSBASE::core::ut::JsonSubStruct, label, values);
+OS_JSON_SERIALIZE_STRUCT(
+    NS_OSBASE::core::ut::JsonStruct, intField, doubleField, boolField, byteField, enumField, optionalField, subFields);
+OS_JSON_SERIALIZE_STRUCT(NS_OSBASE::core::ut::JsonStructNotSerializable, intField, notSerializableField);
+
+namespace NS_OSBASE::core::ut {
+
+    class JsonSerializer_UT : public testing::Test {
+    protected:
+        static JsonStruct makeStruct() {
+            return JsonStruct{ -12,
+                0.5,
+                true,
+                200,
+                JsonEnum::value1,
+                std::string("optional"),
+                { JsonSubStruct{ "first", { 1, 2 } }, JsonSubStruct{ "second \"quoted\"\n", { 3 } } } };
+        }
+
+        template <typename TValue>
+        static TValue roundTrip(const TValue &value) {
+            TValue out{};
+            EXPECT_TRUE(fromJson(toJson(value), out));
+            return out;
+        }
+    };
+
+    TEST_F(JsonSerializer_UT, serializable) {
+        ASSERT_TRUE(is_json_serializable_v<int>);
+        ASSERT_TRUE(is_json_serializable_v<JsonStruct>);
+        ASSERT_TRUE((is_json_serializable_v<std::tuple<int, std::vector<JsonStruct>, std::optional<double>>>));
+        ASSERT_FALSE(is_json_serializable_v<JsonNotSerializable>);
+        ASSERT_FALSE(is_json_serializable_v<std::vector<JsonNotSerializable>>);
+        ASSERT_FALSE(is_json_serializable_v<JsonStructNotSerializable>);
+    }
+
+    TEST_F(JsonSerializer_UT, json) {
+        // same text as the json key-stream
+        ASSERT_EQ("[1,2.5,true,\"text\",null]", toJson(std::make_tuple(1, 2.5, true, std::string("text"), std::optional<int>{})));
+        ASSERT_EQ("{\"label\":\"a\\\"b\\\\c\\u0001\",\"values\":[]}", toJson(JsonSubStruct{ "a\"b\\c\x01", {} }));
+        ASSERT_EQ("3.0", toJson(3.));
+        ASSERT_EQ("5", toJson(JsonEnum::value1));
+    }
+
+    TEST_F(JsonSerializer_UT, roundTrip) {
+        auto const value = makeStruct();
+        ASSERT_EQ(value, roundTrip(value));
+
+        auto const values = std::make_tuple(std::wstring(L"wide"), 1e-300, -2147483647 - 1, std::vector<bool>{ true, false });
+        ASSERT_EQ(values, roundTrip(values));
+    }
+
+    TEST_F(JsonSerializer_UT, defaultValues) {
+        JsonSubStruct value{ "label", { 4, 5 } };
+
+        // missing members and empty arrays keep the default values, the unknown members are skipped
+        ASSERT_TRUE(fromJson(R"( { "unknown" : { "a" : [ 1, "b", null ] }, "values" : [] } )", value));
+        ASSERT_EQ((JsonSubStruct{ "label", { 4, 5 } }), value);
+
+        // any order
+        ASSERT_TRUE(fromJson(R"({"values":[6],"label":"other"})", value));
+        ASSERT_EQ((JsonSubStruct{ "other", { 6 } }), value);
+
+        // missing rows
+        auto tuple = std::make_tuple(1, 2, 3);
+        ASSERT_TRUE(fromJson("[7]", tuple));
+        ASSERT_EQ(std::make_tuple(7, 2, 3), tuple);
+    }
+
+    TEST_F(JsonSerializer_UT, invalidJson) {
+        int intValue = 0;
+        ASSERT_FALSE(fromJson("1.5", intValue)); // integer expected, as the key-streams
+        ASSERT_FALSE(fromJson("4294967296", intValue));
+        ASSERT_FALSE(fromJson("01", intValue));
+        ASSERT_FALSE(fromJson("1 2", intValue));
+
+        std::string str;
+        ASSERT_FALSE(fromJson("\"unterminated", str));
+        ASSERT_FALSE(fromJson("\"\\x\"", str));
+
+        JsonStruct value;
+        ASSERT_FALSE(fromJson(R"({"intField":1,})", value));
+        ASSERT_FALSE(fromJson(R"({"intField":"1"})", value));
+        ASSERT_FALSE(fromJson(R"([1])", value));
+        ASSERT_FALSE(fromJson(R"({"unknown":)" + std::string(1024, '['), value)); // depth limit
+    }
+
+    TEST_F(JsonSerializer_UT, unicode) {
+        std::string str;
+        ASSERT_TRUE(fromJson(R"("\u00e9\ud83d\ude00")", str));
+        ASSERT_EQ("\xc3\xa9\xf0\x9f\x98\x80", str);
+    }
+} // namespace NS_OSBASE::core::ut
@@ -249,6 +249,41 @@ namespace NS_OSBASE::core::ut {
         out = pStream->getValue(decltype(in){});
         ASSERT_EQ(in, out);
     }
+
+    struct MyOptionalData {
+        std::optional<MySubCustomData> subField;
+        std::optional<std::vector<int>> vectorField;
+        std::optional<std::string> strField;
+        bool operator==(const MyOptionalData &other) const {
+            return subField == other.subField && vectorField == other.vectorField && strField == other.strField;
+        }
+    };
+
+    TEST(KeyStream_UT, optional_members) {
+        const MyOptionalData engaged{ MySubCustomData{ "toto" }, std::vector<int>{ 1, 2 }, std::string() };
+        const MyOptionalData null{};
+
+        auto const roundTrip = [](const std::string &keyStreamFamily, const MyOptionalData &in) {
+            const std::string keyName = "optionalData";
+            auto const pKeyStream     = core::makeKeyStream(keyStreamFamily);
+            *pKeyStream << core::makeKeyValue(keyName, in);
+            auto keyValue = core::makeKeyValue<MyOptionalData>(keyName);
+            *pKeyStream >> keyValue;
+            return keyValue.getValue();
+        };
+
+        for (auto &&keyStreamFamily : core::getKeyStreamFamilies()) {
+            // an element with children only (xml) or an empty string is not a null value
+            ASSERT_EQ(engaged, roundTrip(keyStreamFamily, engaged)) << keyStreamFamily;
+            if (core::makeKeyStream(keyStreamFamily)->hasNull()) {
+                ASSERT_EQ(null, roundTrip(keyStreamFamily, null)) << keyStreamFamily;
+            }
+        }
+
+        ASSERT_FALSE(core::makeXmlStream()->hasNull());
+        ASSERT_TRUE(core::makeJsonStream()->hasNull());
+    }
 } // namespace NS_OSBASE::core::ut
 OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::core::ut::MySubCustomData, strField);
 OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::core::ut::MyCustomData, intField, subCustomDataField);
+OS_KEY_SERIALIZE_STRUCT(NS_OSBASE::core::ut::MyOptionalData, subField, vectorField, strField);
@@ -94,6 +94,90 @@ namespace NS_OSBASE::data::ut {
         std::promise<void> m_called;
     };
 
+    class EchoSupplierDelegate : public IMessaging::ISupplierDelegate {
+    public:
+        std::string onCall(const IMessaging::JsonText &json) override {
+            return json;
+        }
+    };
+
+    class ResultDelegate : public IMessaging::IClientDelegate {
+    public:
+        void onResult(const IMessaging::JsonText &json) override {
+            m_result.set_value(json);
+        }
+
+        std::promise<std::string> m_result;
+    };
+
+    class ForwardingSupplierDelegate : public IMessaging::ISupplierDelegate {
+    public:
+        ForwardingSupplierDelegate(IMessagingPtr pMessaging, std::string uri) : m_pMessaging(std::move(pMessaging)), m_uri(std::move(uri)) {
+        }
+
+        std::string onCall(const IMessaging::JsonText &json) override {
+            // synchronous call of another messaging: its result is received by the session of the process
+            auto const pResultDelegate = std::make_shared<ResultDelegate>();
+            auto fResult               = pResultDelegate->m_result.get_future();
+            m_pMessaging->invoke(m_uri, json, pResultDelegate, nullptr);
+            if (fResult.wait_for(std::chrono::seconds(5)) == std::future_status::timeout) {
+                return "timeout";
+            }
+            return fResult.get();
+        }
+
+    private:
+        IMessagingPtr m_pMessaging;
+        std::string m_uri;
+    };
+
+    class CountingDelegate : public IMessaging::IEventDelegate, public IMessaging::IClientDelegate {
+    public:
+        void onEvent(const IMessaging::JsonText &) override {
+            count();
+        }
+
+        void onResult(const IMessaging::JsonText &) override {
+            count();
+        }
+
+        bool wait(const size_t nbMessages, const std::chrono::milliseconds &timeout) {
+            std::unique_lock lock(m_mut);
+            return m_cv.wait_for(lock, timeout, [this, nbMessages]() { return m_nbMessages >= nbMessages; });
+        }
+
+    private:
+        void count() {
+            std::lock_guard lock(m_mut);
+            ++m_nbMessages;
+            m_cv.notify_all();
+        }
+
+        std::mutex m_mut;
+        std::condition_variable m_cv;
+        size_t m_nbMessages = 0;
+    };
+
+    class RecordingDelegate : public IMessaging::IEventDelegate {
+    public:
+        void onEvent(const IMessaging::JsonText &json) override {
+            std::lock_guard lock(m_mut);
+            m_events.push_back(json);
+            m_cv.notify_all();
+        }
+
+        std::vector<std::string> wait(const size_t nbEvents, const std::chrono::milliseconds &timeout) {
+            std::unique_lock lock(m_mut);
+            m_cv.wait_for(lock, timeout, [this, nbEvents]() { return m_events.size() >= nbEvents; });
+            return m_events;
+        }
+
+    private:
+        std::mutex m_mut;
+        std::condition_variable m_cv;
+        std::vector<std::string> m_events;
+    };
+
     class IMessaging_UT : public testing::Test {
     protected:
         class MessagingConnectionObserver : public core::Observer<IMessaging::MessagingConnectionMsg> {
@@ -435,4 +519,279 @@ namespace NS_OSBASE::data::ut {
         ASSERT_EQ(status, std::future_status::timeout);
     }
 
+    TEST_F(IMessaging_UT, Messagings_Of_The_Process_Share_The_Session) {
+        const std::string topic = "com.test.sharedTopic";
+        const std::string args  = "args";
+
+        auto wampcc1 = connectToWamp();
+        auto wampcc2 = connectToWamp();
+
+        auto pEventDelegate1 = std::make_shared<TestEventDelegate>();
+        auto pEventDelegate2 = std::make_shared<TestEventDelegate>();
+        auto pErrorDelegate  = std::make_shared<TestErrorDelegate>();
+        auto fEvent1         = pEventDelegate1->m_received.get_future();
+        auto fEvent2         = pEventDelegate2->m_received.get_future();
+
+        // same topic subscribed by both messagings: dispatched to both delegates, the publisher included
+        wampcc1->subscribe(topic, pEventDelegate1, pErrorDelegate);
+        wampcc2->subscribe(topic, pEventDelegate2, pErrorDelegate);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        wampcc1->publish(topic, args, pErrorDelegate);
+
+        ASSERT_NE(fEvent1.wait_for(std::chrono::seconds(5)), std::future_status::timeout);
+        ASSERT_EQ(fEvent1.get(), args);
+        ASSERT_NE(fEvent2.wait_for(std::chrono::seconds(5)), std::future_status::timeout);
+        ASSERT_EQ(fEvent2.get(), args);
+
+        // the session is kept while used by a messaging
+        MessagingConnectionObserver o;
+        wampcc2->attachAll(o);
+        wampcc1->disconnect();
+        ASSERT_FALSE(o.wait().has_value());
+
+        pEventDelegate2->m_received = std::promise<std::string>();
+        fEvent2                     = pEventDelegate2->m_received.get_future();
+        wampcc2->publish(topic, args, pErrorDelegate);
+        ASSERT_NE(fEvent2.wait_for(std::chrono::seconds(5)), std::future_status::timeout);
+
+        wampcc2->detachAll(o);
+        wampcc2->disconnect();
+    }
+
+    TEST_F(IMessaging_UT, Registered_Call_Waits_For_The_Call_Of_Another_Messaging) {
+        const std::string forwardUri = "com.test.forward";
+        const std::string echoUri    = "com.test.forward.echo";
+
+        auto const pImpl    = connectToWamp();
+        auto const pStub    = connectToWamp();
+        auto const pEcho    = connectToWamp();
+        auto const pCaller  = connectToWamp();
+        auto pErrorDelegate = std::make_shared<TestErrorDelegate>();
+
+        // the delegate of the impl waits for the call of the stub: it must not run on the event thread of the shared session
+        auto const pForwardDelegate = std::make_shared<ForwardingSupplierDelegate>(pStub, echoUri);
+        auto const pEchoDelegate    = std::make_shared<EchoSupplierDelegate>();
+        pImpl->registerCall(forwardUri, pForwardDelegate, pErrorDelegate);
+        pEcho->registerCall(echoUri, pEchoDelegate, pErrorDelegate);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        auto const argTest = std::string("Test");
+        auto const pStream = core::makeJsonStream();
+        pStream->setValue(std::make_tuple(argTest));
+        std::ostringstream oss;
+        oss << *pStream;
+
+        auto const pClientDelegate = std::make_shared<TestClientDelegate>();
+        auto fClient               = pClientDelegate->m_received.get_future();
+        pCaller->invoke(forwardUri, oss.str(), pClientDelegate, pErrorDelegate);
+
+        ASSERT_NE(fClient.wait_for(std::chrono::seconds(10)), std::future_status::timeout);
+        ASSERT_EQ(fClient.get(), argTest);
+
+        pCaller->disconnect();
+        pEcho->disconnect();
+        pStub->disconnect();
+        pImpl->disconnect();
+    }
+
+    TEST_F(IMessaging_UT, Events_And_Calls_Are_Dispatched_Under_Contention) {
+        constexpr size_t nbTopics  = 100;
+        constexpr size_t nbEvents  = 10; // per topic
+        constexpr size_t nbCallers = 4;
+        constexpr size_t nbCalls   = 50; // per caller
+        const std::string uri      = "com.test.contention.echo";
+
+        auto const topicName = [](const size_t index) { return "com.test.contention.topic" + std::to_string(index); };
+
+        auto const pSubscriber = connectToWamp();
+        auto const pSupplier   = connectToWamp();
+        auto const pChurner    = connectToWamp();
+        auto const pError      = std::make_shared<TestErrorDelegate>();
+
+        std::vector<std::shared_ptr<CountingDelegate>> pEventDelegates;
+        for (size_t index = 0; index < nbTopics; ++index) {
+            pEventDelegates.push_back(std::make_shared<CountingDelegate>());
+            pSubscriber->subscribe(topicName(index), pEventDelegates.back(), pError);
+        }
+        auto const pEcho = std::make_shared<EchoSupplierDelegate>();
+        pSupplier->registerCall(uri, pEcho, pError);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        // the events are dispatched while the calls are answered and while the same topics are (un)subscribed in the session
+        std::atomic_bool bStop = false;
+        std::thread churner([&]() {
+            auto const pDelegate = std::make_shared<CountingDelegate>();
+            for (size_t index = 0; !bStop; index = (index + 1) % nbTopics) {
+                pChurner->subscribe(topicName(index), pDelegate, nullptr);
+                pChurner->unsubscribe(topicName(index), nullptr);
+            }
+        });
+        auto const guard = core::make_scope_exit([&]() {
+            bStop = true;
+            churner.join();
+            pChurner->disconnect();
+            pSupplier->disconnect();
+            pSubscriber->disconnect();
+        });
+
+        std::vector<std::shared_ptr<CountingDelegate>> pClientDelegates;
+        std::vector<std::thread> callers;
+        for (size_t caller = 0; caller < nbCallers; ++caller) {
+            pClientDelegates.push_back(std::make_shared<CountingDelegate>());
+            callers.emplace_back([&pSupplier, &uri, pClientDelegate = pClientDelegates.back()]() {
+                for (size_t call = 0; call < nbCalls; ++call) {
+                    pSupplier->invoke(uri, "args", pClientDelegate, nullptr);
+                }
+            });
+        }
+
+        for (size_t event = 0; event < nbEvents; ++event) {
+            for (size_t index = 0; index < nbTopics; ++index) {
+                pSupplier->publish(topicName(index), "args", pError);
+            }
+        }
+
+        for (auto &caller : callers) {
+            caller.join();
+        }
+        for (auto const &pEventDelegate : pEventDelegates) {
+            ASSERT_TRUE(pEventDelegate->wait(nbEvents, std::chrono::seconds(10)));
+        }
+        for (auto const &pClientDelegate : pClientDelegates) {
+            ASSERT_TRUE(pClientDelegate->wait(nbCalls, std::chrono::seconds(10)));
+        }
+    }
+
+    TEST_F(IMessaging_UT, Session_Spread_Over_IO_Threads) {
+        constexpr size_t nbUris = 8; // bound to the 4 connections of the session
+        const data::Uri uri{ "ws://127.0.0.1:8080" };
+        const std::string realm{ "test_realm_io_threads" };
+
+        auto const pMessaging = makeWampMessaging(uri, realm, ThreadSettings{ 4, {} });
+        pMessaging->connect();
+        auto const guard = core::make_scope_exit([&pMessaging]() { pMessaging->disconnect(); });
+
+        auto const pEcho          = std::make_shared<EchoSupplierDelegate>();
+        auto const pEventDelegate = std::make_shared<CountingDelegate>();
+        auto const pResults       = std::make_shared<CountingDelegate>();
+        for (size_t index = 0; index < nbUris; ++index) {
+            pMessaging->registerCall("com.test.io.echo" + std::to_string(index), pEcho, nullptr);
+            pMessaging->subscribe("com.test.io.topic" + std::to_string(index), pEventDelegate, nullptr);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        // each uri and topic goes through its connection, the invocations and events come back through it
+        for (size_t index = 0; index < nbUris; ++index) {
+            pMessaging->invoke("com.test.io.echo" + std::to_string(index), "args", pResults, nullptr);
+            pMessaging->publish("com.test.io.topic" + std::to_string(index), "args", nullptr);
+        }
+
+        ASSERT_TRUE(pResults->wait(nbUris, std::chrono::seconds(5)));
+        ASSERT_TRUE(pEventDelegate->wait(nbUris, std::chrono::seconds(5)));
+    }
+
+    TEST_F(IMessaging_UT, RawSocket_And_WebSocket_Share_The_Broker) {
+        const std::string uri   = "com.test.rawsocket.echo";
+        const std::string topic = "com.test.rawsocket.topic";
+
+        auto const pRawSocket = makeWampMessaging(std::string{ "rs://127.0.0.1:8080" }, "test_realm");
+        auto const pWebSocket = connectToWamp();
+        pRawSocket->connect();
+        auto const guard = core::make_scope_exit([&pRawSocket, &pWebSocket]() {
+            pRawSocket->disconnect();
+            pWebSocket->disconnect();
+        });
+
+        auto const pEcho          = std::make_shared<EchoSupplierDelegate>();
+        auto const pResults       = std::make_shared<CountingDelegate>();
+        auto const pEventDelegate = std::make_shared<CountingDelegate>();
+        pRawSocket->registerCall(uri, pEcho, nullptr);
+        pWebSocket->subscribe(topic, pEventDelegate, nullptr);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        pWebSocket->invoke(uri, "args", pResults, nullptr);
+        pRawSocket->invoke(uri, "args", pResults, nullptr);
+        pRawSocket->publish(topic, "args", nullptr);
+
+        ASSERT_TRUE(pResults->wait(2, std::chrono::seconds(5)));
+        ASSERT_TRUE(pEventDelegate->wait(1, std::chrono::seconds(5)));
+    }
+
+    TEST_F(IMessaging_UT, Batched_Publications_Are_Received_In_Order) {
+        constexpr size_t nbEvents = 100;
+        const std::string topic   = "com.test.batching.topic";
+
+        auto const pMessaging = connectToWamp();
+        auto const guard      = core::make_scope_exit([&pMessaging]() { pMessaging->disconnect(); });
+        pMessaging->setPublishBatching(IMessaging::PublishBatching{ std::chrono::milliseconds(50), 0 });
+        pMessaging->setPublishBatched(topic, true);
+
+        auto const pEventDelegate = std::make_shared<RecordingDelegate>();
+        pMessaging->subscribe(topic, pEventDelegate, nullptr);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        std::vector<std::string> published;
+        for (size_t index = 0; index < nbEvents; ++index) {
+            published.push_back(std::to_string(index));
+            pMessaging->publish(topic, published.back(), nullptr);
+        }
+
+        ASSERT_EQ(published, pEventDelegate->wait(nbEvents, std::chrono::seconds(5)));
+    }
+
+    TEST_F(IMessaging_UT, Flushed_And_Unbatched_Publications_Are_Sent_At_Once) {
+        const std::string batchedTopic   = "com.test.batching.batched";
+        const std::string unbatchedTopic = "com.test.batching.unbatched";
+
+        auto const pMessaging = connectToWamp();
+        auto const guard      = core::make_scope_exit([&pMessaging]() { pMessaging->disconnect(); });
+        pMessaging->setPublishBatching(IMessaging::PublishBatching{ std::chrono::minutes(1), 0 });
+        pMessaging->setPublishBatched(batchedTopic, true);
+
+        auto const pBatched   = std::make_shared<RecordingDelegate>();
+        auto const pUnbatched = std::make_shared<RecordingDelegate>();
+        pMessaging->subscribe(batchedTopic, pBatched, nullptr);
+        pMessaging->subscribe(unbatchedTopic, pUnbatched, nullptr);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        pMessaging->publish(batchedTopic, "1", nullptr);
+        pMessaging->publish(batchedTopic, "2", nullptr);
+        pMessaging->publish(unbatchedTopic, "3", nullptr);
+
+        // the batch waits for the window, not the topic left out of the batching (default)
+        ASSERT_EQ(std::vector<std::string>{ "3" }, pUnbatched->wait(1, std::chrono::seconds(5)));
+        ASSERT_TRUE(pBatched->wait(1, std::chrono::milliseconds(100)).empty());
+
+        pMessaging->flush();
+        ASSERT_EQ((std::vector<std::string>{ "1", "2" }), pBatched->wait(2, std::chrono::seconds(5)));
+    }
+
+    TEST_F(IMessaging_UT, Byte_Budget_Sends_The_Batch) {
+        const std::string topic = "com.test.batching.budget";
+
+        auto const pMessaging = connectToWamp();
+        auto const guard      = core::make_scope_exit([&pMessaging]() { pMessaging->disconnect(); });
+        pMessaging->setPublishBatching(IMessaging::PublishBatching{ std::chrono::minutes(1), 4 });
+        pMessaging->setPublishBatched(topic, true);
+
+        auto const pEventDelegate = std::make_shared<RecordingDelegate>();
+        pMessaging->subscribe(topic, pEventDelegate, nullptr);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        pMessaging->publish(topic, "12", nullptr);
+        pMessaging->publish(topic, "34", nullptr);
+
+        ASSERT_EQ((std::vector<std::string>{ "12", "34" }), pEventDelegate->wait(2, std::chrono::seconds(5)));
+    }
+
+    TEST_F(IMessaging_UT, Unsupported_Scheme_Should_Throw) {
+        auto const pMessaging = makeWampMessaging(std::string{ "http://127.0.0.1:8080" }, "test_realm");
+        ASSERT_THROW(pMessaging->connect(), MessagingException);
+    }
+
 } // namespace NS_OSBASE::data::ut